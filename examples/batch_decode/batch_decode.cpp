@@ -0,0 +1,455 @@
+/**
+ * @brief Desktop batch decoder: decodes a list of mp3 and aac (ADTS) files on
+ * a pool of worker threads, each with its own decoder instance. Writes wav or
+ * raw pcm files, or only a checksum of the pcm data, and reports the timing
+ * per file and the aggregate throughput. With -s each file is split into
+ * segments which are decoded in parallel as well. With -a the files are not
+ * decoded: only the frame headers are analyzed.
+ *
+ * Usage: batch_decode [-a] [-j threads] [-s segments] [-o outdir]
+ *        [-f wav|raw|crc] files...
+ *
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AACParallelDecoderHelix.h"
+#include "MP3ParallelDecoderHelix.h"
+#include "StreamAnalyzerHelix.h"
+#include "aacdec.h"
+#include "mp3dec.h"
+
+using Clock = std::chrono::steady_clock;
+
+enum class OutputMode { Wav, Raw, Crc };
+
+/// Result of decoding one file
+struct FileResult {
+  std::string name;
+  bool ok = false;
+  long frames = 0;
+  long errors = 0;
+  long samples = 0;  // per channel
+  int channels = 0;
+  int sample_rate = 0;
+  uint32_t crc = 0;
+  double seconds = 0;  // decode time
+  size_t in_bytes = 0;
+};
+
+/// CRC-32 (IEEE 802.3, same as zlib) of the pcm data
+class Crc32 {
+ public:
+  Crc32() {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      table[i] = c;
+    }
+  }
+  uint32_t update(uint32_t crc, const uint8_t *data, size_t len) const {
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++)
+      crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    return ~crc;
+  }
+
+ protected:
+  uint32_t table[256];
+};
+
+static const Crc32 crc32;
+
+/// Receives the decoded pcm data of one file
+class PCMSink {
+ public:
+  PCMSink(OutputMode mode, FileResult &result) : mode(mode), result(result) {}
+  ~PCMSink() { close(); }
+
+  bool open(const std::string &path) {
+    if (mode == OutputMode::Crc) return true;
+    file = fopen(path.c_str(), "wb");
+    if (file == nullptr) return false;
+    if (mode == OutputMode::Wav) writeWavHeader(0);
+    return true;
+  }
+
+  void write(const short *pcm, int n, int channels, int sampleRate) {
+    if (n <= 0) return;
+    if (result.channels == 0) {
+      result.channels = channels;
+      result.sample_rate = sampleRate;
+    }
+    result.samples += n / channels;
+    const uint8_t *data = (const uint8_t *)pcm;
+    size_t len = n * sizeof(short);
+    result.crc = crc32.update(result.crc, data, len);
+    if (file != nullptr) fwrite(data, 1, len, file);
+  }
+
+  void close() {
+    if (file == nullptr) return;
+    if (mode == OutputMode::Wav) {
+      fseek(file, 0, SEEK_SET);
+      writeWavHeader((uint32_t)(result.samples * result.channels * 2));
+    }
+    fclose(file);
+    file = nullptr;
+  }
+
+ protected:
+  OutputMode mode;
+  FileResult &result;
+  FILE *file = nullptr;
+
+  void write32(uint32_t v) {
+    uint8_t b[4] = {(uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16),
+                    (uint8_t)(v >> 24)};
+    fwrite(b, 1, 4, file);
+  }
+  void write16(uint16_t v) {
+    uint8_t b[2] = {(uint8_t)v, (uint8_t)(v >> 8)};
+    fwrite(b, 1, 2, file);
+  }
+
+  void writeWavHeader(uint32_t dataSize) {
+    int channels = result.channels == 0 ? 2 : result.channels;
+    int rate = result.sample_rate == 0 ? 44100 : result.sample_rate;
+    fwrite("RIFF", 1, 4, file);
+    write32(36 + dataSize);
+    fwrite("WAVEfmt ", 1, 8, file);
+    write32(16);
+    write16(1);  // PCM
+    write16(channels);
+    write32(rate);
+    write32(rate * channels * 2);
+    write16(channels * 2);
+    write16(16);
+    fwrite("data", 1, 4, file);
+    write32(dataSize);
+  }
+};
+
+static bool isAAC(const std::string &path) {
+  size_t pos = path.rfind('.');
+  if (pos == std::string::npos) return false;
+  std::string ext = path.substr(pos + 1);
+  for (auto &c : ext) c = tolower(c);
+  return ext == "aac" || ext == "adts";
+}
+
+static bool readFile(const std::string &path, std::vector<uint8_t> &data) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if (f == nullptr) {
+    fprintf(stderr, "could not open %s\n", path.c_str());
+    return false;
+  }
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data.resize(size > 0 ? size : 0);
+  size_t len = fread(data.data(), 1, data.size(), f);
+  fclose(f);
+  data.resize(len);
+  return true;
+}
+
+/// Decoder instances owned by one worker thread: created on first use and
+/// reset (not reallocated) for each further file
+class Worker {
+ public:
+  Worker(int segments) : segments(segments) {}
+  ~Worker() {
+    if (mp3 != nullptr) MP3FreeDecoder(mp3);
+    if (aac != nullptr) AACFreeDecoder(aac);
+  }
+
+  void decode(const std::string &path, const std::string &outPath,
+              OutputMode mode, FileResult &result) {
+    std::vector<uint8_t> data;
+    if (!readFile(path, data)) return;
+    result.in_bytes = data.size();
+    PCMSink sink(mode, result);
+    if (!sink.open(outPath)) {
+      fprintf(stderr, "could not create %s\n", outPath.c_str());
+      return;
+    }
+    auto start = Clock::now();
+    result.ok = isAAC(path) ? decodeAAC(data, sink, result)
+                            : decodeMP3(data, sink, result);
+    result.seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+  }
+
+ protected:
+  HMP3Decoder mp3 = nullptr;
+  HAACDecoder aac = nullptr;
+  int segments;
+  short pcm[AAC_MAX_NCHANS * AAC_MAX_NSAMPS * 2 > MAX_NCHAN * MAX_NGRAN * MAX_NSAMP
+                ? AAC_MAX_NCHANS * AAC_MAX_NSAMPS * 2
+                : MAX_NCHAN * MAX_NGRAN * MAX_NSAMP];
+
+  bool decodeMP3(std::vector<uint8_t> &data, PCMSink &sink,
+                 FileResult &result) {
+    if (segments > 1) return decodeMP3Segments(data, sink, result);
+    if (mp3 == nullptr) mp3 = MP3InitDecoder();
+    else MP3ResetDecoder(mp3);
+    if (mp3 == nullptr) return false;
+    unsigned char *ptr = data.data();
+    int left = data.size();
+    while (left > 4) {
+      int offset = MP3FindSyncWord(ptr, left);
+      if (offset < 0) break;
+      ptr += offset;
+      left -= offset;
+      int rc = MP3Decode(mp3, &ptr, &left, pcm, 0);
+      if (rc == ERR_MP3_NONE) {
+        MP3FrameInfo info;
+        MP3GetLastFrameInfo(mp3, &info);
+        sink.write(pcm, info.outputSamps, info.nChans, info.samprate);
+        result.frames++;
+      } else if (rc == ERR_MP3_INDATA_UNDERFLOW) {
+        break;
+      } else {
+        // missing bit reservoir after a resync is not an error
+        if (rc != ERR_MP3_MAINDATA_UNDERFLOW) {
+          result.errors++;
+          ptr++;
+          left--;
+        }
+      }
+    }
+    return true;
+  }
+
+  bool decodeMP3Segments(std::vector<uint8_t> &data, PCMSink &sink,
+                         FileResult &result) {
+    libhelix::MP3ParallelDecoderHelix decoder;
+    std::vector<short> out;
+    bool ok = decoder.decode(data.data(), data.size(), segments, out);
+    MP3FrameInfo info = decoder.audioInfo();
+    if (info.nChans > 0)
+      sink.write(out.data(), out.size(), info.nChans, info.samprate);
+    result.frames = decoder.decodedFrames();
+    result.errors = decoder.errorCount();
+    return ok;
+  }
+
+  bool decodeAAC(std::vector<uint8_t> &data, PCMSink &sink,
+                 FileResult &result) {
+    if (segments > 1) return decodeAACSegments(data, sink, result);
+    if (aac == nullptr) aac = AACInitDecoder();
+    else AACResetDecoder(aac);
+    if (aac == nullptr) return false;
+    unsigned char *ptr = data.data();
+    int left = data.size();
+    while (left > 4) {
+      int offset = AACFindSyncWord(ptr, left);
+      if (offset < 0) break;
+      ptr += offset;
+      left -= offset;
+      int rc = AACDecode(aac, &ptr, &left, pcm);
+      if (rc == ERR_AAC_NONE) {
+        AACFrameInfo info;
+        AACGetLastFrameInfo(aac, &info);
+        sink.write(pcm, info.outputSamps, info.nChans, info.sampRateOut);
+        result.frames++;
+      } else if (rc == ERR_AAC_INDATA_UNDERFLOW) {
+        break;
+      } else {
+        result.errors++;
+        ptr++;
+        left--;
+      }
+    }
+    return true;
+  }
+
+  bool decodeAACSegments(std::vector<uint8_t> &data, PCMSink &sink,
+                         FileResult &result) {
+    libhelix::AACParallelDecoderHelix decoder;
+    std::vector<short> out;
+    bool ok = decoder.decode(data.data(), data.size(), segments, out);
+    AACFrameInfo info = decoder.audioInfo();
+    if (info.nChans > 0)
+      sink.write(out.data(), out.size(), info.nChans, info.sampRateOut);
+    result.frames = decoder.decodedFrames();
+    result.errors = decoder.errorCount();
+    return ok;
+  }
+};
+
+/// Reports the header analysis of each file
+static int analyzeFiles(const std::vector<std::string> &files) {
+  libhelix::StreamAnalyzerHelix analyzer;
+  int failed = 0;
+  double seconds = 0;
+  printf("%-40s %8s %10s %8s %8s %8s %4s %6s %3s %6s %8s\n", "file", "frames",
+         "audio[s]", "min[kb]", "avg[kb]", "max[kb]", "vbr", "rate", "ch",
+         "gaps", "gap[b]");
+  for (auto &file : files) {
+    std::vector<uint8_t> data;
+    libhelix::StreamAnalysisHelix r;
+    bool ok = readFile(file, data);
+    auto start = Clock::now();
+    if (ok)
+      ok = isAAC(file) ? analyzer.analyzeAAC(data.data(), data.size(), r)
+                       : analyzer.analyzeMP3(data.data(), data.size(), r);
+    seconds += std::chrono::duration<double>(Clock::now() - start).count();
+    if (!ok) failed++;
+    printf("%-40s %8ld %10.3f %8d %8d %8d %4s %6d %3d %6ld %8ld%s%s%s\n",
+           file.c_str(), r.frames, r.duration, r.bitrate_min / 1000,
+           r.bitrate_avg / 1000, r.bitrate_max / 1000, r.vbr ? "yes" : "no",
+           r.sample_rate, r.channels, r.gaps, r.gap_bytes,
+           r.sample_rate_changes + r.channel_changes > 0 ? " FORMAT-CHANGES"
+                                                          : "",
+           r.truncated ? " TRUNCATED" : "", ok ? "" : " FAILED");
+  }
+  printf("\n%zu files analyzed in %.3f s\n", files.size(), seconds);
+  return failed == 0 ? 0 : 2;
+}
+
+/// Output file names: the base name of the input, with a numbered suffix if
+/// several inputs have the same base name (e.g. a/x.mp3, b/x.mp3 -> x.wav,
+/// x-2.wav)
+static std::vector<std::string> outputPaths(
+    const std::string &dir, const std::vector<std::string> &files,
+    OutputMode mode) {
+  std::vector<std::string> result;
+  std::vector<std::string> names;
+  for (auto &in : files) {
+    if (mode == OutputMode::Crc) {
+      result.push_back("");
+      continue;
+    }
+    size_t pos = in.find_last_of("/\\");
+    std::string name = pos == std::string::npos ? in : in.substr(pos + 1);
+    pos = name.rfind('.');
+    if (pos != std::string::npos) name = name.substr(0, pos);
+    std::string unique = name;
+    for (int n = 2; std::find(names.begin(), names.end(), unique) !=
+                    names.end();
+         n++)
+      unique = name + "-" + std::to_string(n);
+    names.push_back(unique);
+    unique += mode == OutputMode::Wav ? ".wav" : ".pcm";
+    result.push_back(dir.empty() ? unique : dir + "/" + unique);
+  }
+  return result;
+}
+
+static void usage() {
+  fprintf(stderr,
+          "usage: batch_decode [-a] [-j threads] [-s segments] [-o outdir] "
+          "[-f wav|raw|crc] files...\n"
+          "  -a  only analyze the frame headers: duration, bitrates, format "
+          "changes, gaps\n"
+          "  -j  number of worker threads (default: number of cores)\n"
+          "  -s  split each file into segments which are decoded on "
+          "separate threads\n      (workers are limited to cores / segments)\n"
+          "  -o  output directory for wav/raw files (default: current)\n"
+          "  -f  output: wav (default), raw 16 bit pcm, or crc32 of the pcm "
+          "data only\n");
+}
+
+int main(int argc, char **argv) {
+  int cores = std::thread::hardware_concurrency();
+  int threads = cores;
+  int segments = 1;
+  bool analyze = false;
+  std::string outDir;
+  OutputMode mode = OutputMode::Wav;
+  std::vector<std::string> files;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "-a") {
+      analyze = true;
+    } else if (arg == "-j" && i + 1 < argc) {
+      threads = atoi(argv[++i]);
+    } else if (arg == "-s" && i + 1 < argc) {
+      segments = atoi(argv[++i]);
+    } else if (arg == "-o" && i + 1 < argc) {
+      outDir = argv[++i];
+    } else if (arg == "-f" && i + 1 < argc) {
+      std::string f = argv[++i];
+      if (f == "wav") mode = OutputMode::Wav;
+      else if (f == "raw") mode = OutputMode::Raw;
+      else if (f == "crc") mode = OutputMode::Crc;
+      else {
+        usage();
+        return 1;
+      }
+    } else if (arg == "-h" || arg == "--help") {
+      usage();
+      return 0;
+    } else {
+      files.push_back(arg);
+    }
+  }
+  if (files.empty()) {
+    usage();
+    return 1;
+  }
+  if (analyze) return analyzeFiles(files);
+  // each worker decodes its segments on separate threads: don't use more
+  // threads than cores, so that the timings are not distorted
+  if (segments > 1 && threads > cores / segments) threads = cores / segments;
+  if (threads < 1) threads = 1;
+  if (threads > (int)files.size()) threads = files.size();
+
+  // workers pick the next file until the list is exhausted
+  std::vector<FileResult> results(files.size());
+  std::vector<std::string> outPaths = outputPaths(outDir, files, mode);
+  std::atomic<size_t> next{0};
+  auto start = Clock::now();
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++) {
+    pool.emplace_back([&]() {
+      Worker worker(segments);
+      for (size_t i = next++; i < files.size(); i = next++) {
+        results[i].name = files[i];
+        worker.decode(files[i], outPaths[i], mode, results[i]);
+      }
+    });
+  }
+  for (auto &t : pool) t.join();
+  double wall = std::chrono::duration<double>(Clock::now() - start).count();
+
+  // report in the order of the arguments
+  double audioTotal = 0, cpuTotal = 0;
+  size_t bytesTotal = 0;
+  int failed = 0;
+  printf("%-40s %8s %6s %10s %9s %9s %8s", "file", "frames", "errors",
+         "audio[s]", "time[ms]", "realtime", "crc32");
+  printf("\n");
+  for (auto &r : results) {
+    double audio = r.sample_rate > 0 ? (double)r.samples / r.sample_rate : 0;
+    if (!r.ok) failed++;
+    audioTotal += audio;
+    cpuTotal += r.seconds;
+    bytesTotal += r.in_bytes;
+    printf("%-40s %8ld %6ld %10.2f %9.1f %8.0fx %08x%s\n", r.name.c_str(),
+           r.frames, r.errors, audio, r.seconds * 1000.0,
+           r.seconds > 0 ? audio / r.seconds : 0.0, (unsigned)r.crc,
+           r.ok ? "" : " FAILED");
+  }
+  printf("\n%zu files, %d threads: %.2f s audio in %.3f s wall time "
+         "(%.3f s decoding)\n",
+         files.size(), threads, audioTotal, wall, cpuTotal);
+  if (wall > 0)
+    printf("throughput: %.0fx realtime, %.2f MB/s input\n", audioTotal / wall,
+           bytesTotal / wall / 1e6);
+  return failed == 0 ? 0 : 2;
+}
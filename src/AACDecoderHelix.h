@@ -50,6 +50,25 @@ class AACDecoderHelix : public CommonHelix {
   /// Provides the last available _AACFrameInfo_t
   _AACFrameInfo audioInfo() { return aacFrameInfo; }
 
+  /// Decodes HE-AAC (SBR) streams at the core sample rate with the 32-band
+  /// synthesis filterbank instead of at twice the core sample rate: the
+  /// high band is kept up to half the core sample rate
+  void setDownsampledSBR(bool active) {
+    this->downsampled_sbr = active;
+    if (decoder != nullptr) {
+      AACSetDownsampledSBR(decoder, active);
+    }
+  }
+
+  /// Decodes HE-AAC (SBR) streams with real-valued instead of complex
+  /// filterbanks: cheaper, with a small loss of quality in the high band
+  void setLowPowerSBR(bool active) {
+    this->low_power_sbr = active;
+    if (decoder != nullptr) {
+      AACSetLowPowerSBR(decoder, active);
+    }
+  }
+
   /// Releases the reserved memory
   virtual void end() override {
     LOGD_HELIX( "end");
@@ -86,6 +105,8 @@ class AACDecoderHelix : public CommonHelix {
   AACInfoCallback infoCallback = nullptr;
   _AACFrameInfo aacFrameInfo;
   void *p_caller_data = nullptr;
+  bool downsampled_sbr = false;
+  bool low_power_sbr = false;
 
   /// Allocate the decoder
   virtual bool allocateDecoder() override {
@@ -93,7 +114,17 @@ class AACDecoderHelix : public CommonHelix {
       decoder = AACInitDecoder();
     }
     memset(&aacFrameInfo, 0, sizeof(_AACFrameInfo));
-    return decoder != nullptr;
+    if (decoder == nullptr) return false;
+    AACSetDownsampledSBR(decoder, downsampled_sbr);
+    AACSetLowPowerSBR(decoder, low_power_sbr);
+    return true;
+  }
+
+  /// Clears the decoder state
+  bool resetDecoder() override {
+    if (decoder == nullptr) return false;
+    memset(&aacFrameInfo, 0, sizeof(_AACFrameInfo));
+    return AACResetDecoder(decoder) == 0;
   }
 
   /// finds the sync word in the buffer
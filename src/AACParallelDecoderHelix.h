@@ -0,0 +1,361 @@
+#pragma once
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "ParallelHelix.h"
+#include "libhelix-aac/aacdec.h"
+
+namespace libhelix {
+
+/**
+ * @brief Decodes a complete AAC (ADTS) file which is held in memory on
+ * multiple threads. The file is split at ADTS frame boundaries. A segment
+ * starts decoding some frames early so that the overlap buffers are settled
+ * when the first frame of the segment is reached.
+ *
+ * The PNS noise generator and, with HE-AAC, the phases of the SBR noise and
+ * sinusoids depend on all preceding frames. A first pass only parses the
+ * segments (no inverse transform, no SBR filterbanks) to count the values
+ * each segment generates. The state at the start of each segment is derived
+ * from these counts, and then each segment is decoded once. With SBR this
+ * decode starts at an SBR header, far enough before the segment that the
+ * envelope and noise floor history have settled. It is checked against the
+ * end of the preceding segment; if the state did not settle (or the SBR
+ * headers are too far apart) the file is decoded sequentially, so the
+ * result always matches a sequential decode.
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ */
+class AACParallelDecoderHelix : public ParallelHelix {
+ public:
+  AACParallelDecoderHelix() {
+    memset(&aacFrameInfo, 0, sizeof(AACFrameInfo));
+    pre_roll_margin = 2;
+  }
+
+  /// Provides the frame info of the first decoded frame
+  AACFrameInfo audioInfo() { return aacFrameInfo; }
+
+  /// Defines the number of frames between the SBR header where the second
+  /// pass of a HE-AAC segment starts and the first frame of the segment
+  /// (default 16)
+  void setSBRSettleFrames(int frameCount) {
+    sbr_settle_frames = frameCount < 1 ? 1 : frameCount;
+  }
+
+ protected:
+  AACFrameInfo aacFrameInfo;
+  static const int adts_header_size = 7;
+  int sbr_settle_frames = 16;
+
+  /// State after a frame of the first (parse only) pass
+  struct FrameState {
+    uint32_t seed_count;   // PNS values generated before the frame
+    unsigned int headers;  // SBR headers received (see AACGetSBRPhase)
+    unsigned int resets;   // SBR header changes
+    int phase[AAC_MAX_NCHANS];
+  };
+  /// Generator states of a segment
+  struct SegmentSBR {
+    std::vector<FrameState> states;  // frames from the from of the first pass
+    bool second_pass = false;      // decode (with output) instead of parse
+    int phase[AAC_MAX_NCHANS];     // SBR phase after the frame from
+    std::vector<short> check;      // pcm of the frame before first
+  };
+  std::vector<SegmentSBR> sbr;
+
+  /// Size of the ADTS frame at data, 0 if the header is not valid
+  static int adtsFrameSize(const uint8_t *data, size_t len) {
+    if (len < adts_header_size) return 0;
+    int layer = (data[1] >> 1) & 0x03;
+    int profile = (data[2] >> 6) & 0x03;
+    int sampleRateIdx = (data[2] >> 2) & 0x0f;
+    int size = ((data[3] & 0x03) << 11) | (data[4] << 3) | (data[5] >> 5);
+    // same checks as UnpackADTSHeader()
+    if (layer != 0 || profile != 1 || sampleRateIdx >= 12) return 0;
+    return size < adts_header_size ? 0 : size;
+  }
+
+  bool indexFrames(const uint8_t *data, size_t len) override {
+    unsigned char *start = (unsigned char *)data;
+    size_t pos = 0;
+    while (pos + 4 < len) {
+      int offset = AACFindSyncWord(start + pos, len - pos);
+      if (offset < 0) break;
+      pos += offset;
+      int size = adtsFrameSize(data + pos, len - pos);
+      if (size == 0) {
+        // no valid frame header: continue searching from the next byte
+        pos++;
+        continue;
+      }
+      // incomplete last frame: ignored like in a sequential decode
+      if (pos + size > len) break;
+      frames.push_back({pos, size});
+      pos += size;
+    }
+    return true;
+  }
+
+  size_t preRollStart(size_t first) override {
+    // the preceding frame primes the overlap, the margin lets the SBR
+    // state settle
+    size_t from = first - 1;
+    return from > (size_t)pre_roll_margin ? from - pre_roll_margin : 0;
+  }
+
+  void startSegments() override {
+    sbr.clear();
+    sbr.resize(segments.size());
+  }
+
+  bool decodeSegment(const uint8_t *data, size_t len, size_t id) override {
+    Segment &segment = segments[id];
+    SegmentSBR &info_sbr = sbr[id];
+    HAACDecoder decoder = AACInitDecoder();
+    if (decoder == nullptr) return false;
+    short out[AAC_MAX_NCHANS * AAC_MAX_NSAMPS * 2];
+    size_t next_from = id + 1 < segments.size() ? segments[id + 1].from : 0;
+    segment.pcm.clear();
+    segment.decoded = 0;
+    segment.errors = 0;
+    info_sbr.check.clear();
+    bool parse = !info_sbr.second_pass;
+    if (parse) info_sbr.states.clear();
+    AACSetParseOnly(decoder, parse);
+    AACSetNoiseState(decoder, segment.seed);
+    bool more = true;
+    for (size_t j = segment.from; j < frames.size() && more; j++) {
+      FrameState state;
+      AACGetNoiseState(decoder, nullptr, &state.seed_count);
+      if (j == next_from) segment.seed_count_next = state.seed_count;
+      unsigned char *ptr = (unsigned char *)data + frames[j].offset;
+      int left = len - frames[j].offset;
+      // an ADTS frame can contain up to 4 raw data blocks
+      int blocks = (ptr[6] & 0x03) + 1;
+      for (int b = 0; b < blocks; b++) {
+        int rc = AACDecode(decoder, &ptr, &left, out);
+        if (rc != ERR_AAC_NONE) {
+          if (!parse && j >= segment.first && j < segment.end)
+            segment.errors++;
+          break;
+        }
+        if (parse) continue;
+        AACFrameInfo info;
+        AACGetLastFrameInfo(decoder, &info);
+        if (j + 1 == segment.first && info_sbr.second_pass)
+          info_sbr.check.insert(info_sbr.check.end(), out,
+                                out + info.outputSamps);
+        if (j < segment.first || j >= segment.end) continue;
+        segment.decoded++;
+        if (id == 0 && segment.pcm.empty()) aacFrameInfo = info;
+        segment.pcm.insert(segment.pcm.end(), out, out + info.outputSamps);
+      }
+      more = j + 1 < segment.end;
+      if (!parse) {
+        // continue with the phases of the sequential decode
+        if (j == segment.from) AACSetSBRPhase(decoder, info_sbr.phase);
+      } else {
+        AACGetSBRPhase(decoder, state.phase, &state.headers, &state.resets);
+        info_sbr.states.push_back(state);
+        // with SBR the first pass continues up to the next header: the SBR
+        // of the next segment has started by then
+        if (state.headers > 0 && !(j >= segment.end && isHeader(id, j)))
+          more = true;
+      }
+    }
+    AACGetNoiseState(decoder, nullptr, &segment.seed_count);
+    AACFreeDecoder(decoder);
+    return true;
+  }
+
+  /// The PNS noise (also in the overlap of the pre-roll) depends on the
+  /// generator state at the start of the segment: it is derived from the
+  /// number of values generated by the preceding segment in the first pass.
+  /// Then all segments are decoded (with SBR see completeSBR())
+  void completeSegments(const uint8_t *data, size_t len) override {
+    for (size_t s = 1; s < segments.size(); s++) {
+      segments[s].seed = advanceNoise(segments[s - 1].seed,
+                                      segments[s - 1].seed_count_next);
+    }
+    for (size_t s = 0; s < segments.size(); s++) {
+      if (sbrStart(s) >= 0) {
+        if (!completeSBR(data, len)) decodeAllSequential(data, len);
+        return;
+      }
+    }
+    std::vector<size_t> ids;
+    for (size_t s = 0; s < segments.size(); s++) {
+      sbr[s].second_pass = true;
+      ids.push_back(s);
+    }
+    decodeSegments(data, len, ids);
+  }
+
+  /// Index (in the states) of the first frame of the first pass after which
+  /// SBR is running, -1 if there is none
+  long sbrStart(size_t id) {
+    std::vector<FrameState> &states = sbr[id].states;
+    for (size_t k = 0; k < states.size(); k++)
+      if (states[k].phase[0] >= 0) return k;
+    return -1;
+  }
+
+  /// Decodes all segments, the ones after the first starting at an SBR header
+  /// with the phases and the PNS generator state of a sequential decode:
+  /// returns false if this is not possible or the result does not match the
+  /// preceding segment (e.g. when SBR only starts in a later segment)
+  bool completeSBR(const uint8_t *data, size_t len) {
+    // phases at the start of SBR in the first pass of each segment: the
+    // first segment starts with the stream, so its phases are the real ones
+    std::vector<std::vector<int>> phases(segments.size());
+    long start = sbrStart(0);
+    if (start < 0) return false;
+    phases[0].assign(sbr[0].states[start].phase,
+                     sbr[0].states[start].phase + AAC_MAX_NCHANS);
+    for (size_t s = 1; s < segments.size(); s++) {
+      start = sbrStart(s);
+      if (start < 0) return false;
+      size_t frame = segments[s].from + start;
+      if (!sequentialPhase(s - 1, frame, phases[s - 1], phases[s]))
+        return false;
+    }
+
+    // second pass: starts at the latest header of the preceding segment
+    // which leaves enough frames to settle, the first segment starts with
+    // the stream
+    std::vector<size_t> ids(1, 0), from(segments.size());
+    std::vector<uint32_t> seed(segments.size());
+    size_t lead = sbr_settle_frames + pre_roll_margin;
+    for (size_t s = 1; s < segments.size(); s++) {
+      Segment &prev = segments[s - 1];
+      if (segments[s].first < prev.from + lead) return false;
+      size_t frame = segments[s].first - lead;
+      while (frame > prev.from && !isHeader(s - 1, frame)) frame--;
+      std::vector<int> phase;
+      if (!isHeader(s - 1, frame) ||
+          !sequentialPhase(s - 1, frame, phases[s - 1], phase))
+        return false;
+      from[s] = frame;
+      seed[s] = advanceNoise(prev.seed,
+                             sbr[s - 1].states[frame - prev.from].seed_count);
+      memcpy(sbr[s].phase, phase.data(), sizeof(sbr[s].phase));
+      ids.push_back(s);
+    }
+    for (int ch = 0; ch < AAC_MAX_NCHANS; ch++) sbr[0].phase[ch] = -1;
+    sbr[0].second_pass = true;
+    for (size_t s = 1; s < segments.size(); s++) {
+      segments[s].from = from[s];
+      segments[s].seed = seed[s];
+      sbr[s].second_pass = true;
+    }
+    decodeSegments(data, len, ids);
+
+    // the pre-roll must have reached the state of the preceding segment
+    for (size_t s = 1; s < segments.size(); s++) {
+      std::vector<short> &check = sbr[s].check;
+      std::vector<short> &prev = segments[s - 1].pcm;
+      if (!segments[s].ok || check.empty() || check.size() > prev.size() ||
+          !std::equal(check.begin(), check.end(), prev.end() - check.size()))
+        return false;
+    }
+    return true;
+  }
+
+  /// True if the frame (within the first pass of the segment) has an SBR
+  /// header
+  bool isHeader(size_t id, size_t frame) {
+    std::vector<FrameState> &states = sbr[id].states;
+    size_t k = frame - segments[id].from;
+    unsigned int before = k == 0 ? 0 : states[k - 1].headers;
+    return states[k].headers > before;
+  }
+
+  /// Phases of a sequential decode after the frame, from the first pass of
+  /// the segment and the sequential phases at the start of its SBR: both
+  /// advance by the same amount, but a header change restarts the noise
+  /// table
+  bool sequentialPhase(size_t id, size_t frame, const std::vector<int> &start,
+                       std::vector<int> &result) {
+    long first = sbrStart(id);
+    size_t k = frame - segments[id].from;
+    if (first < 0 || frame < segments[id].from + first ||
+        k >= sbr[id].states.size())
+      return false;
+    const FrameState &from = sbr[id].states[first];
+    const FrameState &to = sbr[id].states[k];
+    bool reset = to.resets != from.resets;
+    result.resize(AAC_MAX_NCHANS);
+    for (int ch = 0; ch < AAC_MAX_NCHANS; ch++) {
+      int p = to.phase[ch], p0 = from.phase[ch], s = start[ch];
+      if (p < 0 || p0 < 0 || s < 0) {
+        result[ch] = p;
+        continue;
+      }
+      int noise = reset ? p & 511 : ((p & 511) + (s & 511) - (p0 & 511)) & 511;
+      int sine = ((p >> 9) + (s >> 9) - (p0 >> 9)) & 3;
+      result[ch] = noise | (sine << 9);
+    }
+    return true;
+  }
+
+  /// Replaces the segments by a sequential decode
+  void decodeAllSequential(const uint8_t *data, size_t len) {
+    for (auto &segment : segments) {
+      segment.pcm.clear();
+      segment.decoded = 0;
+      segment.errors = 0;
+    }
+    segments[0].ok = decodeSequential(data, len, segments[0].pcm);
+    for (size_t s = 1; s < segments.size(); s++) segments[s].ok = true;
+  }
+
+  /// State of the PNS generator (x' = 1664525 * x + 1013904223) after n steps
+  static uint32_t advanceNoise(uint32_t seed, uint32_t n) {
+    uint32_t mul = 1, add = 0, a = 1664525u, c = 1013904223u;
+    for (; n > 0; n >>= 1) {
+      if (n & 1) {
+        mul *= a;
+        add = add * a + c;
+      }
+      c = c * a + c;
+      a *= a;
+    }
+    return mul * seed + add;
+  }
+
+  bool decodeSequential(const uint8_t *data, size_t len,
+                        std::vector<short> &pcm) override {
+    HAACDecoder decoder = AACInitDecoder();
+    if (decoder == nullptr) return false;
+    short out[AAC_MAX_NCHANS * AAC_MAX_NSAMPS * 2];
+    unsigned char *ptr = (unsigned char *)data;
+    int left = len;
+    while (left > 4) {
+      int offset = AACFindSyncWord(ptr, left);
+      if (offset < 0) break;
+      ptr += offset;
+      left -= offset;
+      int rc = AACDecode(decoder, &ptr, &left, out);
+      if (rc == ERR_AAC_NONE) {
+        AACFrameInfo info;
+        AACGetLastFrameInfo(decoder, &info);
+        if (pcm.empty()) aacFrameInfo = info;
+        pcm.insert(pcm.end(), out, out + info.outputSamps);
+        decoded_frames++;
+      } else if (rc == ERR_AAC_INDATA_UNDERFLOW) {
+        break;
+      } else {
+        decode_errors++;
+        ptr++;
+        left--;
+      }
+    }
+    AACFreeDecoder(decoder);
+    return true;
+  }
+};
+
+}  // namespace libhelix
@@ -59,6 +59,17 @@ class CommonHelix {
     return true;
   }
 
+  /// Prepares the decoder for a new stream (e.g. track change or seek)
+  /// without releasing and reallocating the memory like begin() does:
+  /// buffered data is discarded and only the decoder state is cleared
+  virtual bool reset() {
+    if (!active || !resetDecoder()) return begin();
+    frame_buffer.reset();
+    frame_counter = 0;
+    parse_0_count = 0;
+    return true;
+  }
+
   /// Releases the reserved memory
   virtual void end() {
     frame_buffer.resize(0);
@@ -263,6 +274,10 @@ class CommonHelix {
   /// Allocate the decoder
   virtual bool allocateDecoder() = 0;
 
+  /// Clears the state of the allocated decoder: returns false if this is
+  /// not supported
+  virtual bool resetDecoder() { return false; }
+
   /// Finds the synchronization word in the frame buffer (starting from the
   /// indicated offset)
   virtual int findSynchWord(int offset = 0) = 0;
@@ -19,6 +19,39 @@
 #ifndef MP3_MIN_FRAME_SIZE
 #  define MP3_MIN_FRAME_SIZE 1024
 #endif
+/// size of the mp3 main data buffer (bit reservoir): everything above the
+/// minimum of 1940 bytes lets the reservoir move forward without a memmove.
+/// Microcontrollers keep the minimum (each decoder needs the buffer), desktop
+/// builds use the larger buffer
+#ifndef MP3_MAINBUF_SIZE
+#  if (defined(__linux__) || defined(_WIN32) || defined(__APPLE__)) && \
+      !defined(ARDUINO) && !defined(ESP_PLATFORM) && !defined(__ZEPHYR__)
+#    define MP3_MAINBUF_SIZE (1940 * 4)
+#  else
+#    define MP3_MAINBUF_SIZE 1940
+#  endif
+#endif
+/// use a precomputed pow(x, 4/3) table for |x| < 1024 in the dequantizer
+/// instead of the polynomial approximation (costs about 4 kB of flash)
+#ifndef MP3_USE_LARGE_POW43
+#  define MP3_USE_LARGE_POW43 0
+#endif
+/// mono-only mp3 decoder: stereo streams are always downmixed (see
+/// MP3SetMonoDownmix) and the IMDCT output and synthesis filterbank state
+/// are only allocated for one channel
+#ifndef MP3_MONO_ONLY
+#  define MP3_MONO_ONLY 0
+#endif
+/// alignment in bytes of the decoder structures laid out by MP3InitDecoderPre()
+/// (use the data cache line size, must be a power of 2)
+#ifndef MP3_PRE_ALIGN
+#  define MP3_PRE_ALIGN 64
+#endif
+/// StreamAnalyzerHelix: free format frames with a higher bitrate (in bits per
+/// second) are treated as sync words found by chance
+#ifndef MP3_MAX_FREE_BITRATE
+#  define MP3_MAX_FREE_BITRATE 640000
+#endif
 
 // aac
 #ifndef AAC_MAX_OUTPUT_SIZE
@@ -30,6 +63,21 @@
 #ifndef AAC_MIN_FRAME_SIZE
 #  define AAC_MIN_FRAME_SIZE 1024
 #endif
+/// allocate the aac SBR state (about 50 kB) only when the first SBR fill
+/// element is found and release it on AACFlushCodec(): plain AAC-LC streams
+/// never need it (AACInitDecoderPre() always reserves it)
+#ifndef AAC_SBR_LAZY_ALLOC
+#  define AAC_SBR_LAZY_ALLOC 1
+#endif
+/// decode the aac Huffman codes with direct lookup tables instead of the
+/// canonical code search (costs about 16 kB of flash)
+#ifndef AAC_USE_HUFF_LOOKUP
+#  ifdef ESP8266
+#    define AAC_USE_HUFF_LOOKUP 0
+#  else
+#    define AAC_USE_HUFF_LOOKUP 1
+#  endif
+#endif
 
 // Allocation: define allocator to be used
 #define ALLOCATOR libhelix::AllocatorExt
@@ -10,6 +10,10 @@ namespace libhelix {
 typedef void (*MP3InfoCallback)(MP3FrameInfo &info, void *ref);
 typedef void (*MP3DataCallback)(MP3FrameInfo &info, short *pcm_buffer,
                                 size_t len, void *ref);
+typedef void (*MP3DataCallbackInt32)(MP3FrameInfo &info, int32_t *pcm_buffer,
+                                     size_t len, void *ref);
+typedef void (*MP3DataCallbackFloat)(MP3FrameInfo &info, float *pcm_buffer,
+                                     size_t len, void *ref);
 
 enum MP3Type { MP3Normal = 0, MP3SelfContaind = 1 };
 
@@ -57,11 +61,91 @@ class MP3DecoderHelix : public CommonHelix {
       p_caller_ref = caller;
   }
 
-  void setDataCallback(MP3DataCallback cb) { this->pcmCallback = cb; }
+  void setDataCallback(MP3DataCallback cb) {
+    this->pcmCallback = cb;
+    setOutputFormat(MP3_OUTPUT_INT16);
+  }
+
+  /// Provides the PCM data as int32 with MP3_PCM32_FRACBITS fraction bits
+  /// (i.e. 16 bit << 12, with 4 bits headroom)
+  void setDataCallback(MP3DataCallbackInt32 cb) {
+    this->pcmCallbackInt32 = cb;
+    setOutputFormat(MP3_OUTPUT_INT32);
+  }
+
+  /// Provides the PCM data as float (1.0 = full scale)
+  void setDataCallback(MP3DataCallbackFloat cb) {
+    this->pcmCallbackFloat = cb;
+    setOutputFormat(MP3_OUTPUT_FLOAT32);
+  }
+
+  /// Removes the data callback (setDataCallback(nullptr) would otherwise be
+  /// ambiguous between the overloads above)
+  void setDataCallback(decltype(nullptr)) {
+    this->pcmCallback = nullptr;
+    this->pcmCallbackInt32 = nullptr;
+    this->pcmCallbackFloat = nullptr;
+  }
+
+  /// Defines the sample format which is written by the decoder (also used
+  /// for the output stream)
+  void setOutputFormat(MP3OutputFormat format) {
+    this->output_format = format;
+    if (decoder != nullptr) {
+      MP3SetOutputFormat(decoder, format);
+    }
+    if (active) {
+      pcm_buffer.resize(maxPCMSize());
+    }
+  }
 
   /// Provides the last available MP3FrameInfo
   MP3FrameInfo audioInfo() { return mp3FrameInfo; }
 
+  /// Limits the decoded bandwidth to the lowest subbands (32 = full
+  /// bandwidth, each subband covers samprate/64 Hz) and optionally outputs
+  /// at 1/2 or 1/4 of the sample rate (downsample = 1, 2 or 4)
+  bool setReducedBandwidth(int subbands, int downsample = 1) {
+    if (subbands < 1 || subbands > 32) return false;
+    if (downsample != 1 && downsample != 2 && downsample != 4) return false;
+    this->sb_limit = subbands;
+    this->downsample = downsample;
+    if (decoder != nullptr) {
+      return MP3SetReducedBandwidth(decoder, sb_limit, downsample) == 0;
+    }
+    return true;
+  }
+
+  /// Decodes stereo streams to mono: the channels are combined before the
+  /// synthesis filterbank, which is cheaper than averaging the PCM output.
+  /// Always active (and cannot be disabled) if MP3_MONO_ONLY is defined.
+  bool setMonoDownmix(bool active) {
+    if (MP3_MONO_ONLY && !active) return false;
+    this->mono_downmix = active;
+    if (decoder != nullptr) {
+      return MP3SetMonoDownmix(decoder, active) == 0;
+    }
+    return true;
+  }
+
+  /// Provides the PCM data via the callback or output stream per granule
+  /// (576 samples per channel for MPEG1) as soon as it is decoded, instead
+  /// of once per frame: this halves the output latency
+  void setGranuleOutput(bool active) {
+    this->granule_output = active;
+    if (decoder != nullptr) {
+      MP3SetGranuleCallback(decoder, active ? granuleCallback : nullptr, this);
+    }
+  }
+
+  /// Places the decoder state in the indicated memory instead of the heap
+  /// (MP3_DECODER_PRE_SIZE bytes are always sufficient). The memory is owned
+  /// by the caller and must stay valid until end(); call before begin().
+  void setDecoderMemory(void *memory, int size) {
+    this->decoder_memory = memory;
+    this->decoder_memory_size = size;
+  }
+
   /// Releases the reserved memory
   void end() override {
     LOGD_HELIX( "end");
@@ -82,24 +166,50 @@ class MP3DecoderHelix : public CommonHelix {
 
   /// Determines the pcm buffer size that will be allocated
   size_t maxPCMSize() override {
-    return max_pcm_size == 0 ? MP3_MAX_OUTPUT_SIZE : max_pcm_size;
+    if (max_pcm_size != 0) return max_pcm_size;
+    // 32 bit formats need twice the space
+    return output_format == MP3_OUTPUT_INT16 ? MP3_MAX_OUTPUT_SIZE
+                                             : 2 * MP3_MAX_OUTPUT_SIZE;
   }
 
  protected:
   HMP3Decoder decoder = nullptr;
   MP3DataCallback pcmCallback = nullptr;
+  MP3DataCallbackInt32 pcmCallbackInt32 = nullptr;
+  MP3DataCallbackFloat pcmCallbackFloat = nullptr;
   MP3InfoCallback infoCallback = nullptr;
   MP3Type mp3_type;
   MP3FrameInfo mp3FrameInfo;
   void *p_caller_data = nullptr;
+  int sb_limit = 32;
+  int downsample = 1;
+  bool mono_downmix = MP3_MONO_ONLY;
+  bool granule_output = false;
+  MP3OutputFormat output_format = MP3_OUTPUT_INT16;
+  void *decoder_memory = nullptr;
+  int decoder_memory_size = 0;
 
   /// Allocate the decoder
   virtual bool allocateDecoder() override {
     if (decoder == nullptr) {
-      decoder = MP3InitDecoder();
+      decoder = decoder_memory != nullptr
+                    ? MP3InitDecoderPre(decoder_memory, decoder_memory_size)
+                    : MP3InitDecoder();
     }
     memset(&mp3FrameInfo, 0, sizeof(MP3FrameInfo));
-    return decoder != nullptr;
+    if (decoder == nullptr) return false;
+    MP3SetReducedBandwidth(decoder, sb_limit, downsample);
+    MP3SetMonoDownmix(decoder, mono_downmix);
+    MP3SetGranuleCallback(decoder, granule_output ? granuleCallback : nullptr, this);
+    MP3SetOutputFormat(decoder, output_format);
+    return true;
+  }
+
+  /// Clears the decoder state, the settings stay in effect
+  bool resetDecoder() override {
+    if (decoder == nullptr) return false;
+    memset(&mp3FrameInfo, 0, sizeof(MP3FrameInfo));
+    return MP3ResetDecoder(decoder) == 0;
   }
 
   /// Finds the synch word in the available buffer data starting from the
@@ -127,7 +237,12 @@ class MP3DecoderHelix : public CommonHelix {
       // return the decoded result
       MP3FrameInfo info;
       MP3GetLastFrameInfo(decoder, &info);
-      provideResult(info);
+      if (granule_output) {
+        // already provided by granuleCallback()
+        mp3FrameInfo = info;
+      } else {
+        provideResult(info, pcm_buffer.data());
+      }
       rc = processed;
     } else {
       LOGI_HELIX( "MP3Decode rc: %d", rc);
@@ -135,18 +250,30 @@ class MP3DecoderHelix : public CommonHelix {
     return rc;
   }
 
+  /// called by the decoder for each granule if setGranuleOutput() is active
+  static void granuleCallback(short *pcm, int nSamps, void *ref) {
+    MP3DecoderHelix *self = (MP3DecoderHelix *)ref;
+    MP3FrameInfo info;
+    MP3GetLastFrameInfo(self->decoder, &info);
+    info.outputSamps = nSamps;
+    self->provideResult(info, pcm);
+  }
+
   // return the resulting PCM data
-  void provideResult(MP3FrameInfo &info) {
+  void provideResult(MP3FrameInfo &info, void *pcm) {
     // increase PCM size if this fails
-    assert(info.outputSamps * sizeof(short) < maxPCMSize());
+    assert(info.outputSamps * (info.bitsPerSample / 8) < maxPCMSize());
 
     LOGD_HELIX( "=> provideResult: %d", info.outputSamps);
     if (info.outputSamps > 0) {
       // provide result
-      if (pcmCallback != nullptr) {
+      if (output_format == MP3_OUTPUT_INT16 && pcmCallback != nullptr) {
         // output via callback
-        pcmCallback(info, (short *)pcm_buffer.data(), info.outputSamps,
-                    p_caller_data);
+        pcmCallback(info, (short *)pcm, info.outputSamps, p_caller_data);
+      } else if (output_format == MP3_OUTPUT_INT32 && pcmCallbackInt32 != nullptr) {
+        pcmCallbackInt32(info, (int32_t *)pcm, info.outputSamps, p_caller_data);
+      } else if (output_format == MP3_OUTPUT_FLOAT32 && pcmCallbackFloat != nullptr) {
+        pcmCallbackFloat(info, (float *)pcm, info.outputSamps, p_caller_data);
       } else {
         // output to stream
         if (infoCallback != nullptr
@@ -157,7 +284,7 @@ class MP3DecoderHelix : public CommonHelix {
         if (out != nullptr){
           int sampleSize = info.bitsPerSample / 8;
           int toWrite = info.outputSamps * sampleSize;
-          writeToOut((uint8_t *)pcm_buffer.data(), toWrite);
+          writeToOut((uint8_t *)pcm, toWrite);
         }
 #endif
       }
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <string.h>
+
+#include "ParallelHelix.h"
+#include "libhelix-mp3/mp3dec.h"
+
+namespace libhelix {
+
+/**
+ * @brief Decodes a complete MP3 file which is held in memory on multiple
+ * threads. The file is split at frame boundaries. A segment starts decoding
+ * early enough that the bit reservoir holds the main data of the frames which
+ * precede the segment (main_data_begin can point up to 511 bytes back) and
+ * that the IMDCT overlap and polyphase filter state have been filled by the
+ * preceding frame.
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ */
+class MP3ParallelDecoderHelix : public ParallelHelix {
+ public:
+  MP3ParallelDecoderHelix() { memset(&mp3FrameInfo, 0, sizeof(MP3FrameInfo)); }
+
+  /// Provides the frame info of the first decoded frame
+  MP3FrameInfo audioInfo() { return mp3FrameInfo; }
+
+ protected:
+  MP3FrameInfo mp3FrameInfo;
+  // header + crc + max side info (MPEG1 stereo)
+  static const int max_frame_overhead = 4 + 2 + 32;
+  // largest main_data_begin (9 bits)
+  static const int max_reservoir_bytes = 511;
+
+  bool indexFrames(const uint8_t *data, size_t len) override {
+    HMP3Decoder decoder = MP3InitDecoder();
+    if (decoder == nullptr) return false;
+    unsigned char *start = (unsigned char *)data;
+    size_t pos = 0;
+    bool rc = true;
+    while (pos + 4 < len) {
+      int offset = MP3FindSyncWord(start + pos, len - pos);
+      if (offset < 0) break;
+      pos += offset;
+      int size = MP3GetNextFrameSize(decoder, start + pos);
+      if (size == ERR_MP3_FREE_BITRATE_SYNC) {
+        rc = false;
+        break;
+      }
+      if (size < 0) {
+        // no valid frame header: continue searching from the next byte
+        pos++;
+        continue;
+      }
+      // incomplete last frame: ignored like in a sequential decode
+      if (pos + size > len) break;
+      frames.push_back({pos, size});
+      pos += size;
+    }
+    MP3FreeDecoder(decoder);
+    return rc;
+  }
+
+  size_t preRollStart(size_t first) override {
+    // the preceding frame primes the overlap, the frames before it must
+    // provide its bit reservoir
+    size_t from = first - 1;
+    int reservoir = 0;
+    while (from > 0 && reservoir < max_reservoir_bytes) {
+      from--;
+      reservoir += frames[from].size - max_frame_overhead;
+    }
+    return from > (size_t)pre_roll_margin ? from - pre_roll_margin : 0;
+  }
+
+  bool decodeSegment(const uint8_t *data, size_t len, size_t id) override {
+    Segment &segment = segments[id];
+    HMP3Decoder decoder = MP3InitDecoder();
+    if (decoder == nullptr) return false;
+    short out[MAX_NCHAN * MAX_NGRAN * MAX_NSAMP];
+    segment.pcm.clear();
+    segment.decoded = 0;
+    segment.errors = 0;
+    for (size_t j = segment.from; j < segment.end; j++) {
+      unsigned char *ptr = (unsigned char *)data + frames[j].offset;
+      int left = len - frames[j].offset;
+      int rc = MP3Decode(decoder, &ptr, &left, out, 0);
+      if (j < segment.first) continue;
+      if (rc != ERR_MP3_NONE) {
+        // missing bit reservoir at the start of the stream is not an error
+        if (rc != ERR_MP3_MAINDATA_UNDERFLOW) segment.errors++;
+        continue;
+      }
+      segment.decoded++;
+      MP3FrameInfo info;
+      MP3GetLastFrameInfo(decoder, &info);
+      if (id == 0 && segment.pcm.empty()) mp3FrameInfo = info;
+      segment.pcm.insert(segment.pcm.end(), out, out + info.outputSamps);
+    }
+    MP3FreeDecoder(decoder);
+    return true;
+  }
+
+  bool decodeSequential(const uint8_t *data, size_t len,
+                        std::vector<short> &pcm) override {
+    HMP3Decoder decoder = MP3InitDecoder();
+    if (decoder == nullptr) return false;
+    short out[MAX_NCHAN * MAX_NGRAN * MAX_NSAMP];
+    unsigned char *ptr = (unsigned char *)data;
+    int left = len;
+    while (left > 4) {
+      int offset = MP3FindSyncWord(ptr, left);
+      if (offset < 0) break;
+      ptr += offset;
+      left -= offset;
+      int rc = MP3Decode(decoder, &ptr, &left, out, 0);
+      if (rc == ERR_MP3_NONE) {
+        MP3FrameInfo info;
+        MP3GetLastFrameInfo(decoder, &info);
+        if (pcm.empty()) mp3FrameInfo = info;
+        pcm.insert(pcm.end(), out, out + info.outputSamps);
+        decoded_frames++;
+      } else if (rc == ERR_MP3_INDATA_UNDERFLOW) {
+        break;
+      } else if (rc != ERR_MP3_MAINDATA_UNDERFLOW) {
+        decode_errors++;
+        ptr++;
+        left--;
+      }
+    }
+    MP3FreeDecoder(decoder);
+    return true;
+  }
+};
+
+}  // namespace libhelix
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <thread>
+#include <vector>
+
+namespace libhelix {
+
+/**
+ * @brief Common logic to decode a complete file which is held in memory on
+ * multiple threads: the frames are indexed and split into one segment per
+ * thread. Each segment is decoded by its own decoder instance which starts
+ * a few frames early (pre-roll) so that the decoder state (bit reservoir,
+ * overlap buffers, filterbank delay lines) is settled when the first frame
+ * of the segment is reached. The pre-roll output is discarded and the
+ * segments are joined in order, so the result matches a sequential decode.
+ * This needs std::thread and is intended for desktop (offline) use.
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ */
+class ParallelHelix {
+ public:
+  virtual ~ParallelHelix() = default;
+
+  /// Decodes the data into pcm (interleaved 16 bit samples) using up to the
+  /// indicated number of threads
+  bool decode(const uint8_t *data, size_t len, int threads,
+              std::vector<short> &pcm) {
+    pcm.clear();
+    frames.clear();
+    decoded_frames = 0;
+    decode_errors = 0;
+    if (data == nullptr || len == 0) return false;
+    if (!indexFrames(data, len) || frames.empty()) {
+      // stream can not be split: decode it in one piece
+      return decodeSequential(data, len, pcm);
+    }
+
+    size_t count = threads < 1 ? 1 : threads;
+    size_t max_count = frames.size() / min_segment_frames;
+    if (count > max_count) count = max_count;
+    if (count < 1) count = 1;
+
+    segments.clear();
+    segments.resize(count);
+    std::vector<size_t> ids;
+    for (size_t s = 0; s < count; s++) {
+      Segment &segment = segments[s];
+      segment.first = frames.size() * s / count;
+      segment.end = frames.size() * (s + 1) / count;
+      segment.from = segment.first == 0 ? 0 : preRollStart(segment.first);
+      ids.push_back(s);
+    }
+    startSegments();
+    decodeSegments(data, len, ids);
+    completeSegments(data, len);
+
+    size_t total = 0;
+    for (auto &segment : segments) total += segment.pcm.size();
+    pcm.reserve(total);
+    bool rc = true;
+    for (auto &segment : segments) {
+      rc = rc && segment.ok;
+      decoded_frames += segment.decoded;
+      decode_errors += segment.errors;
+      pcm.insert(pcm.end(), segment.pcm.begin(), segment.pcm.end());
+    }
+    segments.clear();
+    return rc;
+  }
+
+  /// Defines the number of additional frames which are decoded before the
+  /// minimum pre-roll of each segment (default 1)
+  void setPreRollMargin(int frameCount) {
+    pre_roll_margin = frameCount < 0 ? 0 : frameCount;
+  }
+
+  /// Segments are not made shorter than the indicated number of frames
+  void setMinSegmentFrames(int frameCount) {
+    min_segment_frames = frameCount < 1 ? 1 : frameCount;
+  }
+
+  /// Number of frames which were found by the last decode()
+  size_t frameCount() { return frames.size(); }
+
+  /// Number of frames (AAC: raw data blocks) which were decoded successfully
+  /// by the last decode()
+  size_t decodedFrames() { return decoded_frames; }
+
+  /// Number of decoding errors of the last decode() (errors in the pre-roll
+  /// are not counted)
+  size_t errorCount() { return decode_errors; }
+
+ protected:
+  /// Position of a frame in the data
+  struct FrameIndex {
+    size_t offset;
+    int size;
+  };
+  std::vector<FrameIndex> frames;
+  /// Range of frames which is decoded by one thread
+  struct Segment {
+    size_t from;   // first frame to decode (start of the pre-roll)
+    size_t first;  // first frame with output
+    size_t end;    // end of the output frames (exclusive)
+    std::vector<short> pcm;
+    bool ok = false;
+    size_t decoded = 0;  // output frames
+    size_t errors = 0;
+    // random generator state at from, which depends on all preceding frames,
+    // and the number of values generated until the from of the next segment
+    // and until end
+    uint32_t seed = 0;
+    uint32_t seed_count_next = 0;
+    uint32_t seed_count = 0;
+  };
+  std::vector<Segment> segments;
+  int pre_roll_margin = 1;
+  int min_segment_frames = 64;
+  // results of decodeSequential(): the segment results are added up
+  size_t decoded_frames = 0;
+  size_t decode_errors = 0;
+
+  /// Fills frames: returns false if the stream can not be split
+  virtual bool indexFrames(const uint8_t *data, size_t len) = 0;
+  /// Determines the frame where decoding must start, so that the output of
+  /// the frame with the index first is identical to a sequential decode
+  virtual size_t preRollStart(size_t first) = 0;
+  /// Decodes the frames [from, end) of the indicated segment and provides
+  /// the output of [first, end) in its pcm
+  virtual bool decodeSegment(const uint8_t *data, size_t len, size_t id) = 0;
+  /// Called when the segments have been defined, before they are decoded
+  virtual void startSegments() {}
+  /// Called when all segments have been decoded: segments with a result which
+  /// depends on the preceding segments can be decoded again
+  virtual void completeSegments(const uint8_t * /*data*/, size_t /*len*/) {}
+  /// Decodes the complete data on the calling thread
+  virtual bool decodeSequential(const uint8_t *data, size_t len,
+                                std::vector<short> &pcm) = 0;
+
+  /// Decodes the indicated segments, each on its own thread
+  void decodeSegments(const uint8_t *data, size_t len,
+                      const std::vector<size_t> &ids) {
+    std::vector<std::thread> pool;
+    for (size_t id : ids) {
+      pool.emplace_back([this, data, len, id]() {
+        segments[id].ok = decodeSegment(data, len, id);
+      });
+    }
+    for (auto &t : pool) t.join();
+  }
+};
+
+}  // namespace libhelix
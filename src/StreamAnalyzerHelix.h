@@ -0,0 +1,248 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ConfigHelix.h"
+#include "libhelix-aac/aacdec.h"
+#include "libhelix-mp3/mp3dec.h"
+
+namespace libhelix {
+
+enum StreamFormatHelix { FormatUnknown = 0, FormatMP3 = 1, FormatADTS = 2 };
+
+/// MP3 channel mode as in the frame header, for ADTS the channel configuration
+/// is reported instead
+enum MP3ChannelMode { MP3Stereo = 0, MP3JointStereo = 1, MP3DualChannel = 2, MP3Mono = 3 };
+
+/// Result of the analysis of a complete stream
+struct StreamAnalysisHelix {
+  StreamFormatHelix format = FormatUnknown;
+  long frames = 0;
+  long samples = 0;  // per channel
+  double duration = 0;  // seconds
+  int bitrate_min = 0;  // bits per second
+  int bitrate_max = 0;
+  int bitrate_avg = 0;
+  bool vbr = false;
+  int sample_rate = 0;  // of the first frame
+  int sample_rate_changes = 0;
+  int channels = 0;  // of the first frame, 0 if unknown (ADTS with PCE)
+  int channel_changes = 0;
+  int channel_mode = 0;  // MP3ChannelMode or ADTS channel configuration
+  long gaps = 0;  // number of places where data had to be skipped
+  long gap_bytes = 0;
+  long tag_bytes = 0;  // ID3v2 and ID3v1 tags
+  bool truncated = false;  // last frame is incomplete
+  size_t data_bytes = 0;  // bytes in frames
+};
+
+/**
+ * @brief Determines the duration, the bitrates and the format changes of a
+ * complete MP3 or AAC (ADTS) stream from the frame headers only: the payload
+ * is skipped with the help of the frame length, so this is much faster than
+ * decoding. Unexpected data between the frames is reported as gap.
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ */
+class StreamAnalyzerHelix {
+ public:
+  ~StreamAnalyzerHelix() {
+    if (mp3 != nullptr) MP3FreeDecoder(mp3);
+  }
+
+  /// Analyzes an MP3 stream
+  bool analyzeMP3(const uint8_t *data, size_t len, StreamAnalysisHelix &result) {
+    result = StreamAnalysisHelix();
+    result.format = FormatMP3;
+    if (mp3 == nullptr) mp3 = MP3InitDecoder();
+    if (mp3 == nullptr || data == nullptr) return false;
+    unsigned char *start = (unsigned char *)data;
+    size_t end = len;
+    size_t pos = skipTags(data, end, result);
+    size_t expected = pos;
+    bool free_format = false;
+    while (pos + 4 < end) {
+      int offset = MP3FindSyncWord(start + pos, end - pos);
+      if (offset < 0) break;
+      pos += offset;
+      bool chained = pos == expected;
+      bool free_bitrate = ((start[pos + 2] >> 4) & 0x0f) == 0;
+      int size = MP3GetNextFrameSize(mp3, start + pos);
+      if (size == ERR_MP3_FREE_BITRATE_SYNC) {
+        size = freeFrameSize(start + pos, end - pos);
+        // last frame of a free bitrate stream
+        if (size == 0 && free_format) size = end - pos;
+      }
+      if (size <= 0) {
+        pos++;
+        continue;
+      }
+      if (pos + size > end) {
+        result.truncated = true;
+        break;
+      }
+      MP3FrameInfo info;
+      MP3GetLastFrameInfo(mp3, &info);
+      int samples = info.outputSamps / info.nChans;
+      int mode = start[pos + 3] >> 6;
+      // the header does not define the bitrate in free format
+      int bitrate = info.bitrate;
+      if (free_bitrate) bitrate = (int)((int64_t)size * 8 * info.samprate / samples);
+      if ((free_bitrate && bitrate > MP3_MAX_FREE_BITRATE) ||
+          (!chained && !isFollowedByFrame(start, pos + size, end, MP3FindSyncWord))) {
+        pos++;
+        continue;
+      }
+      free_format = free_bitrate;
+      addGap(pos, expected, result);
+      addFrame(size, samples, info.samprate, bitrate, mode == MP3Mono ? 1 : 2, mode, result);
+      pos += size;
+      expected = pos;
+    }
+    addGap(end, expected, result);
+    if (!finish(result)) return false;
+    result.vbr = result.bitrate_min != result.bitrate_max;
+    return true;
+  }
+
+  /// Analyzes an AAC stream with ADTS headers
+  bool analyzeAAC(const uint8_t *data, size_t len, StreamAnalysisHelix &result) {
+    static const int sample_rates[12] = {96000, 88200, 64000, 48000,
+                                         44100, 32000, 24000, 22050,
+                                         16000, 12000, 11025, 8000};
+    // configuration 0: defined by a program config element, reported as 0
+    static const int channel_count[8] = {0, 1, 2, 3, 4, 5, 6, 8};
+    result = StreamAnalysisHelix();
+    result.format = FormatADTS;
+    if (data == nullptr) return false;
+    unsigned char *start = (unsigned char *)data;
+    size_t end = len;
+    size_t pos = skipTags(data, end, result);
+    size_t expected = pos;
+    while (pos + 4 < end) {
+      int offset = AACFindSyncWord(start + pos, end - pos);
+      if (offset < 0) break;
+      pos += offset;
+      const uint8_t *hdr = data + pos;
+      if (end - pos < 7) break;
+      // same checks as UnpackADTSHeader()
+      int layer = (hdr[1] >> 1) & 0x03;
+      int profile = (hdr[2] >> 6) & 0x03;
+      int rate_idx = (hdr[2] >> 2) & 0x0f;
+      int config = ((hdr[2] & 0x01) << 2) | (hdr[3] >> 6);
+      int size = ((hdr[3] & 0x03) << 11) | (hdr[4] << 3) | (hdr[5] >> 5);
+      int fullness = ((hdr[5] & 0x1f) << 6) | (hdr[6] >> 2);
+      int blocks = (hdr[6] & 0x03) + 1;
+      if (layer != 0 || profile != AAC_PROFILE_LC || rate_idx >= 12 || size < 7) {
+        pos++;
+        continue;
+      }
+      if (pos + size > end) {
+        result.truncated = true;
+        break;
+      }
+      if (pos != expected && !isFollowedByFrame(start, pos + size, end, AACFindSyncWord)) {
+        pos++;
+        continue;
+      }
+      int rate = sample_rates[rate_idx];
+      int samples = AAC_MAX_NSAMPS * blocks;
+      int bitrate = (int)((int64_t)size * 8 * rate / samples);
+      addGap(pos, expected, result);
+      // the frame size always varies: VBR is signaled by the buffer fullness
+      if (fullness == 0x7ff) result.vbr = true;
+      addFrame(size, samples, rate, bitrate, channel_count[config], config, result);
+      pos += size;
+      expected = pos;
+    }
+    addGap(end, expected, result);
+    return finish(result);
+  }
+
+ protected:
+  HMP3Decoder mp3 = nullptr;
+  int64_t bits_total = 0;
+  int last_rate = 0;
+  int last_channels = 0;
+
+  /// Skips an ID3v2 tag at the start and excludes an ID3v1 tag at the end
+  static size_t skipTags(const uint8_t *data, size_t &end, StreamAnalysisHelix &result) {
+    size_t pos = 0;
+    if (end >= 10 && memcmp(data, "ID3", 3) == 0) {
+      size_t size = ((data[6] & 0x7f) << 21) | ((data[7] & 0x7f) << 14) |
+                    ((data[8] & 0x7f) << 7) | (data[9] & 0x7f);
+      pos = 10 + size + ((data[5] & 0x10) ? 10 : 0);  // footer
+      if (pos > end) pos = end;
+    }
+    result.tag_bytes = pos;
+    if (end - pos >= 128 && memcmp(data + end - 128, "TAG", 3) == 0) {
+      end -= 128;
+      result.tag_bytes += 128;
+    }
+    return pos;
+  }
+
+  /// A frame found after a gap must be followed by the next one, unless it is
+  /// the last: this rejects sync words which are found by chance in other data.
+  /// A frame which directly follows the previous one is accepted on its own,
+  /// so data after it is reported as gap and the frame is not lost.
+  static bool isFollowedByFrame(unsigned char *start, size_t next, size_t end,
+                                int (*findSyncWord)(unsigned char *, int)) {
+    if (next + 2 > end) return true;
+    if (findSyncWord(start + next, 2) == 0) return true;
+    return findSyncWord(start + next, end - next) < 0;
+  }
+
+  /// Free bitrate: the frame ends at the next sync word with the same header,
+  /// 0 if there is none
+  static int freeFrameSize(unsigned char *frame, size_t len) {
+    for (size_t pos = 4; pos + 4 <= len; pos++) {
+      int offset = MP3FindSyncWord(frame + pos, len - pos);
+      if (offset < 0) break;
+      pos += offset;
+      // version, layer, sample rate and bitrate index must match
+      if (frame[pos + 1] == frame[1] && (frame[pos + 2] & 0xfc) == (frame[2] & 0xfc))
+        return pos;
+    }
+    return 0;
+  }
+
+  static void addGap(size_t pos, size_t expected, StreamAnalysisHelix &result) {
+    if (pos <= expected) return;
+    result.gaps++;
+    result.gap_bytes += pos - expected;
+  }
+
+  void addFrame(int size, int samples, int rate, int bitrate, int channels,
+                int mode, StreamAnalysisHelix &result) {
+    if (result.frames == 0) {
+      bits_total = 0;
+      result.sample_rate = rate;
+      result.channels = channels;
+      result.channel_mode = mode;
+      result.bitrate_min = bitrate;
+      result.bitrate_max = bitrate;
+    } else {
+      if (rate != last_rate) result.sample_rate_changes++;
+      if (channels != last_channels) result.channel_changes++;
+    }
+    last_rate = rate;
+    last_channels = channels;
+    if (bitrate < result.bitrate_min) result.bitrate_min = bitrate;
+    if (bitrate > result.bitrate_max) result.bitrate_max = bitrate;
+    result.frames++;
+    result.samples += samples;
+    result.duration += (double)samples / rate;
+    result.data_bytes += size;
+    bits_total += (int64_t)size * 8;
+  }
+
+  bool finish(StreamAnalysisHelix &result) {
+    if (result.frames == 0) return false;
+    if (result.duration > 0) result.bitrate_avg = (int)(bits_total / result.duration);
+    return true;
+  }
+};
+
+}  // namespace libhelix
@@ -134,11 +134,16 @@ typedef struct _AACDecInfo {
 	/* pointers to platform-specific state information */
 	void *psInfoBase;	/* baseline MPEG-4 LC decoding */
 	void *psInfoSBR;	/* MPEG-4 SBR decoding */
+	int sbrLazy;		/* psInfoSBR is allocated when needed and released on flush */
+	int sbrDownsampled;	/* SBR output at the core sample rate (AACSetDownsampledSBR) */
+	int sbrLowPower;	/* real-valued SBR (AACSetLowPowerSBR) */
+	int parseOnly;		/* only parse the stream and keep the generator states (AACSetParseOnly) */
 	
 	/* raw decoded data, before rounding to 16-bit PCM (for postprocessing such as SBR) */
 	void *rawSampleBuf[AAC_MAX_NCHANS];
 	int rawSampleBytes;
 	int rawSampleFBits;
+	int sbrNext;		/* an SBR fill element follows the current element, so IMDCT keeps 32-bit PCM */
 
 	/* fill data (can be used for processing SBR or other extensions) */
 	unsigned char *fillBuf;
@@ -177,14 +182,19 @@ int UnpackADIFHeader(AACDecInfo *aacDecInfo, unsigned char **buf, int *bitOffset
 int SetRawBlockParams(AACDecInfo *aacDecInfo, int copyLast, int nChans, int sampRate, int profile);
 int PrepareRawBlock(AACDecInfo *aacDecInfo);
 int FlushCodec(AACDecInfo *aacDecInfo);
+int ResetCodec(AACDecInfo *aacDecInfo);
 
 int DecodeNextElement(AACDecInfo *aacDecInfo, unsigned char **buf, int *bitOffset, int *bitsAvail);
+int SBRFillElementNext(unsigned char *buf, int bitOffset, int bitsAvail);
 int DecodeNoiselessData(AACDecInfo *aacDecInfo, unsigned char **buf, int *bitOffset, int *bitsAvail, int ch);
 
 int Dequantize(AACDecInfo *aacDecInfo, int ch);
 int StereoProcess(AACDecInfo *aacDecInfo);
+int DequantStereoProcess(AACDecInfo *aacDecInfo);
 int DeinterleaveShortBlocks(AACDecInfo *aacDecInfo, int ch);
 int PNS(AACDecInfo *aacDecInfo, int ch);
+int GetNoiseState(AACDecInfo *aacDecInfo, unsigned int *seed, unsigned int *count);
+int SetNoiseState(AACDecInfo *aacDecInfo, unsigned int seed);
 int TNSFilter(AACDecInfo *aacDecInfo, int ch);
 int IMDCT(AACDecInfo *aacDecInfo, int ch, int chBase, short *outbuf);
 
@@ -195,6 +205,8 @@ void FreeSBR(AACDecInfo *aacDecInfo);
 int DecodeSBRBitstream(AACDecInfo *aacDecInfo, int chBase);
 int DecodeSBRData(AACDecInfo *aacDecInfo, int chBase, short *outbuf);
 int FlushCodecSBR(AACDecInfo *aacDecInfo);
+int GetSBRPhase(AACDecInfo *aacDecInfo, int *phase, unsigned int *headers, unsigned int *resets);
+int SetSBRPhase(AACDecInfo *aacDecInfo, const int *phase);
 
 /* aactabs.c - global ROM tables */
 extern const int sampRateTab[NUM_SAMPLE_RATES];
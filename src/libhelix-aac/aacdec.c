@@ -55,7 +55,8 @@
  *
  * Description: allocate memory for platform-specific data
  *              clear all the user-accessible fields
- *              initialize SBR decoder if enabled
+ *              initialize SBR decoder if enabled (deferred to the first SBR fill
+ *                element with AAC_SBR_LAZY_ALLOC)
  *
  * Inputs:      none
  *
@@ -72,10 +73,15 @@ HAACDecoder AACInitDecoder(void)
 		return 0;
 
 #ifdef AAC_ENABLE_SBR
+#if AAC_SBR_LAZY_ALLOC
+	/* SBR state is allocated by AACDecode() when the first SBR fill element is found */
+	aacDecInfo->sbrLazy = 1;
+#else
 	if (InitSBR(aacDecInfo)) {
 		AACFreeDecoder(aacDecInfo);
 		return 0;
 	}
+#endif
 #endif
 
 	return (HAACDecoder)aacDecInfo;
@@ -182,9 +188,9 @@ void AACGetLastFrameInfo(HAACDecoder hAACDecoder, AACFrameInfo *aacFrameInfo)
 		aacFrameInfo->bitRate =       aacDecInfo->bitRate;
 		aacFrameInfo->nChans =        aacDecInfo->nChans;
 		aacFrameInfo->sampRateCore =  aacDecInfo->sampRate;
-		aacFrameInfo->sampRateOut =   aacDecInfo->sampRate * (aacDecInfo->sbrEnabled ? 2 : 1);
+		aacFrameInfo->sampRateOut =   aacDecInfo->sampRate * (aacDecInfo->sbrEnabled && !aacDecInfo->sbrDownsampled ? 2 : 1);
 		aacFrameInfo->bitsPerSample = 16;
-		aacFrameInfo->outputSamps =   aacDecInfo->nChans * AAC_MAX_NSAMPS * (aacDecInfo->sbrEnabled ? 2 : 1);
+		aacFrameInfo->outputSamps =   aacDecInfo->nChans * AAC_MAX_NSAMPS * (aacDecInfo->sbrEnabled && !aacDecInfo->sbrDownsampled ? 2 : 1);
 		aacFrameInfo->profile =       aacDecInfo->profile;
 		aacFrameInfo->tnsUsed =       aacDecInfo->tnsUsed;
 		aacFrameInfo->pnsUsed =       aacDecInfo->pnsUsed;
@@ -229,6 +235,7 @@ int AACSetRawBlockParams(HAACDecoder hAACDecoder, int copyLast, AACFrameInfo *aa
  * Function:    AACFlushCodec
  *
  * Description: flush internal codec state (after seeking, for example)
+ *              a lazily allocated SBR state (AAC_SBR_LAZY_ALLOC) is released
  *
  * Inputs:      valid AAC decoder instance pointer (HAACDecoder)
  *
@@ -260,12 +267,299 @@ int AACFlushCodec(HAACDecoder hAACDecoder)
 	/* reset internal codec state (flush overlap buffers, etc.) */
 	FlushCodec(aacDecInfo);
 #ifdef AAC_ENABLE_SBR
-	FlushCodecSBR(aacDecInfo);
+	/* a lazily allocated SBR state is released, it starts from scratch when needed again */
+	if (aacDecInfo->sbrLazy)
+		FreeSBR(aacDecInfo);
+	else
+		FlushCodecSBR(aacDecInfo);
+#endif
+
+	return ERR_AAC_NONE;
+}
+
+/**************************************************************************************
+ * Function:    AACResetDecoder
+ *
+ * Description: prepare the decoder for a new stream, without freeing and
+ *                reallocating memory
+ *
+ * Inputs:      valid AAC decoder instance pointer (HAACDecoder)
+ *
+ * Outputs:     decoder state equivalent to a newly created instance
+ *
+ * Return:      0 if successful, error code (< 0) if error
+ *
+ * Notes:       unlike AACFlushCodec() this also forgets the stream format, so the
+ *                next stream can have a different sample rate, channels or profile
+ *              settings (AACSetDownsampledSBR(), AACSetLowPowerSBR(), AACSetParseOnly()) 
+ *                stay in effect
+ *              for raw blocks call AACSetRawBlockParams() again afterwards
+ **************************************************************************************/
+int AACResetDecoder(HAACDecoder hAACDecoder)
+{
+	void *psInfoBase, *psInfoSBR;
+	int sbrLazy, sbrDownsampled, sbrLowPower, parseOnly;
+	AACDecInfo *aacDecInfo = (AACDecInfo *)hAACDecoder;
+
+	if (!aacDecInfo)
+		return ERR_AAC_NULL_POINTER;
+
+	/* everything in AACDecInfo is stream state, except the pointers to the codec state 
+	 *   and the settings
+	 */
+	psInfoBase = aacDecInfo->psInfoBase;
+	psInfoSBR = aacDecInfo->psInfoSBR;
+	sbrLazy = aacDecInfo->sbrLazy;
+	sbrDownsampled = aacDecInfo->sbrDownsampled;
+	sbrLowPower = aacDecInfo->sbrLowPower;
+	parseOnly = aacDecInfo->parseOnly;
+	ClearBuffer(aacDecInfo, sizeof(AACDecInfo));
+	aacDecInfo->psInfoBase = psInfoBase;
+	aacDecInfo->psInfoSBR = psInfoSBR;
+	aacDecInfo->sbrLazy = sbrLazy;
+	aacDecInfo->sbrDownsampled = sbrDownsampled;
+	aacDecInfo->sbrLowPower = sbrLowPower;
+	aacDecInfo->parseOnly = parseOnly;
+
+	if (ResetCodec(aacDecInfo))
+		return ERR_AAC_NULL_POINTER;
+#ifdef AAC_ENABLE_SBR
+	if (aacDecInfo->sbrLazy)
+		FreeSBR(aacDecInfo);
+	else if (FlushCodecSBR(aacDecInfo))
+		return ERR_AAC_NULL_POINTER;
 #endif
 
 	return ERR_AAC_NONE;
 }
 
+/**************************************************************************************
+ * Function:    AACGetNoiseState
+ *
+ * Description: get the state of the random noise generator used for perceptual
+ *                noise substitution (PNS)
+ *
+ * Inputs:      valid AAC decoder instance pointer (HAACDecoder)
+ *
+ * Outputs:     generator state, if seed != 0
+ *              number of random values generated since the decoder was created or
+ *                reset, or since the last call to AACSetNoiseState(), if count != 0
+ *
+ * Return:      0 if successful, error code (< 0) if error
+ *
+ * Notes:       unlike the other codec state (overlap, SBR delay lines) which only 
+ *                depends on the last frames, the generator state depends on all 
+ *                frames decoded so far
+ *              the generator is the LCG x' = 1664525*x + 1013904223 (mod 2^32), so
+ *                an application which decodes a stream in pieces can compute the 
+ *                state at the start of a piece from the counts of the earlier ones
+ **************************************************************************************/
+int AACGetNoiseState(HAACDecoder hAACDecoder, unsigned int *seed, unsigned int *count)
+{
+	AACDecInfo *aacDecInfo = (AACDecInfo *)hAACDecoder;
+
+	if (!aacDecInfo)
+		return ERR_AAC_NULL_POINTER;
+
+	if (GetNoiseState(aacDecInfo, seed, count))
+		return ERR_AAC_NULL_POINTER;
+
+	return ERR_AAC_NONE;
+}
+
+/**************************************************************************************
+ * Function:    AACSetNoiseState
+ *
+ * Description: set the state of the PNS random noise generator
+ *
+ * Inputs:      valid AAC decoder instance pointer (HAACDecoder)
+ *              generator state, e.g. computed from AACGetNoiseState() results
+ *
+ * Outputs:     updated generator state, count of generated values set to 0
+ *
+ * Return:      0 if successful, error code (< 0) if error
+ **************************************************************************************/
+int AACSetNoiseState(HAACDecoder hAACDecoder, unsigned int seed)
+{
+	AACDecInfo *aacDecInfo = (AACDecInfo *)hAACDecoder;
+
+	if (!aacDecInfo)
+		return ERR_AAC_NULL_POINTER;
+
+	if (SetNoiseState(aacDecInfo, seed))
+		return ERR_AAC_NULL_POINTER;
+
+	return ERR_AAC_NONE;
+}
+
+/**************************************************************************************
+ * Function:    AACGetSBRPhase
+ *
+ * Description: get the phase of the SBR noise and sinusoid generators
+ *
+ * Inputs:      valid AAC decoder instance pointer (HAACDecoder)
+ *
+ * Outputs:     phase of each channel (AAC_MAX_NCHANS entries): noise table index 
+ *                (0-511) + 512 * sinusoid index (0-3), -1 if SBR is not running for
+ *                the channel
+ *              number of SBR headers received since the decoder was created or 
+ *                reset, if headers != 0
+ *              number of SBR header changes, if resets != 0
+ *
+ * Return:      0 if successful, error code (< 0) if error
+ *
+ * Notes:       like the PNS generator state (AACGetNoiseState) the phases depend on
+ *                all frames decoded so far: both advance by the same amount in every
+ *                decoder which decodes a frame, until a header change restarts the 
+ *                noise table
+ **************************************************************************************/
+int AACGetSBRPhase(HAACDecoder hAACDecoder, int *phase, unsigned int *headers, unsigned int *resets)
+{
+	AACDecInfo *aacDecInfo = (AACDecInfo *)hAACDecoder;
+
+	if (!aacDecInfo || !phase)
+		return ERR_AAC_NULL_POINTER;
+
+	/* all phases are -1 if the SBR state is not allocated (yet) */
+	GetSBRPhase(aacDecInfo, phase, headers, resets);
+
+	return ERR_AAC_NONE;
+}
+
+/**************************************************************************************
+ * Function:    AACSetSBRPhase
+ *
+ * Description: set the phase of the SBR noise and sinusoid generators
+ *
+ * Inputs:      valid AAC decoder instance pointer (HAACDecoder)
+ *              phase of each channel (see AACGetSBRPhase), channels with a 
+ *                negative phase are not changed
+ *
+ * Outputs:     none
+ *
+ * Return:      0 if successful, error code (< 0) if error
+ *
+ * Notes:       only changes channels where SBR is already running, i.e. call it after
+ *                the frame which started SBR (the first one with an SBR header)
+ **************************************************************************************/
+int AACSetSBRPhase(HAACDecoder hAACDecoder, const int *phase)
+{
+	AACDecInfo *aacDecInfo = (AACDecInfo *)hAACDecoder;
+
+	if (!aacDecInfo || !phase)
+		return ERR_AAC_NULL_POINTER;
+
+#ifdef AAC_ENABLE_SBR
+	if (SetSBRPhase(aacDecInfo, phase))
+		return ERR_AAC_NULL_POINTER;
+#endif
+
+	return ERR_AAC_NONE;
+}
+
+/**************************************************************************************
+ * Function:    AACSetDownsampledSBR
+ *
+ * Description: decode HE-AAC (SBR) streams at the core sample rate instead of twice
+ *                the core sample rate
+ *
+ * Inputs:      valid AAC decoder instance pointer (HAACDecoder)
+ *              1 to enable the downsampled SBR mode, 0 to disable it
+ *
+ * Outputs:     none
+ *
+ * Return:      0 if successful, error code (< 0) if error
+ *
+ * Notes:       SBR runs as usual, but the output is synthesized with the 32-band
+ *                downsampled synthesis QMF (4.6.18.4.3), so the reconstructed high 
+ *                band is kept up to half the core sample rate and the synthesis
+ *                costs less
+ *              sampRateOut and outputSamps from AACGetLastFrameInfo() describe the 
+ *                downsampled output
+ *              no effect on streams without SBR
+ *              call after AACInitDecoder(), before decoding the stream - switching 
+ *                mid-stream is allowed but causes a glitch
+ **************************************************************************************/
+int AACSetDownsampledSBR(HAACDecoder hAACDecoder, int enable)
+{
+	AACDecInfo *aacDecInfo = (AACDecInfo *)hAACDecoder;
+
+	if (!aacDecInfo)
+		return ERR_AAC_NULL_POINTER;
+
+	aacDecInfo->sbrDownsampled = (enable ? 1 : 0);
+
+	return ERR_AAC_NONE;
+}
+
+/**************************************************************************************
+ * Function:    AACSetLowPowerSBR
+ *
+ * Description: decode HE-AAC (SBR) streams with the low power (real-valued) SBR tool
+ *
+ * Inputs:      valid AAC decoder instance pointer (HAACDecoder)
+ *              1 to enable the low power SBR mode, 0 to disable it
+ *
+ * Outputs:     none
+ *
+ * Return:      0 if successful, error code (< 0) if error
+ *
+ * Notes:       the QMF banks are cosine modulated, and HF generation and adjustment
+ *                only use the real parts of the subband samples, which roughly 
+ *                halves the cost of SBR
+ *              includes the aliasing detection and reduction (4.6.18.7.5 for LP) 
+ *                and the sinusoid compensation in the neighbouring bands 
+ *                (4.6.18.7.6 for LP) of the low power tool
+ *              can be combined with AACSetDownsampledSBR()
+ *              no effect on streams without SBR
+ *              call after AACInitDecoder(), before decoding the stream - switching 
+ *                mid-stream is allowed but causes a glitch
+ **************************************************************************************/
+int AACSetLowPowerSBR(HAACDecoder hAACDecoder, int enable)
+{
+	AACDecInfo *aacDecInfo = (AACDecInfo *)hAACDecoder;
+
+	if (!aacDecInfo)
+		return ERR_AAC_NULL_POINTER;
+
+	aacDecInfo->sbrLowPower = (enable ? 1 : 0);
+
+	return ERR_AAC_NONE;
+}
+
+/**************************************************************************************
+ * Function:    AACSetParseOnly
+ *
+ * Description: only parse the stream, without producing any output
+ *
+ * Inputs:      valid AAC decoder instance pointer (HAACDecoder)
+ *              1 to only parse the stream, 0 to decode it as usual
+ *
+ * Outputs:     none
+ *
+ * Return:      0 if successful, error code (< 0) if error
+ *
+ * Notes:       AACDecode() unpacks every frame and advances the PNS noise generator
+ *                and the phases of the SBR noise and sinusoids exactly like a normal
+ *                decode, but skips the dequantizer, TNS, the inverse transform and 
+ *                the SBR filterbanks, and does not write to outbuf
+ *              used with AACGetNoiseState() and AACGetSBRPhase() to find the state
+ *                of the generators at any frame of a stream at low cost
+ *              call after AACInitDecoder(), before decoding the stream - the decoder 
+ *                state is not valid for decoding after parsing frames
+ **************************************************************************************/
+int AACSetParseOnly(HAACDecoder hAACDecoder, int enable)
+{
+	AACDecInfo *aacDecInfo = (AACDecInfo *)hAACDecoder;
+
+	if (!aacDecInfo)
+		return ERR_AAC_NULL_POINTER;
+
+	aacDecInfo->parseOnly = (enable ? 1 : 0);
+
+	return ERR_AAC_NONE;
+}
+
 /**************************************************************************************
  * Function:    AACDecode
  *
@@ -278,7 +572,8 @@ int AACFlushCodec(HAACDecoder hAACDecoder)
  *                (outbuf must be double-sized if SBR enabled)
  *
  * Outputs:     PCM data in outbuf, interleaved LRLRLR... if stereo
- *                number of output samples = 1024 per channel (2048 if SBR enabled)
+ *                number of output samples = 1024 per channel (2048 if SBR enabled,
+ *                unless AACSetDownsampledSBR() is active)
  *              updated inbuf pointer
  *              updated bytesLeft
  *
@@ -381,7 +676,7 @@ int AACDecode(HAACDecoder hAACDecoder, unsigned char **inbuf, int *bytesLeft, sh
 		if (baseChan + elementChans > AAC_MAX_NCHANS)
 			return ERR_AAC_NCHANS_TOO_HIGH;
 
-		/* noiseless decoder and dequantizer */
+		/* noiseless decoder and dequantizer (a channel pair is dequantized together with the stereo processing) */
 		for (ch = 0; ch < elementChans; ch++) {
       PROFILE_START("noiseless decoder");
 			err = DecodeNoiselessData(aacDecInfo, &inptr, &bitOffset, &bitsAvail, ch);
@@ -390,44 +685,55 @@ int AACDecode(HAACDecoder hAACDecoder, unsigned char **inbuf, int *bytesLeft, sh
 			if (err)
 				return err;
 
-			PROFILE_START("dequant");
-			if (Dequantize(aacDecInfo, ch))
-				return ERR_AAC_DEQUANT;
-      PROFILE_END();
+			if (aacDecInfo->currBlockID != AAC_ID_CPE && !aacDecInfo->parseOnly) {
+				PROFILE_START("dequant");
+				if (Dequantize(aacDecInfo, ch))
+					return ERR_AAC_DEQUANT;
+				PROFILE_END();
+			}
 		}
 
-    PROFILE_START("mid-side and intensity stereo");
-		/* mid-side and intensity stereo */
-		if (aacDecInfo->currBlockID == AAC_ID_CPE) {
-			if (StereoProcess(aacDecInfo))
+    PROFILE_START("dequant, mid-side and intensity stereo");
+		/* dequantizer, mid-side and intensity stereo */
+		if (aacDecInfo->currBlockID == AAC_ID_CPE && !aacDecInfo->parseOnly) {
+			if (DequantStereoProcess(aacDecInfo))
 				return ERR_AAC_STEREO_PROCESS;
 		}
     PROFILE_END();
 
 
-		/* PNS, TNS, inverse transform */
+#ifdef AAC_ENABLE_SBR
+		/* the SBR fill element follows the channel element: only then IMDCT needs to keep 32-bit PCM */
+		aacDecInfo->sbrNext = (elementChans > 0 && SBRFillElementNext(inptr, bitOffset, bitsAvail));
+#endif
+
+		/* PNS, TNS, inverse transform (only PNS if parsing, it advances the noise generator) */
 		for (ch = 0; ch < elementChans; ch++) {
       PROFILE_START("PNS");
 			if (PNS(aacDecInfo, ch))
 				return ERR_AAC_PNS;
       PROFILE_END();
 
-			if (aacDecInfo->sbDeinterleaveReqd[ch]) {
-				/* deinterleave short blocks, if required */
-				if (DeinterleaveShortBlocks(aacDecInfo, ch))
-					return ERR_AAC_SHORT_BLOCK_DEINT;
+			if (aacDecInfo->parseOnly) {
 				aacDecInfo->sbDeinterleaveReqd[ch] = 0;
-			}
+			} else {
+				if (aacDecInfo->sbDeinterleaveReqd[ch]) {
+					/* deinterleave short blocks, if required */
+					if (DeinterleaveShortBlocks(aacDecInfo, ch))
+						return ERR_AAC_SHORT_BLOCK_DEINT;
+					aacDecInfo->sbDeinterleaveReqd[ch] = 0;
+				}
 
       PROFILE_START("TNS");
-			if (TNSFilter(aacDecInfo, ch))
-				return ERR_AAC_TNS;
+				if (TNSFilter(aacDecInfo, ch))
+					return ERR_AAC_TNS;
       PROFILE_END();
 	
       PROFILE_START("IMDCT");
-			if (IMDCT(aacDecInfo, ch, baseChan + ch, outbuf))
-				return ERR_AAC_IMDCT;
+				if (IMDCT(aacDecInfo, ch, baseChan + ch, outbuf))
+					return ERR_AAC_IMDCT;
       PROFILE_END();
+			}
 		}
 
 #ifdef AAC_ENABLE_SBR
@@ -442,6 +748,10 @@ int AACDecode(HAACDecoder hAACDecoder, unsigned char **inbuf, int *bytesLeft, sh
 			if (baseChanSBR + elementChansSBR > AAC_MAX_NCHANS)
 				return ERR_AAC_SBR_NCHANS_TOO_HIGH;
 
+			/* allocate SBR state when it is needed for the first time (see AAC_SBR_LAZY_ALLOC) */
+			if (!aacDecInfo->psInfoSBR && InitSBR(aacDecInfo))
+				return ERR_AAC_SBR_INIT;
+
 			/* parse SBR extension data if present (contained in a fill element) */
 			if (DecodeSBRBitstream(aacDecInfo, baseChanSBR))
 				return ERR_AAC_SBR_BITSTREAM;
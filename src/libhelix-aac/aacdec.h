@@ -158,6 +158,19 @@ int AACFindSyncWord(unsigned char *buf, int nBytes);
 void AACGetLastFrameInfo(HAACDecoder hAACDecoder, AACFrameInfo *aacFrameInfo);
 int AACSetRawBlockParams(HAACDecoder hAACDecoder, int copyLast, AACFrameInfo *aacFrameInfo);
 int AACFlushCodec(HAACDecoder hAACDecoder);
+int AACResetDecoder(HAACDecoder hAACDecoder);
+int AACSetDownsampledSBR(HAACDecoder hAACDecoder, int enable);
+int AACSetLowPowerSBR(HAACDecoder hAACDecoder, int enable);
+
+/* internal hooks for the segment-parallel decoder (AACParallelDecoderHelix.h)
+ *   these are not part of the stable API: the functions and the format of the
+ *   state values can change in any release, don't use them in applications
+ */
+int AACGetNoiseState(HAACDecoder hAACDecoder, unsigned int *seed, unsigned int *count);
+int AACSetNoiseState(HAACDecoder hAACDecoder, unsigned int seed);
+int AACGetSBRPhase(HAACDecoder hAACDecoder, int *phase, unsigned int *headers, unsigned int *resets);
+int AACSetSBRPhase(HAACDecoder hAACDecoder, const int *phase);
+int AACSetParseOnly(HAACDecoder hAACDecoder, int enable);
 
 #ifdef HELIX_CONFIG_AAC_GENERATE_TRIGTABS_FLOAT
 int AACInitTrigtabsFloat(void);
@@ -635,4 +635,126 @@ clip to [-2^n, 2^n-1], valid range of n = [1, 30]
     }
 #endif
 
+/* optional SIMD versions of the DSP kernels, used when the compiler targets SSE4.1 
+ *   (e.g. -msse4.1, -mavx2 or -march=native) - define HELIX_NO_SIMD to force the C versions
+ * all SIMD kernels are bit-exact with the C code
+ */
+#if defined(__SSE4_1__) && !defined(HELIX_NO_SIMD)
+#define AAC_SIMD_SSE41
+
+#include <smmintrin.h>
+
+/* MULSHIFT32 on 4 lanes: upper 32 bits of the signed 64-bit products */
+static __inline __m128i MULSHIFT32_X4(__m128i x, __m128i y)
+{
+	__m128i ev, od;
+
+	ev = _mm_srli_epi64(_mm_mul_epi32(x, y), 32);
+	od = _mm_mul_epi32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32));
+
+	return _mm_blend_epi16(ev, od, 0xcc);
+}
+
+/* MULSHIFT32 of a constant with 4 lanes (the constant is already in both halves of each 64-bit lane) */
+static __inline __m128i MULSHIFT32_C4(int c, __m128i y)
+{
+	__m128i x, ev, od;
+
+	x = _mm_set1_epi32(c);
+	ev = _mm_srli_epi64(_mm_mul_epi32(x, y), 32);
+	od = _mm_mul_epi32(x, _mm_srli_epi64(y, 32));
+
+	return _mm_blend_epi16(ev, od, 0xcc);
+}
+
+/* MADD64 on 4 lanes: 64-bit products of lanes 0, 2 are accumulated in *ev, of lanes 1, 3 in *od */
+static __inline void MADD64_X4(__m128i *ev, __m128i *od, __m128i x, __m128i y)
+{
+	*ev = _mm_add_epi64(*ev, _mm_mul_epi32(x, y));
+	*od = _mm_add_epi64(*od, _mm_mul_epi32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32)));
+}
+
+/* upper 32 bits of the 64-bit accumulators from MADD64_X4, in lane order */
+static __inline __m128i HI32_X4(__m128i ev, __m128i od)
+{
+	return _mm_blend_epi16(_mm_srli_epi64(ev, 32), od, 0xcc);
+}
+
+/* lanes 0, 2 of a followed by lanes 0, 2 of b (real parts of interleaved complex data) */
+static __inline __m128i EVEN_X4(__m128i a, __m128i b)
+{
+	return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(2,0,2,0)));
+}
+
+/* lanes 1, 3 of a followed by lanes 1, 3 of b (imaginary parts of interleaved complex data) */
+static __inline __m128i ODD_X4(__m128i a, __m128i b)
+{
+	return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(3,1,3,1)));
+}
+
+/* lanes in reverse order */
+static __inline __m128i REVERSE_X4(__m128i x)
+{
+	return _mm_shuffle_epi32(x, _MM_SHUFFLE(0,1,2,3));
+}
+
+static __inline __m128i LOAD_X4(const int *x)
+{
+	return _mm_loadu_si128((const __m128i *)x);
+}
+
+static __inline void STORE_X4(int *x, __m128i v)
+{
+	_mm_storeu_si128((__m128i *)x, v);
+}
+
+/* x[0], x[-1], x[-2], x[-3] in lanes 0-3 */
+static __inline __m128i LOADREV_X4(const int *x)
+{
+	return REVERSE_X4(_mm_loadu_si128((const __m128i *)(x - 3)));
+}
+
+/* lanes 0-3 to x[0], x[-1], x[-2], x[-3] */
+static __inline void STOREREV_X4(int *x, __m128i v)
+{
+	_mm_storeu_si128((__m128i *)(x - 3), REVERSE_X4(v));
+}
+
+/* 4 interleaved window pairs: w0 = wnd[0, 2, 4, 6], w1 = wnd[1, 3, 5, 7] */
+static __inline void WINDOW_X4(const int *wnd, __m128i *w0, __m128i *w1)
+{
+	__m128i a, b;
+
+	a = _mm_loadu_si128((const __m128i *)wnd);
+	b = _mm_loadu_si128((const __m128i *)(wnd + 4));
+	*w0 = EVEN_X4(a, b);
+	*w1 = ODD_X4(a, b);
+}
+
+/* OR of the 4 lanes (guard bit masks) */
+static __inline int ORALL_X4(__m128i x)
+{
+	x = _mm_or_si128(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(1,0,3,2)));
+	x = _mm_or_si128(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(2,3,0,1)));
+
+	return _mm_cvtsi128_si32(x);
+}
+
+/* transpose 4x4 matrix held in 4 rows */
+static __inline void TRANSPOSE_X4(__m128i *r0, __m128i *r1, __m128i *r2, __m128i *r3)
+{
+	__m128i t0, t1, t2, t3;
+
+	t0 = _mm_unpacklo_epi32(*r0, *r1);
+	t1 = _mm_unpacklo_epi32(*r2, *r3);
+	t2 = _mm_unpackhi_epi32(*r0, *r1);
+	t3 = _mm_unpackhi_epi32(*r2, *r3);
+	*r0 = _mm_unpacklo_epi64(t0, t1);
+	*r1 = _mm_unpackhi_epi64(t0, t1);
+	*r2 = _mm_unpacklo_epi64(t2, t3);
+	*r3 = _mm_unpackhi_epi64(t2, t3);
+}
+
+#endif	/* __SSE4_1__ */
+
 #endif /* _ASSEMBLY_H */
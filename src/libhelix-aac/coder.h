@@ -88,6 +88,7 @@
 
 #define MAX_HUFF_BITS                   20
 #define HUFFTAB_SPEC_OFFSET             1
+#define HUFF_LOOKUP_BITS                9               /* index bits of the first level of the Huffman lookup tables */
 
 /* do y <<= n, clipping to range [-2^30, 2^30 - 1] (i.e. output has one guard bit) */
 /*
@@ -126,11 +127,15 @@
 /* additional external symbols to name-mangle for static linking */
 #define DecodeProgramConfigElement              STATNAME(DecodeProgramConfigElement)
 #define DecodeHuffmanScalar                             STATNAME(DecodeHuffmanScalar)
+#define DecodeHuffmanLookup                             STATNAME(DecodeHuffmanLookup)
 #define DecodeSpectrumLong                              STATNAME(DecodeSpectrumLong)
 #define DecodeSpectrumShort                             STATNAME(DecodeSpectrumShort)
 #define DecodeICSInfo                                   STATNAME(DecodeICSInfo)
+#define DequantBlock                                    STATNAME(DequantBlock)
 #define DCT4                                                    STATNAME(DCT4)
 #define R4FFT                                                   STATNAME(R4FFT)
+#define DCT4Short                                               STATNAME(DCT4Short)
+#define R4FFTShortX4                                    STATNAME(R4FFTShortX4)
 
 #define DecWindowOverlapNoClip                  STATNAME(DecWindowOverlapNoClip)
 #define DecWindowOverlapLongStartNoClip STATNAME(DecWindowOverlapLongStartNoClip)
@@ -141,6 +146,9 @@
 #define huffTabSpec                                     STATNAME(huffTabSpec)
 #define huffTabScaleFactInfo            STATNAME(huffTabScaleFactInfo)
 #define huffTabScaleFact                        STATNAME(huffTabScaleFact)
+#define huffLookSpecOffset                      STATNAME(huffLookSpecOffset)
+#define huffLookSpec                            STATNAME(huffLookSpec)
+#define huffLookScaleFact                       STATNAME(huffLookScaleFact)
 #define cos4sin4tab                                     STATNAME(cos4sin4tab)
 #define cos4sin4tabOffset                       STATNAME(cos4sin4tabOffset)
 #define cos1sin1tab                                     STATNAME(cos1sin1tab)
@@ -292,6 +300,7 @@ typedef struct _PSInfoBase {
 
     int                   pnsUsed[MAX_NCHANS_ELEM];
     int                   pnsLastVal;
+    unsigned int          pnsCount;		/* noise values generated since the last AACSetNoiseState() */
     int                   intensityUsed[MAX_NCHANS_ELEM];
 
     PulseInfo             pulseInfo[MAX_NCHANS_ELEM];
@@ -320,17 +329,23 @@ int DecodeProgramConfigElement(ProgConfigElement *pce, BitStreamInfo *bsi);
 
 /* huffman.c */
 int DecodeHuffmanScalar(const signed short *huffTab, const HuffInfo *huffTabInfo, unsigned int bitBuf, signed int *val);
+int DecodeHuffmanLookup(const unsigned short *lookTab, const signed short *huffTab, unsigned int bitBuf, signed int *val);
 void DecodeSpectrumLong(PSInfoBase *psi, BitStreamInfo *bsi, int ch);
 void DecodeSpectrumShort(PSInfoBase *psi, BitStreamInfo *bsi, int ch);
 
 /* noiseless.c */
 void DecodeICSInfo(BitStreamInfo *bsi, ICSInfo *icsInfo, int sampRateIdx);
 
+/* dequant.c */
+int DequantBlock(int *inbuf, int nSamps, int scale);
+
 /* dct4.c */
 void DCT4(int tabidx, int *coef, int gb);
+void DCT4Short(int *coef, int gb);
 
 /* fft.c */
 void R4FFT(int tabidx, int *x);
+void R4FFTShortX4(int *x);	/* SIMD builds only */
 
 /* sbrimdct.c */
 void DecWindowOverlapNoClip(int *buf0, int *over0, int *out0, int winTypeCurr, int winTypePrev);
@@ -343,6 +358,9 @@ extern const HuffInfo huffTabSpecInfo[11];
 extern const signed short huffTabSpec[1241];
 extern const HuffInfo huffTabScaleFactInfo; 
 extern const signed short huffTabScaleFact[121];
+extern const int huffLookSpecOffset[11];
+extern const unsigned short huffLookSpec[6344];
+extern const unsigned short huffLookScaleFact[1554];
 
 /* trigtabs.c */
 extern const int cos4sin4tabOffset[NUM_IMDCT_SIZES];
@@ -77,8 +77,49 @@ static void PreMultiply(int tabidx, int *zbuf1)
 	zbuf2 = zbuf1 + nmdct - 1;
 	csptr = cos4sin4tab + cos4sin4tabOffset[tabidx];
 
+	i = nmdct >> 2;
+#ifdef AAC_SIMD_SSE41
+	/* 4 butterflies per step: 8 samples from the front and 8 (in reverse order) from the back */
+	for ( ; i >= 4; i -= 4) {
+		__m128i f0, f1, b0, b1, vt, vz1, vz2, vcms2;
+		__m128i var1, vai1, var2, vai2, vcps2a, vsin2a, vcps2b, vsin2b;
+
+		f0 = _mm_loadu_si128((const __m128i *)(zbuf1 + 0));
+		f1 = _mm_loadu_si128((const __m128i *)(zbuf1 + 4));
+		b0 = REVERSE_X4(_mm_loadu_si128((const __m128i *)(zbuf2 - 3)));
+		b1 = REVERSE_X4(_mm_loadu_si128((const __m128i *)(zbuf2 - 7)));
+		var1 = EVEN_X4(f0, f1);
+		vai2 = ODD_X4(f0, f1);
+		vai1 = EVEN_X4(b0, b1);
+		var2 = ODD_X4(b0, b1);
+
+		vcps2a = _mm_loadu_si128((const __m128i *)(csptr + 0));
+		vsin2a = _mm_loadu_si128((const __m128i *)(csptr + 4));
+		vcps2b = _mm_loadu_si128((const __m128i *)(csptr + 8));
+		vsin2b = _mm_loadu_si128((const __m128i *)(csptr + 12));
+		TRANSPOSE_X4(&vcps2a, &vsin2a, &vcps2b, &vsin2b);
+		csptr += 16;
+
+		vt  = MULSHIFT32_X4(vsin2a, _mm_add_epi32(var1, vai1));
+		vz2 = _mm_sub_epi32(MULSHIFT32_X4(vcps2a, vai1), vt);
+		vcms2 = _mm_sub_epi32(vcps2a, _mm_slli_epi32(vsin2a, 1));
+		vz1 = _mm_add_epi32(MULSHIFT32_X4(vcms2, var1), vt);
+		_mm_storeu_si128((__m128i *)(zbuf1 + 0), _mm_unpacklo_epi32(vz1, vz2));
+		_mm_storeu_si128((__m128i *)(zbuf1 + 4), _mm_unpackhi_epi32(vz1, vz2));
+		zbuf1 += 8;
+
+		vt  = MULSHIFT32_X4(vsin2b, _mm_add_epi32(var2, vai2));
+		vz2 = _mm_sub_epi32(MULSHIFT32_X4(vcps2b, vai2), vt);
+		vcms2 = _mm_sub_epi32(vcps2b, _mm_slli_epi32(vsin2b, 1));
+		vz1 = _mm_add_epi32(MULSHIFT32_X4(vcms2, var2), vt);
+		_mm_storeu_si128((__m128i *)(zbuf2 - 3), REVERSE_X4(_mm_unpacklo_epi32(vz2, vz1)));
+		_mm_storeu_si128((__m128i *)(zbuf2 - 7), REVERSE_X4(_mm_unpackhi_epi32(vz2, vz1)));
+		zbuf2 -= 8;
+	}
+#endif
+
 	/* whole thing should fit in registers - verify that compiler does this */
-	for (i = nmdct >> 2; i != 0; i--) {
+	for ( ; i != 0; i--) {
 		/* cps2 = (cos+sin), sin2 = sin, cms2 = (cos-sin) */
 		cps2a = *csptr++;
 		sin2a = *csptr++;
@@ -138,6 +179,53 @@ static void PostMultiply(int tabidx, int *fft1)
 	skipFactor = postSkip[tabidx];
 	fft2 = fft1 + nmdct - 1;
 
+	i = nmdct >> 2;
+#ifdef AAC_SIMD_SSE41
+	/* 4 butterflies per step, see PreMultiply()
+	 * butterfly k uses coef pair k for the front and pair k+1 for the back sample
+	 */
+	for ( ; i >= 4; i -= 4) {
+		__m128i f0, f1, b0, b1, vt, vza, vzb, vzc, vzd, p0, p1, p2, p3, p4;
+		__m128i var1, vai1, var2, vai2, vcps2a, vsin2a, vcps2b, vsin2b;
+
+		f0 = _mm_loadu_si128((const __m128i *)(fft1 + 0));
+		f1 = _mm_loadu_si128((const __m128i *)(fft1 + 4));
+		b0 = REVERSE_X4(_mm_loadu_si128((const __m128i *)(fft2 - 3)));
+		b1 = REVERSE_X4(_mm_loadu_si128((const __m128i *)(fft2 - 7)));
+		var1 = EVEN_X4(f0, f1);
+		vai1 = ODD_X4(f0, f1);
+		vai2 = _mm_sub_epi32(_mm_setzero_si128(), EVEN_X4(b0, b1));
+		var2 = ODD_X4(b0, b1);
+
+		p0 = _mm_loadl_epi64((const __m128i *)(csptr + 0*(skipFactor+1)));
+		p1 = _mm_loadl_epi64((const __m128i *)(csptr + 1*(skipFactor+1)));
+		p2 = _mm_loadl_epi64((const __m128i *)(csptr + 2*(skipFactor+1)));
+		p3 = _mm_loadl_epi64((const __m128i *)(csptr + 3*(skipFactor+1)));
+		p4 = _mm_loadl_epi64((const __m128i *)(csptr + 4*(skipFactor+1)));
+		vcps2a = _mm_unpacklo_epi64(p0, p1);
+		vsin2a = _mm_unpacklo_epi64(p1, p2);
+		vcps2b = _mm_unpacklo_epi64(p2, p3);
+		vsin2b = _mm_unpacklo_epi64(p3, p4);
+		TRANSPOSE_X4(&vcps2a, &vsin2a, &vcps2b, &vsin2b);
+		csptr += 4*(skipFactor+1);
+
+		vt  = MULSHIFT32_X4(vsin2a, _mm_add_epi32(var1, vai1));
+		vza = _mm_sub_epi32(vt, MULSHIFT32_X4(vcps2a, vai1));
+		vzb = _mm_add_epi32(vt, MULSHIFT32_X4(_mm_sub_epi32(vcps2a, _mm_slli_epi32(vsin2a, 1)), var1));
+
+		vt  = MULSHIFT32_X4(vsin2b, _mm_add_epi32(var2, vai2));
+		vzc = _mm_sub_epi32(vt, MULSHIFT32_X4(vcps2b, vai2));
+		vzd = _mm_add_epi32(vt, MULSHIFT32_X4(_mm_sub_epi32(vcps2b, _mm_slli_epi32(vsin2b, 1)), var2));
+
+		_mm_storeu_si128((__m128i *)(fft1 + 0), _mm_unpacklo_epi32(vzb, vzd));
+		_mm_storeu_si128((__m128i *)(fft1 + 4), _mm_unpackhi_epi32(vzb, vzd));
+		_mm_storeu_si128((__m128i *)(fft2 - 3), REVERSE_X4(_mm_unpacklo_epi32(vza, vzc)));
+		_mm_storeu_si128((__m128i *)(fft2 - 7), REVERSE_X4(_mm_unpackhi_epi32(vza, vzc)));
+		fft1 += 8;
+		fft2 -= 8;
+	}
+#endif
+
 	/* load coeffs for first pass
 	 * cps2 = (cos+sin), sin2 = sin, cms2 = (cos-sin)
 	 */
@@ -146,7 +234,7 @@ static void PostMultiply(int tabidx, int *fft1)
 	csptr += skipFactor;
 	cms2 = cps2 - 2*sin2;
 
-	for (i = nmdct >> 2; i != 0; i--) {
+	for ( ; i != 0; i--) {
 		ar1 = *(fft1 + 0);
 		ai1 = *(fft1 + 1);
 		ar2 = *(fft2 - 1);
@@ -335,3 +423,158 @@ void DCT4(int tabidx, int *coef, int gb)
 		PostMultiply(tabidx, coef);
 	}
 }
+
+#ifdef AAC_SIMD_SSE41
+/**************************************************************************************
+ * Function:    PreMultiplyShortX4, PostMultiplyShortX4
+ *
+ * Description: same as PreMultiply and PostMultiply for 4 short blocks in parallel
+ *
+ * Inputs:      buffer of samples, one block per lane (sample k of all 4 blocks in zbuf1[k])
+ *
+ * Outputs:     processed samples in same buffer
+ *
+ * Return:      none
+ **************************************************************************************/
+static void PreMultiplyShortX4(__m128i *zbuf1)
+{
+	int i, cps2a, sin2a, cps2b, sin2b;
+	__m128i ar1, ai1, ar2, ai2, t;
+	__m128i *zbuf2;
+	const int *csptr;
+
+	zbuf2 = zbuf1 + nmdctTab[0] - 1;
+	csptr = cos4sin4tab + cos4sin4tabOffset[0];
+
+	for (i = nmdctTab[0] >> 2; i != 0; i--) {
+		cps2a = *csptr++;
+		sin2a = *csptr++;
+		cps2b = *csptr++;
+		sin2b = *csptr++;
+
+		ar1 = zbuf1[0];
+		ai2 = zbuf1[1];
+		ai1 = zbuf2[0];
+		ar2 = zbuf2[-1];
+
+		t = MULSHIFT32_C4(sin2a, _mm_add_epi32(ar1, ai1));
+		zbuf1[1] = _mm_sub_epi32(MULSHIFT32_C4(cps2a, ai1), t);
+		zbuf1[0] = _mm_add_epi32(MULSHIFT32_C4(cps2a - 2*sin2a, ar1), t);
+		zbuf1 += 2;
+
+		t = MULSHIFT32_C4(sin2b, _mm_add_epi32(ar2, ai2));
+		zbuf2[0] = _mm_sub_epi32(MULSHIFT32_C4(cps2b, ai2), t);
+		zbuf2[-1] = _mm_add_epi32(MULSHIFT32_C4(cps2b - 2*sin2b, ar2), t);
+		zbuf2 -= 2;
+	}
+}
+
+static void PostMultiplyShortX4(__m128i *fft1)
+{
+	int i, cps2, sin2, skipFactor;
+	__m128i ar1, ai1, ar2, ai2, t;
+	__m128i *fft2;
+	const int *csptr;
+
+	csptr = cos1sin1tab;
+	skipFactor = postSkip[0];
+	fft2 = fft1 + nmdctTab[0] - 1;
+
+	cps2 = *csptr++;
+	sin2 = *csptr;
+	csptr += skipFactor;
+
+	for (i = nmdctTab[0] >> 2; i != 0; i--) {
+		ar1 = fft1[0];
+		ai1 = fft1[1];
+		ar2 = fft2[-1];
+		ai2 = fft2[0];
+
+		t = MULSHIFT32_C4(sin2, _mm_add_epi32(ar1, ai1));
+		fft2[0] = _mm_sub_epi32(t, MULSHIFT32_C4(cps2, ai1));
+		fft1[0] = _mm_add_epi32(t, MULSHIFT32_C4(cps2 - 2*sin2, ar1));
+		cps2 = *csptr++;
+		sin2 = *csptr;
+		csptr += skipFactor;
+
+		ai2 = _mm_sub_epi32(_mm_setzero_si128(), ai2);
+		t = MULSHIFT32_C4(sin2, _mm_add_epi32(ar2, ai2));
+		fft2[-1] = _mm_sub_epi32(t, MULSHIFT32_C4(cps2, ai2));
+		fft1[1] = _mm_add_epi32(t, MULSHIFT32_C4(cps2 - 2*sin2, ar2));
+		fft1 += 2;
+		fft2 -= 2;
+	}
+}
+
+/* transpose 4 blocks of nmdct samples into one block per lane */
+static void InterleaveShortX4(const int *blocks, __m128i *x)
+{
+	int k;
+
+	for (k = 0; k < nmdctTab[0]; k += 4) {
+		x[k+0] = _mm_loadu_si128((const __m128i *)(blocks + 0*nmdctTab[0] + k));
+		x[k+1] = _mm_loadu_si128((const __m128i *)(blocks + 1*nmdctTab[0] + k));
+		x[k+2] = _mm_loadu_si128((const __m128i *)(blocks + 2*nmdctTab[0] + k));
+		x[k+3] = _mm_loadu_si128((const __m128i *)(blocks + 3*nmdctTab[0] + k));
+		TRANSPOSE_X4(&x[k+0], &x[k+1], &x[k+2], &x[k+3]);
+	}
+}
+
+/* inverse of InterleaveShortX4 */
+static void DeinterleaveShortX4(int *blocks, const __m128i *x)
+{
+	int k;
+	__m128i r0, r1, r2, r3;
+
+	for (k = 0; k < nmdctTab[0]; k += 4) {
+		r0 = x[k+0];
+		r1 = x[k+1];
+		r2 = x[k+2];
+		r3 = x[k+3];
+		TRANSPOSE_X4(&r0, &r1, &r2, &r3);
+		_mm_storeu_si128((__m128i *)(blocks + 0*nmdctTab[0] + k), r0);
+		_mm_storeu_si128((__m128i *)(blocks + 1*nmdctTab[0] + k), r1);
+		_mm_storeu_si128((__m128i *)(blocks + 2*nmdctTab[0] + k), r2);
+		_mm_storeu_si128((__m128i *)(blocks + 3*nmdctTab[0] + k), r3);
+	}
+}
+#endif
+
+/**************************************************************************************
+ * Function:    DCT4Short
+ *
+ * Description: type-IV DCT of the 8 short blocks of a frame
+ *
+ * Inputs:      buffer of 8 consecutive short blocks
+ *              number of guard bits in the input buffer
+ *
+ * Outputs:     processed samples in same buffer
+ *
+ * Return:      none
+ *
+ * Notes:       same result as DCT4(0, ...) on each block
+ *              with SIMD, 4 blocks are transformed in parallel (one block per lane)
+ *                unless the input needs rescaling (rare)
+ **************************************************************************************/
+void DCT4Short(int *coef, int gb)
+{
+	int i;
+
+#ifdef AAC_SIMD_SSE41
+	if (gb >= GBITS_IN_DCT4) {
+		__m128i x[128];
+
+		for (i = 0; i < 8; i += 4) {
+			InterleaveShortX4(coef + i*nmdctTab[0], x);
+			PreMultiplyShortX4(x);
+			R4FFTShortX4((int *)x);
+			PostMultiplyShortX4(x);
+			DeinterleaveShortX4(coef + i*nmdctTab[0], x);
+		}
+		return;
+	}
+#endif
+
+	for (i = 0; i < 8; i++)
+		DCT4(0, coef + i*nmdctTab[0], gb);
+}
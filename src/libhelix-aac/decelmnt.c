@@ -341,6 +341,51 @@ static int DecodeFillElement(AACDecInfo *aacDecInfo, BitStreamInfo *bsi)
 	return 0;
 }
 
+/**************************************************************************************
+ * Function:    SBRFillElementNext
+ *
+ * Description: check whether the next syntactic element is a fill element with SBR data
+ *
+ * Inputs:      buffer containing the next element
+ *              bit offset
+ *              number of valid bits remaining in buf
+ *
+ * Outputs:     none
+ *
+ * Return:      1 if the next element is a fill element with SBR extension data, 0 otherwise
+ *
+ * Notes:       does not advance the bitstream: called after the noiseless data of a 
+ *                channel element, before its inverse transform, which only has to keep 
+ *                32-bit PCM if SBR processes the element
+ **************************************************************************************/
+int SBRFillElementNext(unsigned char *buf, int bitOffset, int bitsAvail)
+{
+	int fillExtType;
+	unsigned int fillCount;
+	BitStreamInfo bsi;
+
+	if (bitsAvail < NUM_SYN_ID_BITS + 4 + 4)
+		return 0;
+
+	SetBitstreamPointer(&bsi, (bitsAvail + 7) >> 3, buf);
+	GetBits(&bsi, bitOffset);
+	if (GetBits(&bsi, NUM_SYN_ID_BITS) != AAC_ID_FIL)
+		return 0;
+
+	/* same layout as DecodeFillElement(): the extension type is in the first fill byte */
+	fillCount = GetBits(&bsi, 4);
+	if (fillCount == 15) {
+		if (bitsAvail < NUM_SYN_ID_BITS + 4 + 8 + 4)
+			return 0;
+		fillCount += (GetBits(&bsi, 8) - 1);
+	}
+	if (fillCount == 0)
+		return 0;
+	fillExtType = (int)GetBits(&bsi, 4);
+
+	return (fillExtType == EXT_SBR_DATA || fillExtType == EXT_SBR_DATA_CRC);
+}
+
 /**************************************************************************************
  * Function:    DecodeNextElement
  *
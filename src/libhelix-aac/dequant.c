@@ -126,6 +126,154 @@ static const int pow2frac[8] PROGMEM = {
 	0x50a28be6, 0x7fffffff, 0x6597fa94, 0x50a28be6
 };
 
+/**************************************************************************************
+ * Function:    DequantLarge
+ *
+ * Description: dequantize the magnitude of one transform coefficient >= 4
+ *
+ * Inputs:      quantized magnitude, range = [4, 8191]
+ *              pow43_14 row, fractional and integer part of the scalefactor (see DequantBlock)
+ *
+ * Outputs:     none
+ *
+ * Return:      dequantized magnitude in Q(FBITS_OUT_DQ_OFF), clipped
+ **************************************************************************************/
+static __inline int DequantLarge(int x, const int *tab16, int scalef, int scalei)
+{
+	int y, shift;
+	const int *coef;
+
+	if (x < 16) {
+		/* result: y = Q25 (tab16 = Q25) */
+		y = tab16[x];
+		shift = 25 - scalei;
+	} else if (x < 64) {
+		/* result: y = Q21 (pow43tab[j] = Q23, scalef = Q30) */
+		y = pow43[x-16];	
+		shift = 21 - scalei;
+		y = MULSHIFT32(y, scalef);
+	} else {
+		/* normalize to [0x40000000, 0x7fffffff]
+		 * input x = [64, 8191] = [64, 2^13-1]
+		 * ranges:
+		 *  shift = 7:   64 -  127
+		 *  shift = 6:  128 -  255
+		 *  shift = 5:  256 -  511
+		 *  shift = 4:  512 - 1023
+		 *  shift = 3: 1024 - 2047
+		 *  shift = 2: 2048 - 4095
+		 *  shift = 1: 4096 - 8191
+		 */
+		x <<= 17;
+		shift = 0;
+		if (x < 0x08000000)
+			x <<= 4, shift += 4;
+		if (x < 0x20000000)
+			x <<= 2, shift += 2;
+		if (x < 0x40000000)
+			x <<= 1, shift += 1;
+
+		coef = (x < SQRTHALF) ? poly43lo : poly43hi;
+
+		/* polynomial */
+		y = coef[0];
+		y = MULSHIFT32(y, x) + coef[1];
+		y = MULSHIFT32(y, x) + coef[2];
+		y = MULSHIFT32(y, x) + coef[3];
+		y = MULSHIFT32(y, x) + coef[4];
+		y = MULSHIFT32(y, pow2frac[shift]) << 3;
+
+		/* fractional scale 
+		 * result: y = Q21 (pow43tab[j] = Q23, scalef = Q30)
+		 */
+		y = MULSHIFT32(y, scalef);	/* now y is Q24 */
+		shift = 24 - scalei - pow2exp[shift];
+	}
+
+	/* integer scale */
+	if (shift <= 0) {
+		shift = -shift;
+		if (shift > 31)
+			shift = 31;
+
+		if (y > (0x7fffffff >> shift))
+			y = 0x7fffffff;		/* clip (rare) */
+		else
+			y <<= shift;
+	} else {
+		if (shift > 31)
+			shift = 31;
+		y >>= shift;
+	}
+
+	return y;
+}
+
+#ifdef AAC_SIMD_SSE41
+/**************************************************************************************
+ * Function:    DequantBlockX4
+ *
+ * Description: dequantize one block of transform coefficients (in-place), 4 at a time
+ *
+ * Inputs:      quantized transform coefficients, range = [0, 8191]
+ *              number of samples to dequantize (multiple of 4)
+ *              table of the dequantized magnitudes [0, 3]
+ *              pow43_14 row, fractional and integer part of the scalefactor (see DequantBlock)
+ *
+ * Outputs:     dequantized transform coefficients in Q(FBITS_OUT_DQ_OFF)
+ *
+ * Return:      guard bit mask (OR of abs value of all dequantized coefs)
+ *
+ * Notes:       bit-exact with the scalar loop in DequantBlock
+ *              magnitudes < 16 (nearly all coefficients) are looked up in a table which is
+ *                scaled once per block, groups with a larger magnitude use DequantLarge
+ **************************************************************************************/
+static int DequantBlockX4(int *inbuf, int nSamps, const int *tab4, const int *tab16, int scalef, int scalei)
+{
+	int x, shift, tab[16], ax[4], ay[4];
+	__m128i v, a, y, gb, cnt;
+
+	/* tab[x] = dequantized magnitude of x = [0, 15], same integer scale as DequantLarge */
+	tab[0] = tab4[0]; tab[1] = tab4[1]; tab[2] = tab4[2]; tab[3] = tab4[3];
+	shift = 25 - scalei;
+	for (x = 4; x < 16; x += 4) {
+		v = LOAD_X4(tab16 + x);
+		if (shift <= 0) {
+			cnt = _mm_cvtsi32_si128(-shift > 31 ? 31 : -shift);
+			a = _mm_cmpgt_epi32(v, _mm_srl_epi32(_mm_set1_epi32(0x7fffffff), cnt));
+			v = _mm_blendv_epi8(_mm_sll_epi32(v, cnt), _mm_set1_epi32(0x7fffffff), a);	/* clip (rare) */
+		} else {
+			cnt = _mm_cvtsi32_si128(shift > 31 ? 31 : shift);
+			v = _mm_sra_epi32(v, cnt);
+		}
+		STORE_X4(tab + x, v);
+	}
+
+	gb = _mm_setzero_si128();
+	do {
+		v = LOAD_X4(inbuf);
+		a = _mm_abs_epi32(v);
+		if (_mm_testz_si128(a, _mm_set1_epi32(~0x0f))) {
+			y = _mm_setr_epi32(tab[_mm_extract_epi32(a, 0)], tab[_mm_extract_epi32(a, 1)], 
+				tab[_mm_extract_epi32(a, 2)], tab[_mm_extract_epi32(a, 3)]);
+		} else {
+			_mm_storeu_si128((__m128i *)ax, a);
+			for (x = 0; x < 4; x++)
+				ay[x] = (ax[x] < 16 ? tab[ax[x]] : DequantLarge(ax[x], tab16, scalef, scalei));
+			y = _mm_loadu_si128((const __m128i *)ay);
+		}
+
+		/* sign and store (gb used to count GB's) */
+		gb = _mm_or_si128(gb, y);
+		STORE_X4(inbuf, _mm_sign_epi32(y, v));
+		inbuf += 4;
+		nSamps -= 4;
+	} while (nSamps > 0);
+
+	return ORALL_X4(gb);
+}
+#endif
+
 /**************************************************************************************
  * Function:    DequantBlock
  *
@@ -144,10 +292,10 @@ static const int pow2frac[8] PROGMEM = {
  *              clips outputs to Q(FBITS_OUT_DQ_OFF)
  *              output has no minimum number of guard bits
  **************************************************************************************/
-static int DequantBlock(int *inbuf, int nSamps, int scale)
+int DequantBlock(int *inbuf, int nSamps, int scale)
 {
 	int iSamp, scalef, scalei, x, y, gbMask, shift, tab4[4];
-	const int *tab16, *coef;
+	const int *tab16;
 
 	if (nSamps <= 0)
 		return 0;
@@ -190,78 +338,21 @@ static int DequantBlock(int *inbuf, int nSamps, int scale)
 		tab4[3] = tab16[3] >> shift;
 	}
 
+#ifdef AAC_SIMD_SSE41
+	/* scaling the lookup table only pays off for wider bands */
+	if (nSamps >= 16 && !(nSamps & 0x03))
+		return DequantBlockX4(inbuf, nSamps, tab4, tab16, scalef, scalei);
+#endif
+
 	gbMask = 0;
 	do {
 		iSamp = *inbuf;
 		x = FASTABS(iSamp);
 
-		if (x < 4) {
+		if (x < 4)
 			y = tab4[x];
-		} else  {
-
-			if (x < 16) {
-				/* result: y = Q25 (tab16 = Q25) */
-				y = tab16[x];
-				shift = 25 - scalei;
-			} else if (x < 64) {
-				/* result: y = Q21 (pow43tab[j] = Q23, scalef = Q30) */
-				y = pow43[x-16];	
-				shift = 21 - scalei;
-				y = MULSHIFT32(y, scalef);
-			} else {
-				/* normalize to [0x40000000, 0x7fffffff]
-				 * input x = [64, 8191] = [64, 2^13-1]
-				 * ranges:
-				 *  shift = 7:   64 -  127
-				 *  shift = 6:  128 -  255
-				 *  shift = 5:  256 -  511
-				 *  shift = 4:  512 - 1023
-				 *  shift = 3: 1024 - 2047
-				 *  shift = 2: 2048 - 4095
-				 *  shift = 1: 4096 - 8191
-				 */
-				x <<= 17;
-				shift = 0;
-				if (x < 0x08000000)
-					x <<= 4, shift += 4;
-				if (x < 0x20000000)
-					x <<= 2, shift += 2;
-				if (x < 0x40000000)
-					x <<= 1, shift += 1;
-
-				coef = (x < SQRTHALF) ? poly43lo : poly43hi;
-
-				/* polynomial */
-				y = coef[0];
-				y = MULSHIFT32(y, x) + coef[1];
-				y = MULSHIFT32(y, x) + coef[2];
-				y = MULSHIFT32(y, x) + coef[3];
-				y = MULSHIFT32(y, x) + coef[4];
-				y = MULSHIFT32(y, pow2frac[shift]) << 3;
-
-				/* fractional scale 
-				 * result: y = Q21 (pow43tab[j] = Q23, scalef = Q30)
-				 */
-				y = MULSHIFT32(y, scalef);	/* now y is Q24 */
-				shift = 24 - scalei - pow2exp[shift];
-			}
-
-			/* integer scale */
-			if (shift <= 0) {
-				shift = -shift;
-				if (shift > 31)
-					shift = 31;
-
-				if (y > (0x7fffffff >> shift))
-					y = 0x7fffffff;		/* clip (rare) */
-				else
-					y <<= shift;
-			} else {
-				if (shift > 31)
-					shift = 31;
-				y >>= shift;
-			}
-		}
+		else
+			y = DequantLarge(x, tab16, scalef, scalei);
 
 		/* sign and store (gbMask used to count GB's) */
 		gbMask |= y;
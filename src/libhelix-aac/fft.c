@@ -111,6 +111,56 @@ static const int nfftlog2Tab[NUM_FFT_SIZES] PROGMEM = {6, 9};
  /* __attribute__ ((section (".data"))) */ static void R4FirstPass(int *x, int bg)
 {
     int ar, ai, br, bi, cr, ci, dr, di;
+
+#ifdef AAC_SIMD_SSE41
+	/* 4 butterflies per step, transposed so that lane k holds butterfly k */
+	for (; bg >= 4; bg -= 4) {
+		__m128i x0, x1, x2, x3, x4, x5, x6, x7;
+		__m128i var, vai, vbr, vbi, vcr, vci, vdr, vdi;
+
+		x0 = _mm_loadu_si128((const __m128i *)(x +  0));
+		x1 = _mm_loadu_si128((const __m128i *)(x +  8));
+		x2 = _mm_loadu_si128((const __m128i *)(x + 16));
+		x3 = _mm_loadu_si128((const __m128i *)(x + 24));
+		x4 = _mm_loadu_si128((const __m128i *)(x +  4));
+		x5 = _mm_loadu_si128((const __m128i *)(x + 12));
+		x6 = _mm_loadu_si128((const __m128i *)(x + 20));
+		x7 = _mm_loadu_si128((const __m128i *)(x + 28));
+		TRANSPOSE_X4(&x0, &x1, &x2, &x3);
+		TRANSPOSE_X4(&x4, &x5, &x6, &x7);
+
+		var = _mm_add_epi32(x0, x2);
+		vbr = _mm_sub_epi32(x0, x2);
+		vai = _mm_add_epi32(x1, x3);
+		vbi = _mm_sub_epi32(x1, x3);
+		vcr = _mm_add_epi32(x4, x6);
+		vdr = _mm_sub_epi32(x4, x6);
+		vci = _mm_add_epi32(x5, x7);
+		vdi = _mm_sub_epi32(x5, x7);
+
+		x0 = _mm_add_epi32(var, vcr);
+		x4 = _mm_sub_epi32(var, vcr);
+		x1 = _mm_add_epi32(vai, vci);
+		x5 = _mm_sub_epi32(vai, vci);
+		x2 = _mm_add_epi32(vbr, vdi);
+		x6 = _mm_sub_epi32(vbr, vdi);
+		x3 = _mm_sub_epi32(vbi, vdr);
+		x7 = _mm_add_epi32(vbi, vdr);
+
+		TRANSPOSE_X4(&x0, &x1, &x2, &x3);
+		TRANSPOSE_X4(&x4, &x5, &x6, &x7);
+		_mm_storeu_si128((__m128i *)(x +  0), x0);
+		_mm_storeu_si128((__m128i *)(x +  8), x1);
+		_mm_storeu_si128((__m128i *)(x + 16), x2);
+		_mm_storeu_si128((__m128i *)(x + 24), x3);
+		_mm_storeu_si128((__m128i *)(x +  4), x4);
+		_mm_storeu_si128((__m128i *)(x + 12), x5);
+		_mm_storeu_si128((__m128i *)(x + 20), x6);
+		_mm_storeu_si128((__m128i *)(x + 28), x7);
+
+		x += 32;
+	}
+#endif
 	
 	for (; bg != 0; bg--) {
 
@@ -160,6 +210,104 @@ static const int nfftlog2Tab[NUM_FFT_SIZES] PROGMEM = {6, 9};
 	int sr, si, tr, ti, ur, ui, vr, vi;
 	int wr, wi, xr, xi, yr, yi, zr, zi;
 
+#ifdef AAC_SIMD_SSE41
+	/* 4 butterflies per step, transposed so that lane k holds butterfly k, see C code below for scaling */
+	for (; bg >= 4; bg -= 4) {
+		__m128i v[16], sq;
+		__m128i var, vai, vbr, vbi, vcr, vci, vdr, vdi;
+		__m128i vsr, vsi, vtr, vti, vur, vui, vvr, vvi;
+		__m128i vwr, vwi, vxr, vxi, vyr, vyi, vzr, vzi;
+		int q;
+
+		for (q = 0; q < 4; q++) {
+			v[4*q+0] = _mm_loadu_si128((const __m128i *)(x + 4*q +  0));
+			v[4*q+1] = _mm_loadu_si128((const __m128i *)(x + 4*q + 16));
+			v[4*q+2] = _mm_loadu_si128((const __m128i *)(x + 4*q + 32));
+			v[4*q+3] = _mm_loadu_si128((const __m128i *)(x + 4*q + 48));
+			TRANSPOSE_X4(&v[4*q+0], &v[4*q+1], &v[4*q+2], &v[4*q+3]);
+		}
+
+		var = _mm_add_epi32(v[0], v[2]);
+		vbr = _mm_sub_epi32(v[0], v[2]);
+		vai = _mm_add_epi32(v[1], v[3]);
+		vbi = _mm_sub_epi32(v[1], v[3]);
+		vcr = _mm_add_epi32(v[4], v[6]);
+		vdr = _mm_sub_epi32(v[4], v[6]);
+		vci = _mm_add_epi32(v[5], v[7]);
+		vdi = _mm_sub_epi32(v[5], v[7]);
+
+		vsr = _mm_add_epi32(var, vcr);
+		vur = _mm_sub_epi32(var, vcr);
+		vsi = _mm_add_epi32(vai, vci);
+		vui = _mm_sub_epi32(vai, vci);
+		vtr = _mm_sub_epi32(vbr, vdi);
+		vvr = _mm_add_epi32(vbr, vdi);
+		vti = _mm_add_epi32(vbi, vdr);
+		vvi = _mm_sub_epi32(vbi, vdr);
+
+		var = _mm_add_epi32(v[ 8], v[10]);
+		vbr = _mm_sub_epi32(v[ 8], v[10]);
+		vai = _mm_add_epi32(v[ 9], v[11]);
+		vbi = _mm_sub_epi32(v[ 9], v[11]);
+		vcr = _mm_add_epi32(v[12], v[14]);
+		vdr = _mm_sub_epi32(v[12], v[14]);
+		vci = _mm_add_epi32(v[13], v[15]);
+		vdi = _mm_sub_epi32(v[13], v[15]);
+
+		vwr = _mm_srai_epi32(_mm_add_epi32(var, vcr), 1);
+		vyr = _mm_srai_epi32(_mm_sub_epi32(var, vcr), 1);
+		vwi = _mm_srai_epi32(_mm_add_epi32(vai, vci), 1);
+		vyi = _mm_srai_epi32(_mm_sub_epi32(vai, vci), 1);
+
+		vsr = _mm_srai_epi32(vsr, 1);
+		vsi = _mm_srai_epi32(vsi, 1);
+		vur = _mm_srai_epi32(vur, 1);
+		vui = _mm_srai_epi32(vui, 1);
+		v[ 0] = _mm_add_epi32(vsr, vwr);
+		v[ 8] = _mm_sub_epi32(vsr, vwr);
+		v[ 1] = _mm_add_epi32(vsi, vwi);
+		v[ 9] = _mm_sub_epi32(vsi, vwi);
+		v[ 4] = _mm_add_epi32(vur, vyi);
+		v[12] = _mm_sub_epi32(vur, vyi);
+		v[ 5] = _mm_sub_epi32(vui, vyr);
+		v[13] = _mm_add_epi32(vui, vyr);
+
+		var = _mm_sub_epi32(vbr, vdi);
+		vcr = _mm_add_epi32(vbr, vdi);
+		vai = _mm_add_epi32(vbi, vdr);
+		vci = _mm_sub_epi32(vbi, vdr);
+
+		sq = _mm_set1_epi32(SQRT1_2);
+		vxr = MULSHIFT32_X4(sq, _mm_sub_epi32(var, vai));
+		vxi = MULSHIFT32_X4(sq, _mm_add_epi32(var, vai));
+		vzr = MULSHIFT32_X4(sq, _mm_sub_epi32(vcr, vci));
+		vzi = MULSHIFT32_X4(sq, _mm_add_epi32(vcr, vci));
+
+		vtr = _mm_srai_epi32(vtr, 1);
+		vti = _mm_srai_epi32(vti, 1);
+		vvr = _mm_srai_epi32(vvr, 1);
+		vvi = _mm_srai_epi32(vvi, 1);
+		v[ 6] = _mm_sub_epi32(vtr, vxr);
+		v[14] = _mm_add_epi32(vtr, vxr);
+		v[ 7] = _mm_sub_epi32(vti, vxi);
+		v[15] = _mm_add_epi32(vti, vxi);
+		v[ 2] = _mm_add_epi32(vvr, vzi);
+		v[10] = _mm_sub_epi32(vvr, vzi);
+		v[ 3] = _mm_sub_epi32(vvi, vzr);
+		v[11] = _mm_add_epi32(vvi, vzr);
+
+		for (q = 0; q < 4; q++) {
+			TRANSPOSE_X4(&v[4*q+0], &v[4*q+1], &v[4*q+2], &v[4*q+3]);
+			_mm_storeu_si128((__m128i *)(x + 4*q +  0), v[4*q+0]);
+			_mm_storeu_si128((__m128i *)(x + 4*q + 16), v[4*q+1]);
+			_mm_storeu_si128((__m128i *)(x + 4*q + 32), v[4*q+2]);
+			_mm_storeu_si128((__m128i *)(x + 4*q + 48), v[4*q+3]);
+		}
+
+		x += 64;
+	}
+#endif
+
 	for (; bg != 0; bg--) {
 
 		ar = x[0] + x[2];
@@ -282,8 +430,102 @@ static const int nfftlog2Tab[NUM_FFT_SIZES] PROGMEM = {6, 9};
 		for (i = bg; i != 0; i--) {
 
 			wptr = wtab;
+			j = gp;
+
+#ifdef AAC_SIMD_SSE41
+			/* 4 butterflies per step (gp is a multiple of 4 for both transform sizes) */
+			for (; j >= 4; j -= 4) {
+				__m128i a0, a1, w0, w1, w2, w3, w4, w5, p, q;
+				__m128i var, vai, vbr, vbi, vcr, vci, vdr, vdi, vtr, vti, vwd, vws, vwi;
+
+				/* twiddles for 4 butterflies are stored as 4 x (b, c, d) x (ws, wi) */
+				w0 = _mm_loadu_si128((const __m128i *)(wptr +  0));
+				w1 = _mm_loadu_si128((const __m128i *)(wptr +  4));
+				w2 = _mm_loadu_si128((const __m128i *)(wptr +  8));
+				w3 = _mm_loadu_si128((const __m128i *)(wptr + 12));
+				w4 = _mm_loadu_si128((const __m128i *)(wptr + 16));
+				w5 = _mm_loadu_si128((const __m128i *)(wptr + 20));
+				wptr += 24;
+
+				a0 = _mm_loadu_si128((const __m128i *)(xptr + 0));
+				a1 = _mm_loadu_si128((const __m128i *)(xptr + 4));
+				var = EVEN_X4(a0, a1);
+				vai = ODD_X4(a0, a1);
+
+				p = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(w0), _mm_castsi128_ps(w1), _MM_SHUFFLE(3,2,1,0)));
+				q = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(w3), _mm_castsi128_ps(w4), _MM_SHUFFLE(3,2,1,0)));
+				vws = EVEN_X4(p, q);
+				vwi = ODD_X4(p, q);
+				a0 = _mm_loadu_si128((const __m128i *)(xptr + step + 0));
+				a1 = _mm_loadu_si128((const __m128i *)(xptr + step + 4));
+				vbr = EVEN_X4(a0, a1);
+				vbi = ODD_X4(a0, a1);
+				vwd = _mm_add_epi32(vws, _mm_slli_epi32(vwi, 1));
+				vtr = MULSHIFT32_X4(vwi, _mm_add_epi32(vbr, vbi));
+				vbr = _mm_sub_epi32(MULSHIFT32_X4(vwd, vbr), vtr);
+				vbi = _mm_add_epi32(MULSHIFT32_X4(vws, vbi), vtr);
+
+				p = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(w0), _mm_castsi128_ps(w2), _MM_SHUFFLE(1,0,3,2)));
+				q = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(w3), _mm_castsi128_ps(w5), _MM_SHUFFLE(1,0,3,2)));
+				vws = EVEN_X4(p, q);
+				vwi = ODD_X4(p, q);
+				a0 = _mm_loadu_si128((const __m128i *)(xptr + 2*step + 0));
+				a1 = _mm_loadu_si128((const __m128i *)(xptr + 2*step + 4));
+				vcr = EVEN_X4(a0, a1);
+				vci = ODD_X4(a0, a1);
+				vwd = _mm_add_epi32(vws, _mm_slli_epi32(vwi, 1));
+				vtr = MULSHIFT32_X4(vwi, _mm_add_epi32(vcr, vci));
+				vcr = _mm_sub_epi32(MULSHIFT32_X4(vwd, vcr), vtr);
+				vci = _mm_add_epi32(MULSHIFT32_X4(vws, vci), vtr);
+
+				p = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(w1), _mm_castsi128_ps(w2), _MM_SHUFFLE(3,2,1,0)));
+				q = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(w4), _mm_castsi128_ps(w5), _MM_SHUFFLE(3,2,1,0)));
+				vws = EVEN_X4(p, q);
+				vwi = ODD_X4(p, q);
+				a0 = _mm_loadu_si128((const __m128i *)(xptr + 3*step + 0));
+				a1 = _mm_loadu_si128((const __m128i *)(xptr + 3*step + 4));
+				vdr = EVEN_X4(a0, a1);
+				vdi = ODD_X4(a0, a1);
+				vwd = _mm_add_epi32(vws, _mm_slli_epi32(vwi, 1));
+				vtr = MULSHIFT32_X4(vwi, _mm_add_epi32(vdr, vdi));
+				vdr = _mm_sub_epi32(MULSHIFT32_X4(vwd, vdr), vtr);
+				vdi = _mm_add_epi32(MULSHIFT32_X4(vws, vdi), vtr);
+
+				vtr = _mm_srai_epi32(var, 2);
+				vti = _mm_srai_epi32(vai, 2);
+				var = _mm_sub_epi32(vtr, vbr);
+				vai = _mm_sub_epi32(vti, vbi);
+				vbr = _mm_add_epi32(vtr, vbr);
+				vbi = _mm_add_epi32(vti, vbi);
+
+				vtr = vcr;
+				vti = vci;
+				vcr = _mm_add_epi32(vtr, vdr);
+				vci = _mm_sub_epi32(vdi, vti);
+				vdr = _mm_sub_epi32(vtr, vdr);
+				vdi = _mm_add_epi32(vdi, vti);
+
+				p = _mm_add_epi32(var, vci);
+				q = _mm_add_epi32(vai, vdr);
+				_mm_storeu_si128((__m128i *)(xptr + 3*step + 0), _mm_unpacklo_epi32(p, q));
+				_mm_storeu_si128((__m128i *)(xptr + 3*step + 4), _mm_unpackhi_epi32(p, q));
+				p = _mm_sub_epi32(vbr, vcr);
+				q = _mm_sub_epi32(vbi, vdi);
+				_mm_storeu_si128((__m128i *)(xptr + 2*step + 0), _mm_unpacklo_epi32(p, q));
+				_mm_storeu_si128((__m128i *)(xptr + 2*step + 4), _mm_unpackhi_epi32(p, q));
+				p = _mm_sub_epi32(var, vci);
+				q = _mm_sub_epi32(vai, vdr);
+				_mm_storeu_si128((__m128i *)(xptr + step + 0), _mm_unpacklo_epi32(p, q));
+				_mm_storeu_si128((__m128i *)(xptr + step + 4), _mm_unpackhi_epi32(p, q));
+				p = _mm_add_epi32(vbr, vcr);
+				q = _mm_add_epi32(vbi, vdi);
+				_mm_storeu_si128((__m128i *)(xptr + 0), _mm_unpacklo_epi32(p, q));
+				_mm_storeu_si128((__m128i *)(xptr + 4), _mm_unpackhi_epi32(p, q));
+				xptr += 8;
+			}
+#endif
 
-			for (j = gp; j != 0; j--) {
+			for (; j != 0; j--) {
 
 				ar = xptr[0];
 				ai = xptr[1];
@@ -391,3 +633,175 @@ void R4FFT(int tabidx, int *x)
 		R4Core(x, nfft >> 4, 4, (int *)twidTabEven);	/* gain 4 int bits, lose 1 GB */
 	}
 }
+
+#ifdef AAC_SIMD_SSE41
+/**************************************************************************************
+ * Function:    BitReverseX4, R4FirstPassX4, R4CoreX4
+ *
+ * Description: same as BitReverse, R4FirstPass and R4Core for 4 transforms in parallel
+ *
+ * Inputs:      buffer of samples, one transform per lane (sample k of all 4 transforms in x[k])
+ *              other parameters as in the C versions
+ *
+ * Outputs:     processed samples in same buffer
+ *
+ * Return:      none
+ *
+ * Notes:       every int of the C code is a vector of 4 ints, so the results are 
+ *                bit-exact with 4 separate transforms
+ **************************************************************************************/
+static void BitReverseX4(__m128i *inout, int tabidx)
+{
+	__m128i *part0, *part1;
+	__m128i t, t1;
+	int a, b;
+	const unsigned char* tab = bitrevtab + bitrevtabOffset[tabidx];
+	int nbits = nfftlog2Tab[tabidx];
+
+	part0 = inout;
+	part1 = inout + (1 << nbits);
+
+	while ((a = pgm_read_byte(tab++)) != 0) {
+		b = pgm_read_byte(tab++);
+
+		swapcplx(part0[4*a+0], part0[4*b+0]);
+		swapcplx(part0[4*a+2], part1[4*b+0]);
+		swapcplx(part1[4*a+0], part0[4*b+2]);
+		swapcplx(part1[4*a+2], part1[4*b+2]);
+	}
+
+	do {
+		swapcplx(part0[4*a+2], part1[4*a+0]);
+	} while ((a = pgm_read_byte(tab++)) != 0);
+}
+
+static void R4FirstPassX4(__m128i *x, int bg)
+{
+	__m128i ar, ai, br, bi, cr, ci, dr, di;
+
+	for (; bg != 0; bg--) {
+		ar = _mm_add_epi32(x[0], x[2]);
+		br = _mm_sub_epi32(x[0], x[2]);
+		ai = _mm_add_epi32(x[1], x[3]);
+		bi = _mm_sub_epi32(x[1], x[3]);
+		cr = _mm_add_epi32(x[4], x[6]);
+		dr = _mm_sub_epi32(x[4], x[6]);
+		ci = _mm_add_epi32(x[5], x[7]);
+		di = _mm_sub_epi32(x[5], x[7]);
+
+		x[0] = _mm_add_epi32(ar, cr);
+		x[4] = _mm_sub_epi32(ar, cr);
+		x[1] = _mm_add_epi32(ai, ci);
+		x[5] = _mm_sub_epi32(ai, ci);
+		x[2] = _mm_add_epi32(br, di);
+		x[6] = _mm_sub_epi32(br, di);
+		x[3] = _mm_sub_epi32(bi, dr);
+		x[7] = _mm_add_epi32(bi, dr);
+
+		x += 8;
+	}
+}
+
+static void R4CoreX4(__m128i *x, int bg, int gp, const int *wtab)
+{
+	__m128i ar, ai, br, bi, cr, ci, dr, di, tr, ti;
+	int wd, ws, wi;
+	int i, j, step;
+	__m128i *xptr;
+	const int *wptr;
+
+	for (; bg != 0; gp <<= 2, bg >>= 2) {
+
+		step = 2*gp;
+		xptr = x;
+
+		for (i = bg; i != 0; i--) {
+
+			wptr = wtab;
+
+			for (j = gp; j != 0; j--) {
+				ar = xptr[0];
+				ai = xptr[1];
+
+				ws = wptr[0];
+				wi = wptr[1];
+				wd = ws + 2*wi;
+				br = xptr[step];
+				bi = xptr[step+1];
+				tr = MULSHIFT32_C4(wi, _mm_add_epi32(br, bi));
+				br = _mm_sub_epi32(MULSHIFT32_C4(wd, br), tr);
+				bi = _mm_add_epi32(MULSHIFT32_C4(ws, bi), tr);
+
+				ws = wptr[2];
+				wi = wptr[3];
+				wd = ws + 2*wi;
+				cr = xptr[2*step];
+				ci = xptr[2*step+1];
+				tr = MULSHIFT32_C4(wi, _mm_add_epi32(cr, ci));
+				cr = _mm_sub_epi32(MULSHIFT32_C4(wd, cr), tr);
+				ci = _mm_add_epi32(MULSHIFT32_C4(ws, ci), tr);
+
+				ws = wptr[4];
+				wi = wptr[5];
+				wd = ws + 2*wi;
+				dr = xptr[3*step];
+				di = xptr[3*step+1];
+				tr = MULSHIFT32_C4(wi, _mm_add_epi32(dr, di));
+				dr = _mm_sub_epi32(MULSHIFT32_C4(wd, dr), tr);
+				di = _mm_add_epi32(MULSHIFT32_C4(ws, di), tr);
+				wptr += 6;
+
+				tr = _mm_srai_epi32(ar, 2);
+				ti = _mm_srai_epi32(ai, 2);
+				ar = _mm_sub_epi32(tr, br);
+				ai = _mm_sub_epi32(ti, bi);
+				br = _mm_add_epi32(tr, br);
+				bi = _mm_add_epi32(ti, bi);
+
+				tr = cr;
+				ti = ci;
+				cr = _mm_add_epi32(tr, dr);
+				ci = _mm_sub_epi32(di, ti);
+				dr = _mm_sub_epi32(tr, dr);
+				di = _mm_add_epi32(di, ti);
+
+				xptr[3*step]   = _mm_add_epi32(ar, ci);
+				xptr[3*step+1] = _mm_add_epi32(ai, dr);
+				xptr[2*step]   = _mm_sub_epi32(br, cr);
+				xptr[2*step+1] = _mm_sub_epi32(bi, di);
+				xptr[step]     = _mm_sub_epi32(ar, ci);
+				xptr[step+1]   = _mm_sub_epi32(ai, dr);
+				xptr[0]        = _mm_add_epi32(br, cr);
+				xptr[1]        = _mm_add_epi32(bi, di);
+				xptr += 2;
+			}
+			xptr += 3*step;
+		}
+		wtab += 3*step;
+	}
+}
+
+/**************************************************************************************
+ * Function:    R4FFTShortX4
+ *
+ * Description: R4FFT of 4 short blocks in parallel
+ *
+ * Inputs:      16-byte aligned buffer of 4 interleaved transforms 
+ *                (x[4*k + n] = sample k of transform n, non bit-reversed)
+ *
+ * Outputs:     processed samples in same buffer
+ *
+ * Return:      none
+ *
+ * Notes:       same scaling as R4FFT
+ **************************************************************************************/
+void R4FFTShortX4(int *x)
+{
+	__m128i *xv = (__m128i *)x;
+	int nfft = nfftTab[0];
+
+	BitReverseX4(xv, 0);
+	R4FirstPassX4(xv, nfft >> 2);
+	R4CoreX4(xv, nfft >> 4, 4, twidTabEven);
+}
+#endif
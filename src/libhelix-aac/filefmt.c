@@ -43,6 +43,7 @@
  * filefmt.c - ADIF and ADTS header decoding, raw block handling
  **************************************************************************************/
 
+#include <stddef.h>
 #include "coder.h"
 
  /**************************************************************************************
@@ -494,3 +495,34 @@ int FlushCodec(AACDecInfo *aacDecInfo)
 
 	return ERR_AAC_NONE;
 }
+
+/**************************************************************************************
+ * Function:    ResetCodec
+ *
+ * Description: return codec state to that of a newly allocated decoder (new stream)
+ *
+ * Inputs:      valid AACDecInfo struct
+ *
+ * Outputs:     cleared header info and inter-frame state in PSInfoBase
+ *
+ * Return:      0 if successful, error code (< 0) if error
+ *
+ * Notes:       header info (ADTS, ADIF, PCE, fill data) sits at the start of
+ *                PSInfoBase, per-element work buffers are rewritten for every frame
+ *                and are not cleared
+ **************************************************************************************/
+int ResetCodec(AACDecInfo *aacDecInfo)
+{
+	PSInfoBase *psi;
+
+	/* validate pointers */
+	if (!aacDecInfo || !aacDecInfo->psInfoBase)
+		return ERR_AAC_NULL_POINTER;
+	psi = (PSInfoBase *)(aacDecInfo->psInfoBase);
+
+	ClearBuffer(psi, offsetof(PSInfoBase, icsInfo));
+	psi->pnsLastVal = 0;
+	psi->pnsCount = 0;
+
+	return FlushCodec(aacDecInfo);
+}
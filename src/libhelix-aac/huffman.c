@@ -89,6 +89,40 @@
 	return (countPtr - huffTabInfo->count);
 }
 
+#if AAC_USE_HUFF_LOOKUP
+/**************************************************************************************
+ * Function:    DecodeHuffmanLookup
+ *
+ * Description: decode one Huffman symbol from bitstream with a two-level lookup table
+ *
+ * Inputs:      pointer to the lookup table of the codebook
+ *              pointer to the symbol table of the codebook
+ *              left-aligned bitbuffer with >= maxBits bits of the codebook
+ *
+ * Outputs:     decoded symbol (*val)
+ *
+ * Return:      number of bits in symbol
+ *
+ * Notes:       the first HUFF_LOOKUP_BITS bits index the first level: an entry is either
+ *                the code length (bits 14-10) and the symbol index (bits 9-0), or a
+ *                pointer (bit 15 set) to a second level table with 2^n entries
+ *                (n = bits 14-11, offset = bits 10-0) which is indexed by the next n bits
+ *              the symbol index refers to the same table as in DecodeHuffmanScalar,
+ *                so the packed quads and pairs are unchanged
+ **************************************************************************************/
+int DecodeHuffmanLookup(const unsigned short *lookTab, const signed short *huffTab, unsigned int bitBuf, signed int *val)
+{
+	unsigned int e;
+
+	e = pgm_read_word(&lookTab[bitBuf >> (32 - HUFF_LOOKUP_BITS)]);
+	if (e & 0x8000)
+		e = pgm_read_word(&lookTab[(e & 0x07ff) + ((bitBuf << HUFF_LOOKUP_BITS) >> (32 - ((e >> 11) & 0x0f)))]);
+
+	*val = (signed int)pgm_read_word(&huffTab[e & 0x03ff]);
+	return (int)((e >> 10) & 0x1f);
+}
+#endif
+
 #define APPLY_SIGN(v, s)		{(v) ^= ((signed int)(s) >> 31); (v) -= ((signed int)(s) >> 31);}
 
 #define GET_QUAD_SIGNBITS(v)	(((unsigned int)(v) << 17) >> 29)	/* bits 14-12, unsigned */
@@ -150,12 +184,20 @@ static void UnpackZeros(int nVals, int *coef)
 {
 	int w, x, y, z, maxBits, nCodeBits, nSignBits, val;
 	unsigned int bitBuf;
+#if AAC_USE_HUFF_LOOKUP
+	const unsigned short *lookTab = huffLookSpec + huffLookSpecOffset[cb - HUFFTAB_SPEC_OFFSET];
+	const signed short *huffTab = huffTabSpec + huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET].offset;
+#endif
 
 	maxBits = huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET].maxBits + 4;
 	while (nVals > 0) {
 		/* decode quad */
 		bitBuf = GetBitsNoAdvance(bsi, maxBits) << (32 - maxBits);
+#if AAC_USE_HUFF_LOOKUP
+		nCodeBits = DecodeHuffmanLookup(lookTab, huffTab, bitBuf, &val);
+#else
 		nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+#endif
 
 		w = GET_QUAD_W(val);
 		x = GET_QUAD_X(val);
@@ -197,12 +239,20 @@ static void UnpackZeros(int nVals, int *coef)
 {
 	int y, z, maxBits, nCodeBits, nSignBits, val;
 	unsigned int bitBuf;
+#if AAC_USE_HUFF_LOOKUP
+	const unsigned short *lookTab = huffLookSpec + huffLookSpecOffset[cb - HUFFTAB_SPEC_OFFSET];
+	const signed short *huffTab = huffTabSpec + huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET].offset;
+#endif
 
 	maxBits = huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET].maxBits + 2;
 	while (nVals > 0) {
 		/* decode pair */
 		bitBuf = GetBitsNoAdvance(bsi, maxBits) << (32 - maxBits);
+#if AAC_USE_HUFF_LOOKUP
+		nCodeBits = DecodeHuffmanLookup(lookTab, huffTab, bitBuf, &val);
+#else
 		nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb-HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+#endif
 
 		y = GET_PAIR_Y(val);
 		z = GET_PAIR_Z(val);
@@ -240,12 +290,20 @@ static void UnpackZeros(int nVals, int *coef)
 {
 	int y, z, maxBits, nCodeBits, nSignBits, n, val;
 	unsigned int bitBuf;
+#if AAC_USE_HUFF_LOOKUP
+	const unsigned short *lookTab = huffLookSpec + huffLookSpecOffset[cb - HUFFTAB_SPEC_OFFSET];
+	const signed short *huffTab = huffTabSpec + huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET].offset;
+#endif
 
 	maxBits = huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET].maxBits + 2;
 	while (nVals > 0) {
 		/* decode pair with escape value */
 		bitBuf = GetBitsNoAdvance(bsi, maxBits) << (32 - maxBits);
+#if AAC_USE_HUFF_LOOKUP
+		nCodeBits = DecodeHuffmanLookup(lookTab, huffTab, bitBuf, &val);
+#else
 		nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb-HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+#endif
 
 		y = GET_ESC_Y(val);
 		z = GET_ESC_Z(val);
@@ -175,3 +175,531 @@ const signed short huffTabScaleFact[121] PROGMEM = {
 	 -45,  -44,  -42,  -40,  -43,  -49,  -48,  -46,  -47,
 };
 
+
+#if AAC_USE_HUFF_LOOKUP
+
+/* direct lookup tables for the canonical codes above (see DecodeHuffmanLookup):
+ *   first level indexed by the next HUFF_LOOKUP_BITS bits, followed by the second levels for longer codes
+ *   0lllllssssssssss = code of length l for symbol s (index into the symbol table)
+ *   1nnnnooooooooooo = longer code, look up the next n bits in the second level at offset o
+ */
+const int huffLookSpecOffset[11] PROGMEM = {0, 536, 1048, 1718, 2260, 2824, 3348, 3890, 4406, 5102, 5686};
+
+const unsigned short huffLookSpec[6344] PROGMEM = {
+	/* spectrum table 1 [536] */
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x1401, 0x1401, 0x1401, 0x1401, 0x1401, 0x1401, 0x1401, 0x1401, 0x1401, 0x1401, 0x1401, 0x1401, 0x1401, 0x1401, 0x1401, 0x1401, 
+	0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 
+	0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 
+	0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 
+	0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 
+	0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 
+	0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 
+	0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 
+	0x1c09, 0x1c09, 0x1c09, 0x1c09, 0x1c0a, 0x1c0a, 0x1c0a, 0x1c0a, 0x1c0b, 0x1c0b, 0x1c0b, 0x1c0b, 0x1c0c, 0x1c0c, 0x1c0c, 0x1c0c, 
+	0x1c0d, 0x1c0d, 0x1c0d, 0x1c0d, 0x1c0e, 0x1c0e, 0x1c0e, 0x1c0e, 0x1c0f, 0x1c0f, 0x1c0f, 0x1c0f, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 
+	0x1c11, 0x1c11, 0x1c11, 0x1c11, 0x1c12, 0x1c12, 0x1c12, 0x1c12, 0x1c13, 0x1c13, 0x1c13, 0x1c13, 0x1c14, 0x1c14, 0x1c14, 0x1c14, 
+	0x1c15, 0x1c15, 0x1c15, 0x1c15, 0x1c16, 0x1c16, 0x1c16, 0x1c16, 0x1c17, 0x1c17, 0x1c17, 0x1c17, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 
+	0x1c19, 0x1c19, 0x1c19, 0x1c19, 0x1c1a, 0x1c1a, 0x1c1a, 0x1c1a, 0x1c1b, 0x1c1b, 0x1c1b, 0x1c1b, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 
+	0x1c1d, 0x1c1d, 0x1c1d, 0x1c1d, 0x1c1e, 0x1c1e, 0x1c1e, 0x1c1e, 0x1c1f, 0x1c1f, 0x1c1f, 0x1c1f, 0x1c20, 0x1c20, 0x1c20, 0x1c20, 
+	0x2421, 0x2422, 0x2423, 0x2424, 0x2425, 0x2426, 0x2427, 0x2428, 0x2429, 0x242a, 0x242b, 0x242c, 0x242d, 0x242e, 0x242f, 0x2430, 
+	0x2431, 0x2432, 0x2433, 0x2434, 0x2435, 0x2436, 0x2437, 0x2438, 0x8a00, 0x8a02, 0x8a04, 0x8a06, 0x9208, 0x920c, 0x9210, 0x9214, 
+	0x2839, 0x283a, 0x283b, 0x283c, 0x283d, 0x283e, 0x283f, 0x2840, 0x2c41, 0x2c42, 0x2c43, 0x2c44, 0x2c45, 0x2c46, 0x2c47, 0x2c48, 
+	0x2c49, 0x2c4a, 0x2c4b, 0x2c4c, 0x2c4d, 0x2c4e, 0x2c4f, 0x2c50, 
+	/* spectrum table 2 [512] */
+	0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 
+	0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 
+	0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 
+	0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 
+	0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 
+	0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 
+	0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 
+	0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 
+	0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 
+	0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 
+	0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 
+	0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 
+	0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 
+	0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 
+	0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 
+	0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 
+	0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 
+	0x1817, 0x1817, 0x1817, 0x1817, 0x1817, 0x1817, 0x1817, 0x1817, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 
+	0x1819, 0x1819, 0x1819, 0x1819, 0x1819, 0x1819, 0x1819, 0x1819, 0x181a, 0x181a, 0x181a, 0x181a, 0x181a, 0x181a, 0x181a, 0x181a, 
+	0x181b, 0x181b, 0x181b, 0x181b, 0x181b, 0x181b, 0x181b, 0x181b, 0x181c, 0x181c, 0x181c, 0x181c, 0x181c, 0x181c, 0x181c, 0x181c, 
+	0x181d, 0x181d, 0x181d, 0x181d, 0x181d, 0x181d, 0x181d, 0x181d, 0x181e, 0x181e, 0x181e, 0x181e, 0x181e, 0x181e, 0x181e, 0x181e, 
+	0x181f, 0x181f, 0x181f, 0x181f, 0x181f, 0x181f, 0x181f, 0x181f, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 
+	0x1c21, 0x1c21, 0x1c21, 0x1c21, 0x1c22, 0x1c22, 0x1c22, 0x1c22, 0x1c23, 0x1c23, 0x1c23, 0x1c23, 0x1c24, 0x1c24, 0x1c24, 0x1c24, 
+	0x1c25, 0x1c25, 0x1c25, 0x1c25, 0x1c26, 0x1c26, 0x1c26, 0x1c26, 0x1c27, 0x1c27, 0x1c27, 0x1c27, 0x1c28, 0x1c28, 0x1c28, 0x1c28, 
+	0x1c29, 0x1c29, 0x1c29, 0x1c29, 0x1c2a, 0x1c2a, 0x1c2a, 0x1c2a, 0x1c2b, 0x1c2b, 0x1c2b, 0x1c2b, 0x1c2c, 0x1c2c, 0x1c2c, 0x1c2c, 
+	0x1c2d, 0x1c2d, 0x1c2d, 0x1c2d, 0x1c2e, 0x1c2e, 0x1c2e, 0x1c2e, 0x1c2f, 0x1c2f, 0x1c2f, 0x1c2f, 0x2030, 0x2030, 0x2031, 0x2031, 
+	0x2032, 0x2032, 0x2033, 0x2033, 0x2034, 0x2034, 0x2035, 0x2035, 0x2036, 0x2036, 0x2037, 0x2037, 0x2038, 0x2038, 0x2039, 0x2039, 
+	0x203a, 0x203a, 0x203b, 0x203b, 0x203c, 0x203c, 0x203d, 0x203d, 0x203e, 0x203e, 0x203f, 0x203f, 0x2040, 0x2040, 0x2041, 0x2041, 
+	0x2042, 0x2042, 0x2443, 0x2444, 0x2445, 0x2446, 0x2447, 0x2448, 0x2449, 0x244a, 0x244b, 0x244c, 0x244d, 0x244e, 0x244f, 0x2450, 
+	/* spectrum table 3 [670] */
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 
+	0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 
+	0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 
+	0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 
+	0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1808, 0x1808, 0x1808, 0x1808, 0x1808, 0x1808, 0x1808, 0x1808, 
+	0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 
+	0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 
+	0x1c0d, 0x1c0d, 0x1c0d, 0x1c0d, 0x1c0e, 0x1c0e, 0x1c0e, 0x1c0e, 0x1c0f, 0x1c0f, 0x1c0f, 0x1c0f, 0x2010, 0x2010, 0x2011, 0x2011, 
+	0x2012, 0x2012, 0x2013, 0x2013, 0x2014, 0x2014, 0x2415, 0x2416, 0x2417, 0x2418, 0x2419, 0x241a, 0x241b, 0x241c, 0x241d, 0x241e, 
+	0x241f, 0x2420, 0x2421, 0x2422, 0x2423, 0x8a00, 0x8a02, 0x8a04, 0x8a06, 0x8a08, 0x8a0a, 0x8a0c, 0x920e, 0x9212, 0x9a16, 0xba1e, 
+	0x2824, 0x2825, 0x2826, 0x2827, 0x2828, 0x2829, 0x282a, 0x282b, 0x282c, 0x282d, 0x282e, 0x282f, 0x2830, 0x2831, 0x2832, 0x2832, 
+	0x2c33, 0x2c34, 0x2c35, 0x2c36, 0x2c37, 0x2c38, 0x2c39, 0x2c39, 0x2c3a, 0x2c3a, 0x303b, 0x303c, 0x303d, 0x303e, 0x303f, 0x303f, 
+	0x303f, 0x303f, 0x303f, 0x303f, 0x303f, 0x303f, 0x303f, 0x303f, 0x303f, 0x303f, 0x303f, 0x303f, 0x303f, 0x303f, 0x3040, 0x3040, 
+	0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3041, 0x3041, 
+	0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3042, 0x3042, 
+	0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3043, 0x3043, 
+	0x3043, 0x3043, 0x3043, 0x3043, 0x3043, 0x3043, 0x3043, 0x3043, 0x3043, 0x3043, 0x3043, 0x3043, 0x3043, 0x3043, 0x3444, 0x3444, 
+	0x3444, 0x3444, 0x3444, 0x3444, 0x3444, 0x3444, 0x3445, 0x3445, 0x3445, 0x3445, 0x3445, 0x3445, 0x3445, 0x3445, 0x3446, 0x3446, 
+	0x3446, 0x3446, 0x3446, 0x3446, 0x3446, 0x3446, 0x3847, 0x3847, 0x3847, 0x3847, 0x3848, 0x3848, 0x3848, 0x3848, 0x3849, 0x3849, 
+	0x3849, 0x3849, 0x3c4a, 0x3c4a, 0x3c4b, 0x3c4b, 0x3c4c, 0x3c4c, 0x3c4d, 0x3c4d, 0x3c4e, 0x3c4e, 0x404f, 0x4050, 
+	/* spectrum table 4 [542] */
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 
+	0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 
+	0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 
+	0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 
+	0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 
+	0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 
+	0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 
+	0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 
+	0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 
+	0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 
+	0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 
+	0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 0x1009, 
+	0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 
+	0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 
+	0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 
+	0x140d, 0x140d, 0x140d, 0x140d, 0x140d, 0x140d, 0x140d, 0x140d, 0x140d, 0x140d, 0x140d, 0x140d, 0x140d, 0x140d, 0x140d, 0x140d, 
+	0x140e, 0x140e, 0x140e, 0x140e, 0x140e, 0x140e, 0x140e, 0x140e, 0x140e, 0x140e, 0x140e, 0x140e, 0x140e, 0x140e, 0x140e, 0x140e, 
+	0x140f, 0x140f, 0x140f, 0x140f, 0x140f, 0x140f, 0x140f, 0x140f, 0x140f, 0x140f, 0x140f, 0x140f, 0x140f, 0x140f, 0x140f, 0x140f, 
+	0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c11, 0x1c11, 0x1c11, 0x1c11, 0x1c12, 0x1c12, 0x1c12, 0x1c12, 0x1c13, 0x1c13, 0x1c13, 0x1c13, 
+	0x1c14, 0x1c14, 0x1c14, 0x1c14, 0x1c15, 0x1c15, 0x1c15, 0x1c15, 0x1c16, 0x1c16, 0x1c16, 0x1c16, 0x1c17, 0x1c17, 0x1c17, 0x1c17, 
+	0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x2019, 0x2019, 0x201a, 0x201a, 0x201b, 0x201b, 0x201c, 0x201c, 0x201d, 0x201d, 0x201e, 0x201e, 
+	0x201f, 0x201f, 0x2020, 0x2020, 0x2021, 0x2021, 0x2022, 0x2022, 0x2023, 0x2023, 0x2024, 0x2024, 0x2025, 0x2025, 0x2026, 0x2026, 
+	0x2027, 0x2027, 0x2028, 0x2028, 0x2029, 0x2029, 0x202a, 0x202a, 0x202b, 0x202b, 0x202c, 0x202c, 0x202d, 0x202d, 0x242e, 0x242f, 
+	0x2430, 0x2431, 0x2432, 0x2433, 0x2434, 0x2435, 0x8a00, 0x8a02, 0x8a04, 0x8a06, 0x8a08, 0x8a0a, 0x8a0c, 0x920e, 0x9212, 0x9a16, 
+	0x2836, 0x2837, 0x2838, 0x2839, 0x283a, 0x283b, 0x283c, 0x283d, 0x283e, 0x283f, 0x2840, 0x2841, 0x2842, 0x2843, 0x2c44, 0x2c45, 
+	0x2c46, 0x2c47, 0x2c48, 0x2c49, 0x2c4a, 0x2c4b, 0x2c4c, 0x2c4c, 0x2c4d, 0x2c4d, 0x2c4e, 0x2c4e, 0x304f, 0x3050, 
+	/* spectrum table 5 [564] */
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 
+	0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 
+	0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 
+	0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 
+	0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 
+	0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 
+	0x1c09, 0x1c09, 0x1c09, 0x1c09, 0x1c0a, 0x1c0a, 0x1c0a, 0x1c0a, 0x1c0b, 0x1c0b, 0x1c0b, 0x1c0b, 0x1c0c, 0x1c0c, 0x1c0c, 0x1c0c, 
+	0x200d, 0x200d, 0x200e, 0x200e, 0x200f, 0x200f, 0x2010, 0x2010, 0x2011, 0x2011, 0x2012, 0x2012, 0x2013, 0x2013, 0x2014, 0x2014, 
+	0x2015, 0x2015, 0x2016, 0x2016, 0x2017, 0x2017, 0x2018, 0x2018, 0x2419, 0x241a, 0x241b, 0x241c, 0x241d, 0x241e, 0x241f, 0x2420, 
+	0x2421, 0x2422, 0x2423, 0x2424, 0x8a00, 0x8a02, 0x8a04, 0x8a06, 0x8a08, 0x8a0a, 0x920c, 0x9210, 0x9214, 0x9218, 0x9a1c, 0xa224, 
+	0x2825, 0x2826, 0x2827, 0x2828, 0x2829, 0x282a, 0x282b, 0x282c, 0x282d, 0x282e, 0x282f, 0x2830, 0x2c31, 0x2c32, 0x2c33, 0x2c34, 
+	0x2c35, 0x2c36, 0x2c37, 0x2c38, 0x2c39, 0x2c3a, 0x2c3b, 0x2c3c, 0x2c3d, 0x2c3e, 0x2c3f, 0x2c40, 0x2c41, 0x2c41, 0x2c42, 0x2c42, 
+	0x3043, 0x3044, 0x3045, 0x3046, 0x3047, 0x3047, 0x3048, 0x3048, 0x3049, 0x3049, 0x304a, 0x304a, 0x304b, 0x304b, 0x304c, 0x304c, 
+	0x344d, 0x344e, 0x344f, 0x3450, 
+	/* spectrum table 6 [524] */
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 
+	0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 
+	0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 
+	0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 
+	0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 
+	0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 0x1006, 
+	0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 
+	0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 
+	0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 
+	0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 0x1008, 
+	0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 
+	0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 
+	0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 
+	0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 
+	0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 
+	0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 
+	0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 
+	0x1817, 0x1817, 0x1817, 0x1817, 0x1817, 0x1817, 0x1817, 0x1817, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 
+	0x1c19, 0x1c19, 0x1c19, 0x1c19, 0x1c1a, 0x1c1a, 0x1c1a, 0x1c1a, 0x1c1b, 0x1c1b, 0x1c1b, 0x1c1b, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 
+	0x1c1d, 0x1c1d, 0x1c1d, 0x1c1d, 0x1c1e, 0x1c1e, 0x1c1e, 0x1c1e, 0x1c1f, 0x1c1f, 0x1c1f, 0x1c1f, 0x1c20, 0x1c20, 0x1c20, 0x1c20, 
+	0x1c21, 0x1c21, 0x1c21, 0x1c21, 0x1c22, 0x1c22, 0x1c22, 0x1c22, 0x1c23, 0x1c23, 0x1c23, 0x1c23, 0x1c24, 0x1c24, 0x1c24, 0x1c24, 
+	0x1c25, 0x1c25, 0x1c25, 0x1c25, 0x2026, 0x2026, 0x2027, 0x2027, 0x2028, 0x2028, 0x2029, 0x2029, 0x202a, 0x202a, 0x202b, 0x202b, 
+	0x202c, 0x202c, 0x202d, 0x202d, 0x242e, 0x242f, 0x2430, 0x2431, 0x2432, 0x2433, 0x2434, 0x2435, 0x2436, 0x2437, 0x2438, 0x2439, 
+	0x243a, 0x243b, 0x243c, 0x243d, 0x243e, 0x243f, 0x2440, 0x2441, 0x2442, 0x2443, 0x2444, 0x8a00, 0x8a02, 0x8a04, 0x8a06, 0x9208, 
+	0x2845, 0x2846, 0x2847, 0x2848, 0x2849, 0x284a, 0x284b, 0x284c, 0x2c4d, 0x2c4e, 0x2c4f, 0x2c50, 
+	/* spectrum table 7 [542] */
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 
+	0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 
+	0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 
+	0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 
+	0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 
+	0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 
+	0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 
+	0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1804, 0x1804, 0x1804, 0x1804, 0x1804, 0x1804, 0x1804, 0x1804, 0x1805, 0x1805, 0x1805, 0x1805, 0x1805, 0x1805, 0x1805, 0x1805, 
+	0x1806, 0x1806, 0x1806, 0x1806, 0x1806, 0x1806, 0x1806, 0x1806, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 
+	0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c09, 0x1c09, 0x1c09, 0x1c09, 0x1c0a, 0x1c0a, 0x1c0a, 0x1c0a, 0x1c0b, 0x1c0b, 0x1c0b, 0x1c0b, 
+	0x1c0c, 0x1c0c, 0x1c0c, 0x1c0c, 0x200d, 0x200d, 0x200e, 0x200e, 0x200f, 0x200f, 0x2010, 0x2010, 0x2011, 0x2011, 0x2012, 0x2012, 
+	0x2013, 0x2013, 0x2014, 0x2014, 0x2015, 0x2015, 0x2016, 0x2016, 0x2417, 0x2418, 0x2419, 0x241a, 0x241b, 0x241c, 0x241d, 0x241e, 
+	0x241f, 0x2420, 0x2421, 0x2422, 0x2423, 0x2424, 0x8a00, 0x8a02, 0x8a04, 0x8a06, 0x8a08, 0x8a0a, 0x8a0c, 0x920e, 0x9212, 0x9a16, 
+	0x2825, 0x2826, 0x2827, 0x2828, 0x2829, 0x282a, 0x282b, 0x282c, 0x282d, 0x282e, 0x282f, 0x2830, 0x2831, 0x2832, 0x2833, 0x2833, 
+	0x2c34, 0x2c35, 0x2c36, 0x2c37, 0x2c38, 0x2c39, 0x2c3a, 0x2c3a, 0x2c3b, 0x2c3b, 0x303c, 0x303d, 0x303e, 0x303f, 
+	/* spectrum table 8 [516] */
+	0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 
+	0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 
+	0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 
+	0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 
+	0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 
+	0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 
+	0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 0x1005, 
+	0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 
+	0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 
+	0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 
+	0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 
+	0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 
+	0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 0x140b, 
+	0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 0x140c, 
+	0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 
+	0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 
+	0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 
+	0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 
+	0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 
+	0x1c17, 0x1c17, 0x1c17, 0x1c17, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c19, 0x1c19, 0x1c19, 0x1c19, 0x1c1a, 0x1c1a, 0x1c1a, 0x1c1a, 
+	0x1c1b, 0x1c1b, 0x1c1b, 0x1c1b, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1d, 0x1c1d, 0x1c1d, 0x1c1d, 0x1c1e, 0x1c1e, 0x1c1e, 0x1c1e, 
+	0x1c1f, 0x1c1f, 0x1c1f, 0x1c1f, 0x1c20, 0x1c20, 0x1c20, 0x1c20, 0x1c21, 0x1c21, 0x1c21, 0x1c21, 0x1c22, 0x1c22, 0x1c22, 0x1c22, 
+	0x1c23, 0x1c23, 0x1c23, 0x1c23, 0x1c24, 0x1c24, 0x1c24, 0x1c24, 0x2025, 0x2025, 0x2026, 0x2026, 0x2027, 0x2027, 0x2028, 0x2028, 
+	0x2029, 0x2029, 0x202a, 0x202a, 0x202b, 0x202b, 0x202c, 0x202c, 0x202d, 0x202d, 0x202e, 0x202e, 0x202f, 0x202f, 0x2030, 0x2030, 
+	0x2031, 0x2031, 0x2032, 0x2032, 0x2033, 0x2033, 0x2434, 0x2435, 0x2436, 0x2437, 0x2438, 0x2439, 0x243a, 0x243b, 0x8a00, 0x8a02, 
+	0x283c, 0x283d, 0x283e, 0x283f, 
+	/* spectrum table 9 [696] */
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 
+	0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 
+	0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 
+	0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 
+	0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 
+	0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 
+	0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 
+	0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1804, 0x1804, 0x1804, 0x1804, 0x1804, 0x1804, 0x1804, 0x1804, 0x1805, 0x1805, 0x1805, 0x1805, 0x1805, 0x1805, 0x1805, 0x1805, 
+	0x1806, 0x1806, 0x1806, 0x1806, 0x1806, 0x1806, 0x1806, 0x1806, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 
+	0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c09, 0x1c09, 0x1c09, 0x1c09, 0x1c0a, 0x1c0a, 0x1c0a, 0x1c0a, 0x200b, 0x200b, 0x200c, 0x200c, 
+	0x200d, 0x200d, 0x200e, 0x200e, 0x200f, 0x200f, 0x2010, 0x2010, 0x2011, 0x2011, 0x2012, 0x2012, 0x2413, 0x2414, 0x2415, 0x2416, 
+	0x2417, 0x2418, 0x2419, 0x241a, 0x241b, 0x241c, 0x241d, 0x8a00, 0x8a02, 0x8a04, 0x8a06, 0x8a08, 0x8a0a, 0x8a0c, 0x8a0e, 0x8a10, 
+	0x8a12, 0x9214, 0x9218, 0x921c, 0x9220, 0x9224, 0x9228, 0x922c, 0x9a30, 0x9a38, 0x9a40, 0x9a48, 0x9a50, 0xa258, 0xa268, 0xb278, 
+	0x281e, 0x281f, 0x2820, 0x2821, 0x2822, 0x2823, 0x2824, 0x2825, 0x2826, 0x2827, 0x2828, 0x2829, 0x282a, 0x282b, 0x282c, 0x282d, 
+	0x282e, 0x282f, 0x2830, 0x2831, 0x2c32, 0x2c33, 0x2c34, 0x2c35, 0x2c36, 0x2c37, 0x2c38, 0x2c39, 0x2c3a, 0x2c3b, 0x2c3c, 0x2c3d, 
+	0x2c3e, 0x2c3f, 0x2c40, 0x2c41, 0x2c42, 0x2c43, 0x2c44, 0x2c45, 0x2c46, 0x2c47, 0x2c48, 0x2c49, 0x2c4a, 0x2c4b, 0x2c4c, 0x2c4d, 
+	0x2c4e, 0x2c4e, 0x2c4f, 0x2c4f, 0x2c50, 0x2c50, 0x3051, 0x3052, 0x3053, 0x3054, 0x3055, 0x3056, 0x3057, 0x3058, 0x3059, 0x305a, 
+	0x305b, 0x305c, 0x305d, 0x305e, 0x305f, 0x3060, 0x3061, 0x3062, 0x3063, 0x3064, 0x3065, 0x3066, 0x3067, 0x3068, 0x3069, 0x306a, 
+	0x306b, 0x306c, 0x306d, 0x306e, 0x306f, 0x3070, 0x3071, 0x3072, 0x3073, 0x3073, 0x3074, 0x3074, 0x3075, 0x3075, 0x3076, 0x3076, 
+	0x3477, 0x3478, 0x3479, 0x347a, 0x347b, 0x347c, 0x347d, 0x347e, 0x347f, 0x3480, 0x3481, 0x3482, 0x3483, 0x3484, 0x3485, 0x3486, 
+	0x3487, 0x3488, 0x3489, 0x348a, 0x348b, 0x348c, 0x348d, 0x348e, 0x348f, 0x348f, 0x348f, 0x348f, 0x3490, 0x3490, 0x3490, 0x3490, 
+	0x3491, 0x3491, 0x3491, 0x3491, 0x3492, 0x3492, 0x3492, 0x3492, 0x3493, 0x3493, 0x3493, 0x3493, 0x3494, 0x3494, 0x3494, 0x3494, 
+	0x3495, 0x3495, 0x3495, 0x3495, 0x3496, 0x3496, 0x3496, 0x3496, 0x3897, 0x3897, 0x3898, 0x3898, 0x3899, 0x3899, 0x389a, 0x389a, 
+	0x389b, 0x389b, 0x389c, 0x389c, 0x389d, 0x389d, 0x389e, 0x389e, 0x389f, 0x389f, 0x38a0, 0x38a0, 0x38a1, 0x38a1, 0x38a2, 0x38a2, 
+	0x38a3, 0x38a3, 0x38a4, 0x38a4, 0x3ca5, 0x3ca6, 0x3ca7, 0x3ca8, 
+	/* spectrum table 10 [584] */
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 
+	0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 
+	0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 
+	0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 
+	0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 
+	0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 0x1408, 
+	0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 0x1409, 
+	0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 0x140a, 
+	0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 
+	0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 
+	0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x180f, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 
+	0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1811, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 0x1812, 
+	0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1813, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 
+	0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1815, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 0x1816, 
+	0x1817, 0x1817, 0x1817, 0x1817, 0x1817, 0x1817, 0x1817, 0x1817, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 
+	0x1c19, 0x1c19, 0x1c19, 0x1c19, 0x1c1a, 0x1c1a, 0x1c1a, 0x1c1a, 0x1c1b, 0x1c1b, 0x1c1b, 0x1c1b, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 
+	0x1c1d, 0x1c1d, 0x1c1d, 0x1c1d, 0x1c1e, 0x1c1e, 0x1c1e, 0x1c1e, 0x1c1f, 0x1c1f, 0x1c1f, 0x1c1f, 0x1c20, 0x1c20, 0x1c20, 0x1c20, 
+	0x1c21, 0x1c21, 0x1c21, 0x1c21, 0x1c22, 0x1c22, 0x1c22, 0x1c22, 0x1c23, 0x1c23, 0x1c23, 0x1c23, 0x1c24, 0x1c24, 0x1c24, 0x1c24, 
+	0x1c25, 0x1c25, 0x1c25, 0x1c25, 0x1c26, 0x1c26, 0x1c26, 0x1c26, 0x1c27, 0x1c27, 0x1c27, 0x1c27, 0x1c28, 0x1c28, 0x1c28, 0x1c28, 
+	0x1c29, 0x1c29, 0x1c29, 0x1c29, 0x202a, 0x202a, 0x202b, 0x202b, 0x202c, 0x202c, 0x202d, 0x202d, 0x202e, 0x202e, 0x202f, 0x202f, 
+	0x2030, 0x2030, 0x2031, 0x2031, 0x2032, 0x2032, 0x2033, 0x2033, 0x2034, 0x2034, 0x2035, 0x2035, 0x2036, 0x2036, 0x2037, 0x2037, 
+	0x2038, 0x2038, 0x2039, 0x2039, 0x203a, 0x203a, 0x203b, 0x203b, 0x203c, 0x203c, 0x203d, 0x203d, 0x203e, 0x203e, 0x203f, 0x203f, 
+	0x2040, 0x2040, 0x2041, 0x2041, 0x2042, 0x2042, 0x2443, 0x2444, 0x2445, 0x2446, 0x2447, 0x2448, 0x2449, 0x244a, 0x244b, 0x244c, 
+	0x244d, 0x244e, 0x244f, 0x2450, 0x2451, 0x2452, 0x2453, 0x2454, 0x2455, 0x2456, 0x2457, 0x2458, 0x2459, 0x245a, 0x245b, 0x245c, 
+	0x245d, 0x245e, 0x245f, 0x2460, 0x2461, 0x8a00, 0x8a02, 0x8a04, 0x8a06, 0x8a08, 0x8a0a, 0x8a0c, 0x8a0e, 0x8a10, 0x8a12, 0x8a14, 
+	0x8a16, 0x8a18, 0x8a1a, 0x8a1c, 0x8a1e, 0x8a20, 0x8a22, 0x8a24, 0x8a26, 0x9228, 0x922c, 0x9230, 0x9234, 0x9238, 0x923c, 0x9a40, 
+	0x2862, 0x2863, 0x2864, 0x2865, 0x2866, 0x2867, 0x2868, 0x2869, 0x286a, 0x286b, 0x286c, 0x286d, 0x286e, 0x286f, 0x2870, 0x2871, 
+	0x2872, 0x2873, 0x2874, 0x2875, 0x2876, 0x2877, 0x2878, 0x2879, 0x287a, 0x287b, 0x287c, 0x287d, 0x287e, 0x287f, 0x2880, 0x2881, 
+	0x2882, 0x2883, 0x2884, 0x2885, 0x2886, 0x2887, 0x2888, 0x2889, 0x288a, 0x288a, 0x2c8b, 0x2c8c, 0x2c8d, 0x2c8e, 0x2c8f, 0x2c90, 
+	0x2c91, 0x2c92, 0x2c93, 0x2c94, 0x2c95, 0x2c96, 0x2c97, 0x2c98, 0x2c99, 0x2c9a, 0x2c9b, 0x2c9c, 0x2c9d, 0x2c9e, 0x2c9f, 0x2ca0, 
+	0x30a1, 0x30a2, 0x30a3, 0x30a4, 0x30a5, 0x30a6, 0x30a7, 0x30a8, 
+	/* spectrum table 11 [658] */
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 
+	0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 
+	0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 0x1402, 
+	0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 0x1403, 
+	0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 0x1404, 
+	0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 
+	0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 
+	0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 0x1407, 
+	0x1808, 0x1808, 0x1808, 0x1808, 0x1808, 0x1808, 0x1808, 0x1808, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 
+	0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 0x180b, 
+	0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180c, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 0x180d, 
+	0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x180e, 0x1c0f, 0x1c0f, 0x1c0f, 0x1c0f, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 
+	0x1c11, 0x1c11, 0x1c11, 0x1c11, 0x1c12, 0x1c12, 0x1c12, 0x1c12, 0x1c13, 0x1c13, 0x1c13, 0x1c13, 0x1c14, 0x1c14, 0x1c14, 0x1c14, 
+	0x1c15, 0x1c15, 0x1c15, 0x1c15, 0x1c16, 0x1c16, 0x1c16, 0x1c16, 0x1c17, 0x1c17, 0x1c17, 0x1c17, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 
+	0x1c19, 0x1c19, 0x1c19, 0x1c19, 0x1c1a, 0x1c1a, 0x1c1a, 0x1c1a, 0x1c1b, 0x1c1b, 0x1c1b, 0x1c1b, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 
+	0x1c1d, 0x1c1d, 0x1c1d, 0x1c1d, 0x1c1e, 0x1c1e, 0x1c1e, 0x1c1e, 0x201f, 0x201f, 0x2020, 0x2020, 0x2021, 0x2021, 0x2022, 0x2022, 
+	0x2023, 0x2023, 0x2024, 0x2024, 0x2025, 0x2025, 0x2026, 0x2026, 0x2027, 0x2027, 0x2028, 0x2028, 0x2029, 0x2029, 0x202a, 0x202a, 
+	0x202b, 0x202b, 0x202c, 0x202c, 0x202d, 0x202d, 0x202e, 0x202e, 0x202f, 0x202f, 0x2030, 0x2030, 0x2031, 0x2031, 0x2032, 0x2032, 
+	0x2033, 0x2033, 0x2034, 0x2034, 0x2035, 0x2035, 0x2036, 0x2036, 0x2037, 0x2037, 0x2038, 0x2038, 0x2039, 0x2039, 0x203a, 0x203a, 
+	0x203b, 0x203b, 0x203c, 0x203c, 0x203d, 0x203d, 0x203e, 0x203e, 0x203f, 0x203f, 0x2040, 0x2040, 0x2041, 0x2041, 0x2042, 0x2042, 
+	0x2043, 0x2043, 0x2044, 0x2044, 0x2045, 0x2045, 0x2046, 0x2046, 0x2047, 0x2047, 0x2048, 0x2048, 0x2049, 0x2049, 0x204a, 0x204a, 
+	0x204b, 0x204b, 0x204c, 0x204c, 0x204d, 0x204d, 0x204e, 0x204e, 0x204f, 0x204f, 0x2050, 0x2050, 0x2051, 0x2051, 0x2052, 0x2052, 
+	0x2053, 0x2053, 0x2054, 0x2054, 0x2055, 0x2055, 0x2056, 0x2056, 0x2057, 0x2057, 0x2058, 0x2058, 0x2059, 0x2059, 0x245a, 0x245b, 
+	0x245c, 0x245d, 0x245e, 0x245f, 0x2460, 0x2461, 0x2462, 0x2463, 0x2464, 0x2465, 0x2466, 0x2467, 0x2468, 0x2469, 0x246a, 0x246b, 
+	0x246c, 0x246d, 0x246e, 0x246f, 0x2470, 0x2471, 0x2472, 0x2473, 0x2474, 0x2475, 0x2476, 0x2477, 0x2478, 0x2479, 0x247a, 0x247b, 
+	0x247c, 0x247d, 0x247e, 0x247f, 0x2480, 0x2481, 0x2482, 0x2483, 0x2484, 0x2485, 0x2486, 0x2487, 0x2488, 0x2489, 0x248a, 0x248b, 
+	0x248c, 0x248d, 0x248e, 0x248f, 0x2490, 0x8a00, 0x8a02, 0x8a04, 0x8a06, 0x8a08, 0x8a0a, 0x8a0c, 0x8a0e, 0x8a10, 0x8a12, 0x8a14, 
+	0x8a16, 0x8a18, 0x8a1a, 0x8a1c, 0x8a1e, 0x8a20, 0x8a22, 0x8a24, 0x8a26, 0x8a28, 0x8a2a, 0x8a2c, 0x8a2e, 0x8a30, 0x8a32, 0x8a34, 
+	0x8a36, 0x8a38, 0x8a3a, 0x8a3c, 0x8a3e, 0x8a40, 0x8a42, 0x8a44, 0x8a46, 0x8a48, 0x8a4a, 0x8a4c, 0x8a4e, 0x8a50, 0x8a52, 0x8a54, 
+	0x8a56, 0x8a58, 0x8a5a, 0x8a5c, 0x925e, 0x9262, 0x9266, 0x926a, 0x926e, 0x9272, 0x9276, 0x927a, 0x927e, 0x9282, 0x9286, 0x9a8a, 
+	0x2891, 0x2892, 0x2893, 0x2894, 0x2895, 0x2896, 0x2897, 0x2898, 0x2899, 0x289a, 0x289b, 0x289c, 0x289d, 0x289e, 0x289f, 0x28a0, 
+	0x28a1, 0x28a2, 0x28a3, 0x28a4, 0x28a5, 0x28a6, 0x28a7, 0x28a8, 0x28a9, 0x28aa, 0x28ab, 0x28ac, 0x28ad, 0x28ae, 0x28af, 0x28b0, 
+	0x28b1, 0x28b2, 0x28b3, 0x28b4, 0x28b5, 0x28b6, 0x28b7, 0x28b8, 0x28b9, 0x28ba, 0x28bb, 0x28bc, 0x28bd, 0x28be, 0x28bf, 0x28c0, 
+	0x28c1, 0x28c2, 0x28c3, 0x28c4, 0x28c5, 0x28c6, 0x28c7, 0x28c8, 0x28c9, 0x28ca, 0x28cb, 0x28cc, 0x28cd, 0x28ce, 0x28cf, 0x28d0, 
+	0x28d1, 0x28d2, 0x28d3, 0x28d4, 0x28d5, 0x28d6, 0x28d7, 0x28d8, 0x28d9, 0x28da, 0x28db, 0x28dc, 0x28dd, 0x28de, 0x28df, 0x28e0, 
+	0x28e1, 0x28e2, 0x28e3, 0x28e4, 0x28e5, 0x28e6, 0x28e7, 0x28e8, 0x28e9, 0x28ea, 0x28eb, 0x28ec, 0x28ed, 0x28ee, 0x28ef, 0x28ef, 
+	0x2cf0, 0x2cf1, 0x2cf2, 0x2cf3, 0x2cf4, 0x2cf5, 0x2cf6, 0x2cf7, 0x2cf8, 0x2cf9, 0x2cfa, 0x2cfb, 0x2cfc, 0x2cfd, 0x2cfe, 0x2cff, 
+	0x2d00, 0x2d01, 0x2d02, 0x2d03, 0x2d04, 0x2d05, 0x2d06, 0x2d07, 0x2d08, 0x2d09, 0x2d0a, 0x2d0b, 0x2d0c, 0x2d0d, 0x2d0e, 0x2d0f, 
+	0x2d10, 0x2d11, 0x2d12, 0x2d13, 0x2d14, 0x2d15, 0x2d16, 0x2d17, 0x2d18, 0x2d19, 0x2d1a, 0x2d1a, 0x311b, 0x311c, 0x311d, 0x311e, 
+	0x311f, 0x3120, 
+};
+
+const unsigned short huffLookScaleFact[1554] PROGMEM = {
+	/* scale factor table [1554] */
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 
+	0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 
+	0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 
+	0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 
+	0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 0x0c01, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 0x1002, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 0x1003, 
+	0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 
+	0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 0x1004, 
+	0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 0x1405, 
+	0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 0x1406, 
+	0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1807, 0x1808, 0x1808, 0x1808, 0x1808, 0x1808, 0x1808, 0x1808, 0x1808, 
+	0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x1809, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 0x180a, 
+	0x1c0b, 0x1c0b, 0x1c0b, 0x1c0b, 0x1c0c, 0x1c0c, 0x1c0c, 0x1c0c, 0x1c0d, 0x1c0d, 0x1c0d, 0x1c0d, 0x200e, 0x200e, 0x200f, 0x200f, 
+	0x2010, 0x2010, 0x2011, 0x2011, 0x2012, 0x2012, 0x2413, 0x2414, 0x2415, 0x2416, 0x8a00, 0x8a02, 0x8a04, 0x9206, 0x9a0a, 0xd212, 
+	0x2817, 0x2818, 0x2819, 0x281a, 0x281b, 0x281c, 0x2c1d, 0x2c1e, 0x2c1f, 0x2c20, 0x2c21, 0x2c21, 0x2c22, 0x2c22, 0x3023, 0x3024, 
+	0x3025, 0x3026, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 
+	0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 
+	0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 
+	0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 
+	0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 
+	0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 
+	0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 
+	0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 0x3027, 
+	0x3027, 0x3027, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 
+	0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 
+	0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 
+	0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 
+	0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 
+	0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 
+	0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 
+	0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 0x3028, 
+	0x3028, 0x3028, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 
+	0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 
+	0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 
+	0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 0x3429, 
+	0x3429, 0x3429, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 
+	0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 
+	0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 
+	0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 0x342a, 
+	0x342a, 0x342a, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 
+	0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 
+	0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 
+	0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 0x342b, 
+	0x342b, 0x342b, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 
+	0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 
+	0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 
+	0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 0x342d, 
+	0x342d, 0x342d, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 
+	0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 0x382e, 
+	0x382e, 0x382e, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 
+	0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 0x382f, 
+	0x382f, 0x382f, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 
+	0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 
+	0x3830, 0x3830, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 
+	0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 0x3831, 
+	0x3831, 0x3831, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 
+	0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 0x3832, 
+	0x3832, 0x3832, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 
+	0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 0x3833, 
+	0x3833, 0x3833, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 
+	0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 0x3834, 
+	0x3834, 0x3834, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 
+	0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 0x3835, 
+	0x3835, 0x3835, 0x3c36, 0x3c36, 0x3c36, 0x3c36, 0x3c36, 0x3c36, 0x3c36, 0x3c36, 0x3c36, 0x3c36, 0x3c36, 0x3c36, 0x3c36, 0x3c36, 
+	0x3c36, 0x3c36, 0x3c37, 0x3c37, 0x3c37, 0x3c37, 0x3c37, 0x3c37, 0x3c37, 0x3c37, 0x3c37, 0x3c37, 0x3c37, 0x3c37, 0x3c37, 0x3c37, 
+	0x3c37, 0x3c37, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 
+	0x3c38, 0x3c38, 0x3c39, 0x3c39, 0x3c39, 0x3c39, 0x3c39, 0x3c39, 0x3c39, 0x3c39, 0x3c39, 0x3c39, 0x3c39, 0x3c39, 0x3c39, 0x3c39, 
+	0x3c39, 0x3c39, 0x403a, 0x403a, 0x403a, 0x403a, 0x403a, 0x403a, 0x403a, 0x403a, 0x403b, 0x403b, 0x403b, 0x403b, 0x403b, 0x403b, 
+	0x403b, 0x403b, 0x403c, 0x403c, 0x403c, 0x403c, 0x403c, 0x403c, 0x403c, 0x403c, 0x403d, 0x403d, 0x403d, 0x403d, 0x403d, 0x403d, 
+	0x403d, 0x403d, 0x403e, 0x403e, 0x403e, 0x403e, 0x403e, 0x403e, 0x403e, 0x403e, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 
+	0x403f, 0x403f, 0x4040, 0x4040, 0x4040, 0x4040, 0x4040, 0x4040, 0x4040, 0x4040, 0x4441, 0x4441, 0x4441, 0x4441, 0x4442, 0x4442, 
+	0x4442, 0x4442, 0x4443, 0x4443, 0x4443, 0x4443, 0x4844, 0x4844, 0x4845, 0x4845, 0x4846, 0x4846, 0x4847, 0x4847, 0x4848, 0x4848, 
+	0x4849, 0x4849, 0x484a, 0x484a, 0x4c4b, 0x4c4c, 0x4c4d, 0x4c4e, 0x4c4f, 0x4c50, 0x4c51, 0x4c52, 0x4c53, 0x4c54, 0x4c55, 0x4c56, 
+	0x4c57, 0x4c58, 0x4c59, 0x4c5a, 0x4c5b, 0x4c5c, 0x4c5d, 0x4c5e, 0x4c5f, 0x4c60, 0x4c61, 0x4c62, 0x4c63, 0x4c64, 0x4c65, 0x4c66, 
+	0x4c67, 0x4c68, 0x4c69, 0x4c6a, 0x4c6b, 0x4c6c, 0x4c6d, 0x4c6e, 0x4c6f, 0x4c70, 0x4c71, 0x4c72, 0x4c73, 0x4c74, 0x4c75, 0x4c76, 
+	0x4c77, 0x4c78, 
+};
+
+#endif	/* AAC_USE_HUFF_LOOKUP */
@@ -48,7 +48,40 @@
 
 #define RND_VAL		(1 << (FBITS_OUT_IMDCT-1))
 
-#ifndef AAC_ENABLE_SBR
+#ifdef AAC_SIMD_SSE41
+/**************************************************************************************
+ * Function:    PCMStoreX4
+ *
+ * Description: round 4 samples to 16-bit PCM and store them, interleaved by stride
+ *
+ * Inputs:      output buffer
+ *              distance between output samples (negative for reverse order)
+ *              4 samples with FBITS_OUT_IMDCT fraction bits
+ *
+ * Outputs:     4 samples of 16-bit PCM
+ *
+ * Return:      none
+ *
+ * Notes:       same as CLIPTOSHORT((x + RND_VAL) >> FBITS_OUT_IMDCT) on each sample,
+ *                the saturating pack does the clipping
+ **************************************************************************************/
+static __inline void PCMStoreX4(short *pcm, int stride, __m128i x)
+{
+	x = _mm_srai_epi32(_mm_add_epi32(x, _mm_set1_epi32(RND_VAL)), FBITS_OUT_IMDCT);
+	x = _mm_packs_epi32(x, x);
+
+	if (stride == 1) {
+		_mm_storel_epi64((__m128i *)pcm, x);
+	} else if (stride == -1) {
+		_mm_storel_epi64((__m128i *)(pcm - 3), _mm_shufflelo_epi16(x, _MM_SHUFFLE(0,1,2,3)));
+	} else {
+		pcm[0]        = (short)_mm_extract_epi16(x, 0);
+		pcm[stride]   = (short)_mm_extract_epi16(x, 1);
+		pcm[2*stride] = (short)_mm_extract_epi16(x, 2);
+		pcm[3*stride] = (short)_mm_extract_epi16(x, 3);
+	}
+}
+#endif
 
 /**************************************************************************************
  * Function:    DecWindowOverlap
@@ -75,7 +108,11 @@
  **************************************************************************************/
 /*__attribute__ ((section (".data")))*/ static void DecWindowOverlap(int *buf0, int *over0, short *pcm0, int nChans, int winTypeCurr, int winTypePrev)
 {
+#ifdef AAC_SIMD_SSE41
+	__m128i in, w0, w1, f0, f1;
+#else
 	int in, w0, w1, f0, f1;
+#endif
 	int *buf1, *over1;
 	short *pcm1;
 	const int *wndPrev, *wndCurr;
@@ -86,6 +123,34 @@
 	over1 = over0 + 1024 - 1;
 
 	wndPrev = (winTypePrev == 1 ? kbdWindow + kbdWindowOffset[1] : sinWindow + sinWindowOffset[1]);
+#ifdef AAC_SIMD_SSE41
+	wndCurr = (winTypeCurr == 1 ? kbdWindow + kbdWindowOffset[1] : sinWindow + sinWindowOffset[1]);
+	do {
+		WINDOW_X4(wndPrev, &w0, &w1);
+		wndPrev += 8;
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+
+		f0 = MULSHIFT32_X4(w0, in);
+		f1 = MULSHIFT32_X4(w1, in);
+
+		PCMStoreX4(pcm0, nChans, _mm_sub_epi32(LOAD_X4(over0), f0));
+		pcm0 += 4*nChans;
+
+		PCMStoreX4(pcm1, -nChans, _mm_add_epi32(LOADREV_X4(over1), f1));
+		pcm1 -= 4*nChans;
+
+		WINDOW_X4(wndCurr, &w0, &w1);
+		wndCurr += 8;
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+		over1 -= 4;
+		STORE_X4(over0, MULSHIFT32_X4(w1, in));
+		over0 += 4;
+	} while (over0 < over1);
+#else
 	if (winTypeCurr == winTypePrev) {
 		/* cut window loads in half since current and overlap sections use same symmetric window */
 		do {
@@ -135,6 +200,7 @@
 			*over0++ = MULSHIFT32(w1, in);
 		} while (over0 < over1);
 	}
+#endif
 }
 
 /**************************************************************************************
@@ -162,7 +228,12 @@
  **************************************************************************************/
  /*__attribute__ ((section (".data")))*/ static void DecWindowOverlapLongStart(int *buf0, int *over0, short *pcm0, int nChans, int winTypeCurr, int winTypePrev)
 {
-	int i,  in, w0, w1, f0, f1;
+	int i;
+#ifdef AAC_SIMD_SSE41
+	__m128i in, w0, w1, f0, f1;
+#else
+	int in, w0, w1, f0, f1;
+#endif
 	int *buf1, *over1;
 	short *pcm1;
 	const int *wndPrev, *wndCurr;
@@ -173,6 +244,33 @@
 	over1 = over0 + 1024 - 1;
 
 	wndPrev = (winTypePrev == 1 ? kbdWindow + kbdWindowOffset[1] : sinWindow + sinWindowOffset[1]);
+#ifdef AAC_SIMD_SSE41
+	i = 448;
+	do {
+		WINDOW_X4(wndPrev, &w0, &w1);
+		wndPrev += 8;
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+
+		f0 = MULSHIFT32_X4(w0, in);
+		f1 = MULSHIFT32_X4(w1, in);
+
+		PCMStoreX4(pcm0, nChans, _mm_sub_epi32(LOAD_X4(over0), f0));
+		pcm0 += 4*nChans;
+
+		PCMStoreX4(pcm1, -nChans, _mm_add_epi32(LOADREV_X4(over1), f1));
+		pcm1 -= 4*nChans;
+
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, _mm_setzero_si128());
+		over1 -= 4;
+		STORE_X4(over0, _mm_srai_epi32(in, 1));
+		over0 += 4;
+		i -= 4;
+	} while (i);
+#else
 	i = 448;	/* 2 outputs, 2 overlaps per loop */
 	do {
 		w0 = *wndPrev++;
@@ -195,10 +293,38 @@
 		*over1-- = 0;		/* Wn = 0 for n = (2047, 2046, ... 1600) */
 		*over0++ = in >> 1;	/* Wn = 1 for n = (1024, 1025, ... 1471) */
 	} while (--i);
+#endif
 
 	wndCurr = (winTypeCurr == 1 ? kbdWindow + kbdWindowOffset[0] : sinWindow + sinWindowOffset[0]);
 
 	/* do 64 more loops - 2 outputs, 2 overlaps per loop */
+#ifdef AAC_SIMD_SSE41
+	do {
+		WINDOW_X4(wndPrev, &w0, &w1);
+		wndPrev += 8;
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+
+		f0 = MULSHIFT32_X4(w0, in);
+		f1 = MULSHIFT32_X4(w1, in);
+
+		PCMStoreX4(pcm0, nChans, _mm_sub_epi32(LOAD_X4(over0), f0));
+		pcm0 += 4*nChans;
+
+		PCMStoreX4(pcm1, -nChans, _mm_add_epi32(LOADREV_X4(over1), f1));
+		pcm1 -= 4*nChans;
+
+		WINDOW_X4(wndCurr, &w0, &w1);
+		wndCurr += 8;
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+		over1 -= 4;
+		STORE_X4(over0, MULSHIFT32_X4(w1, in));
+		over0 += 4;
+	} while (over0 < over1);
+#else
 	do {
 		w0 = *wndPrev++;
 		w1 = *wndPrev++;
@@ -222,6 +348,7 @@
 		*over1-- = MULSHIFT32(w0, in);	/* Wn = short window for n = (1599, 1598, ... , 1536) */
 		*over0++ = MULSHIFT32(w1, in);	/* Wn = short window for n = (1472, 1473, ... , 1535) */
 	} while (over0 < over1);
+#endif
 }
 
 /**************************************************************************************
@@ -249,7 +376,12 @@
  **************************************************************************************/
  /*__attribute__ ((section (".data")))*/ static void DecWindowOverlapLongStop(int *buf0, int *over0, short *pcm0, int nChans, int winTypeCurr, int winTypePrev)
 {
-	int i, in, w0, w1, f0, f1;
+	int i;
+#ifdef AAC_SIMD_SSE41
+	__m128i in, w0, w1, f0, f1;
+#else
+	int in, w0, w1, f0, f1;
+#endif
 	int *buf1, *over1;
 	short *pcm1;
 	const int *wndPrev, *wndCurr;
@@ -262,6 +394,31 @@
 	wndPrev = (winTypePrev == 1 ? kbdWindow + kbdWindowOffset[0] : sinWindow + sinWindowOffset[0]);
 	wndCurr = (winTypeCurr == 1 ? kbdWindow + kbdWindowOffset[1] : sinWindow + sinWindowOffset[1]);
 
+#ifdef AAC_SIMD_SSE41
+	i = 448;
+	do {
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+		f1 = _mm_srai_epi32(in, 1);
+
+		PCMStoreX4(pcm0, nChans, LOAD_X4(over0));
+		pcm0 += 4*nChans;
+
+		PCMStoreX4(pcm1, -nChans, _mm_add_epi32(LOADREV_X4(over1), f1));
+		pcm1 -= 4*nChans;
+
+		WINDOW_X4(wndCurr, &w0, &w1);
+		wndCurr += 8;
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+		over1 -= 4;
+		STORE_X4(over0, MULSHIFT32_X4(w1, in));
+		over0 += 4;
+		i -= 4;
+	} while (i);
+#else
 	i = 448;	/* 2 outputs, 2 overlaps per loop */
 	do {
 		/* Wn = 0 for n = (0, 1, ... 447) */
@@ -284,8 +441,36 @@
 		*over1-- = MULSHIFT32(w0, in);
 		*over0++ = MULSHIFT32(w1, in);
 	} while (--i);
+#endif
 
 	/* do 64 more loops - 2 outputs, 2 overlaps per loop */
+#ifdef AAC_SIMD_SSE41
+	do {
+		WINDOW_X4(wndPrev, &w0, &w1);
+		wndPrev += 8;
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+
+		f0 = MULSHIFT32_X4(w0, in);
+		f1 = MULSHIFT32_X4(w1, in);
+
+		PCMStoreX4(pcm0, nChans, _mm_sub_epi32(LOAD_X4(over0), f0));
+		pcm0 += 4*nChans;
+
+		PCMStoreX4(pcm1, -nChans, _mm_add_epi32(LOADREV_X4(over1), f1));
+		pcm1 -= 4*nChans;
+
+		WINDOW_X4(wndCurr, &w0, &w1);
+		wndCurr += 8;
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+		over1 -= 4;
+		STORE_X4(over0, MULSHIFT32_X4(w1, in));
+		over0 += 4;
+	} while (over0 < over1);
+#else
 	do {
 		w0 = *wndPrev++;	/* W[0], W[1], ...W[63] */
 		w1 = *wndPrev++;	/* W[127], W[126], ... W[64] */
@@ -309,6 +494,7 @@
 		*over1-- = MULSHIFT32(w0, in);
 		*over0++ = MULSHIFT32(w1, in);
 	} while (over0 < over1);
+#endif
 }
 
 /**************************************************************************************
@@ -336,7 +522,12 @@
  **************************************************************************************/
  /*__attribute__ ((section (".data"))) */ static void DecWindowOverlapShort(int *buf0, int *over0, short *pcm0, int nChans, int winTypeCurr, int winTypePrev)
 {
-	int i, in, w0, w1, f0, f1;
+	int i;
+#ifdef AAC_SIMD_SSE41
+	__m128i in, w0, w1, f0, f1;
+#else
+	int in, w0, w1, f0, f1;
+#endif
 	int *buf1, *over1;
 	short *pcm1;
 	const int *wndPrev, *wndCurr;
@@ -345,6 +536,15 @@
 	wndCurr = (winTypeCurr == 1 ? kbdWindow + kbdWindowOffset[0] : sinWindow + sinWindowOffset[0]);
 
 	/* pcm[0-447] = 0 + overlap[0-447] */
+#ifdef AAC_SIMD_SSE41
+	i = 448;
+	do {
+		PCMStoreX4(pcm0, nChans, LOAD_X4(over0));
+		pcm0 += 4*nChans;
+		over0 += 4;
+		i -= 4;
+	} while (i);
+#else
 	i = 448;
 	do {
 		f0 = *over0++;
@@ -353,12 +553,40 @@
 		*pcm0 = CLIPTOSHORT( (f1 + RND_VAL) >> FBITS_OUT_IMDCT );	pcm0 += nChans;
 		i -= 2;
 	} while (i);
+#endif
 
 	/* pcm[448-575] = Wp[0-127] * block0[0-127] + overlap[448-575] */
 	pcm1  = pcm0 + (128 - 1) * nChans;
 	over1 = over0 + 128 - 1;
 	buf0 += 64;
 	buf1  = buf0  - 1;
+#ifdef AAC_SIMD_SSE41
+	do {
+		WINDOW_X4(wndPrev, &w0, &w1);
+		wndPrev += 8;
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+
+		f0 = MULSHIFT32_X4(w0, in);
+		f1 = MULSHIFT32_X4(w1, in);
+
+		PCMStoreX4(pcm0, nChans, _mm_sub_epi32(LOAD_X4(over0), f0));
+		pcm0 += 4*nChans;
+
+		PCMStoreX4(pcm1, -nChans, _mm_add_epi32(LOADREV_X4(over1), f1));
+		pcm1 -= 4*nChans;
+
+		WINDOW_X4(wndCurr, &w0, &w1);
+		wndCurr += 8;
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+		over1 -= 4;
+		STORE_X4(over0, MULSHIFT32_X4(w1, in));
+		over0 += 4;
+	} while (over0 < over1);
+#else
 	do {
 		w0 = *wndPrev++;	/* W[0], W[1], ...W[63] */
 		w1 = *wndPrev++;	/* W[127], W[126], ... W[64] */
@@ -383,6 +611,7 @@
 		*over1-- = MULSHIFT32(w0, in);
 		*over0++ = MULSHIFT32(w1, in);
 	} while (over0 < over1);
+#endif
 
 	/* pcm[576-703] = Wc[128-255] * block0[128-255] + Wc[0-127] * block1[0-127] + overlap[576-703] 
 	 * pcm[704-831] = Wc[128-255] * block1[128-255] + Wc[0-127] * block2[0-127] + overlap[704-831] 
@@ -397,6 +626,31 @@
 		buf1 = buf0 - 1;
 		wndCurr -= 128;
 
+#ifdef AAC_SIMD_SSE41
+		do {
+			WINDOW_X4(wndCurr, &w0, &w1);
+			wndCurr += 8;
+			in = LOAD_X4(buf0);
+			buf0 += 4;
+
+			f0 = MULSHIFT32_X4(w0, in);
+			f1 = MULSHIFT32_X4(w1, in);
+
+			PCMStoreX4(pcm0, nChans, _mm_sub_epi32(_mm_add_epi32(LOAD_X4(over0 - 128), LOAD_X4(over0)), f0));
+			pcm0 += 4*nChans;
+
+			PCMStoreX4(pcm1, -nChans, _mm_add_epi32(_mm_add_epi32(LOADREV_X4(over1 - 128), LOADREV_X4(over1)), f1));
+			pcm1 -= 4*nChans;
+
+			in = LOADREV_X4(buf1);
+			buf1 -= 4;
+
+			STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+			over1 -= 4;
+			STORE_X4(over0, MULSHIFT32_X4(w1, in));
+			over0 += 4;
+		} while (over0 < over1);
+#else
 		do {
 			w0 = *wndCurr++;	/* W[0], W[1], ...W[63] */
 			w1 = *wndCurr++;	/* W[127], W[126], ... W[64] */
@@ -420,6 +674,7 @@
 			*over1-- = MULSHIFT32(w0, in);
 			*over0++ = MULSHIFT32(w1, in);
 		} while (over0 < over1);
+#endif
 	}
 
 	/* pcm[960-1023] = Wc[128-191] * block3[128-191] + Wc[0-63]   * block4[0-63] + overlap[960-1023]  
@@ -431,6 +686,30 @@
 	buf0 += 64;
 	buf1 = buf0 - 1;
 	wndCurr -= 128;
+#ifdef AAC_SIMD_SSE41
+	do {
+		WINDOW_X4(wndCurr, &w0, &w1);
+		wndCurr += 8;
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+
+		f0 = MULSHIFT32_X4(w0, in);
+		f1 = MULSHIFT32_X4(w1, in);
+
+		PCMStoreX4(pcm0, nChans, _mm_sub_epi32(_mm_add_epi32(LOAD_X4(over0 + 768), LOAD_X4(over0 + 896)), f0));
+		pcm0 += 4*nChans;
+
+		STOREREV_X4(over1 - 128, _mm_add_epi32(LOADREV_X4(over1 + 768), f1));
+
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+		over1 -= 4;
+		STORE_X4(over0, MULSHIFT32_X4(w1, in));
+		over0 += 4;
+	} while (over0 < over1);
+#else
 	do {
 		w0 = *wndCurr++;	/* W[0], W[1], ...W[63] */
 		w1 = *wndCurr++;	/* W[127], W[126], ... W[64] */
@@ -451,6 +730,7 @@
 		*over1-- = MULSHIFT32(w0, in);	/* save in overlap[128-191] */
 		*over0++ = MULSHIFT32(w1, in);	/* save in overlap[64-127] */
 	} while (over0 < over1);
+#endif
 	
 	/* over0 now points at overlap[128] */
 	
@@ -465,6 +745,28 @@
 		buf0 += 64;
 		buf1 = buf0 - 1;
 		wndCurr -= 128;
+#ifdef AAC_SIMD_SSE41
+		do {
+			WINDOW_X4(wndCurr, &w0, &w1);
+			wndCurr += 8;
+			in = LOAD_X4(buf0);
+			buf0 += 4;
+
+			f0 = MULSHIFT32_X4(w0, in);
+			f1 = MULSHIFT32_X4(w1, in);
+
+			STORE_X4(over0 - 128, _mm_sub_epi32(LOAD_X4(over0 - 128), f0));
+			STOREREV_X4(over1 - 128, _mm_add_epi32(LOADREV_X4(over1 - 128), f1));
+
+			in = LOADREV_X4(buf1);
+			buf1 -= 4;
+
+			STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+			over1 -= 4;
+			STORE_X4(over0, MULSHIFT32_X4(w1, in));
+			over0 += 4;
+		} while (over0 < over1);
+#else
 		do {
 			w0 = *wndCurr++;	/* W[0], W[1], ...W[63] */
 			w1 = *wndCurr++;	/* W[127], W[126], ... W[64] */
@@ -481,6 +783,7 @@
 			*over1-- = MULSHIFT32(w0, in);
 			*over0++ = MULSHIFT32(w1, in);
 		} while (over0 < over1);
+#endif
 	}
 
 	/* over[576-1024] = 0 */ 
@@ -495,8 +798,6 @@
 	} while (i);
 }
 
-#endif	/* !AAC_ENABLE_SBR */
-
 /**************************************************************************************
  * Function:    IMDCT
  *
@@ -519,11 +820,12 @@
  *                we need to produce both clipped 16-bit PCM in outbuf AND
  *                unclipped 32-bit PCM in the SBR input buffer. In this case we make
  *                a separate pass over the 32-bit PCM to produce 16-bit PCM output.
- *                This inflicts a slight performance hit when decoding non-SBR files.
+ *              Unless an SBR fill element follows the channel element (see sbrNext), 
+ *                the samples are clipped and interleaved directly, as if SBR was not 
+ *                compiled in.
  **************************************************************************************/
 int IMDCT(AACDecInfo *aacDecInfo, int ch, int chOut, short *outbuf)
 {
-	int i;
 	PSInfoBase *psi;
 	ICSInfo *icsInfo;
 
@@ -537,37 +839,46 @@ int IMDCT(AACDecInfo *aacDecInfo, int ch, int chOut, short *outbuf)
 	/* optimized type-IV DCT (operates inplace) */
 	if (icsInfo->winSequence == 2) {
 		/* 8 short blocks */
-		for (i = 0; i < 8; i++)
-			DCT4(0, psi->coef[ch] + i*128, psi->gbCurrent[ch]);
+		DCT4Short(psi->coef[ch], psi->gbCurrent[ch]);
 	} else {
 		/* 1 long block */
 		DCT4(1, psi->coef[ch], psi->gbCurrent[ch]);
 	}
 
 #ifdef AAC_ENABLE_SBR
-	/* window, overlap-add, don't clip to short (send to SBR decoder) 
-	 * store the decoded 32-bit samples in top half (second AAC_MAX_NSAMPS samples) of coef buffer
-	 */
-	if (icsInfo->winSequence == 0)
-		DecWindowOverlapNoClip(psi->coef[ch], psi->overlap[chOut], psi->sbrWorkBuf[ch], icsInfo->winShape, psi->prevWinShape[chOut]);
-	else if (icsInfo->winSequence == 1)
-		DecWindowOverlapLongStartNoClip(psi->coef[ch], psi->overlap[chOut], psi->sbrWorkBuf[ch], icsInfo->winShape, psi->prevWinShape[chOut]);
-	else if (icsInfo->winSequence == 2)
-		DecWindowOverlapShortNoClip(psi->coef[ch], psi->overlap[chOut], psi->sbrWorkBuf[ch], icsInfo->winShape, psi->prevWinShape[chOut]);
-	else if (icsInfo->winSequence == 3)
-		DecWindowOverlapLongStopNoClip(psi->coef[ch], psi->overlap[chOut], psi->sbrWorkBuf[ch], icsInfo->winShape, psi->prevWinShape[chOut]);
-
-	if (!aacDecInfo->sbrEnabled) {
-		for (i = 0; i < AAC_MAX_NSAMPS; i++) {
-			*outbuf = CLIPTOSHORT((psi->sbrWorkBuf[ch][i] + RND_VAL) >> FBITS_OUT_IMDCT);
-			outbuf += aacDecInfo->nChans;
+	/* keep the 32-bit samples for SBR */
+	if (aacDecInfo->sbrNext || aacDecInfo->sbrEnabled) {
+		int i;
+
+		/* window, overlap-add, don't clip to short (send to SBR decoder) 
+		 * store the decoded 32-bit samples in top half (second AAC_MAX_NSAMPS samples) of coef buffer
+		 */
+		if (icsInfo->winSequence == 0)
+			DecWindowOverlapNoClip(psi->coef[ch], psi->overlap[chOut], psi->sbrWorkBuf[ch], icsInfo->winShape, psi->prevWinShape[chOut]);
+		else if (icsInfo->winSequence == 1)
+			DecWindowOverlapLongStartNoClip(psi->coef[ch], psi->overlap[chOut], psi->sbrWorkBuf[ch], icsInfo->winShape, psi->prevWinShape[chOut]);
+		else if (icsInfo->winSequence == 2)
+			DecWindowOverlapShortNoClip(psi->coef[ch], psi->overlap[chOut], psi->sbrWorkBuf[ch], icsInfo->winShape, psi->prevWinShape[chOut]);
+		else if (icsInfo->winSequence == 3)
+			DecWindowOverlapLongStopNoClip(psi->coef[ch], psi->overlap[chOut], psi->sbrWorkBuf[ch], icsInfo->winShape, psi->prevWinShape[chOut]);
+
+		if (!aacDecInfo->sbrEnabled) {
+			for (i = 0; i < AAC_MAX_NSAMPS; i++) {
+				*outbuf = CLIPTOSHORT((psi->sbrWorkBuf[ch][i] + RND_VAL) >> FBITS_OUT_IMDCT);
+				outbuf += aacDecInfo->nChans;
+			}
 		}
+
+		aacDecInfo->rawSampleBuf[ch] = psi->sbrWorkBuf[ch];
+		aacDecInfo->rawSampleBytes = sizeof(int);
+		aacDecInfo->rawSampleFBits = FBITS_OUT_IMDCT;
+
+		psi->prevWinShape[chOut] = icsInfo->winShape;
+
+		return 0;
 	}
+#endif
 
-	aacDecInfo->rawSampleBuf[ch] = psi->sbrWorkBuf[ch];
-	aacDecInfo->rawSampleBytes = sizeof(int);
-	aacDecInfo->rawSampleFBits = FBITS_OUT_IMDCT;
-#else
 	/* window, overlap-add, round to PCM - optimized for each window sequence */
 	if (icsInfo->winSequence == 0)
 		DecWindowOverlap(psi->coef[ch], psi->overlap[chOut], outbuf, aacDecInfo->nChans, icsInfo->winShape, psi->prevWinShape[chOut]);
@@ -581,7 +892,6 @@ int IMDCT(AACDecInfo *aacDecInfo, int ch, int chOut, short *outbuf)
 	aacDecInfo->rawSampleBuf[ch] = 0;
 	aacDecInfo->rawSampleBytes = 0;
 	aacDecInfo->rawSampleFBits = 0;
-#endif
 
 	psi->prevWinShape[chOut] = icsInfo->winShape;
 
@@ -167,7 +167,11 @@ static int DecodeOneScaleFactor(BitStreamInfo *bsi)
 	/* decode next scalefactor from bitstream */
 	bitBuf = GetBitsNoAdvance(bsi, huffTabScaleFactInfo.maxBits) << (32 - huffTabScaleFactInfo.maxBits);
   //PROFILE_START("DecodeHuffmanScalar");
+#if AAC_USE_HUFF_LOOKUP
+	nBits = DecodeHuffmanLookup(huffLookScaleFact, huffTabScaleFact, bitBuf, &val);
+#else
 	nBits = DecodeHuffmanScalar(huffTabScaleFact, &huffTabScaleFactInfo, bitBuf, &val);
+#endif
 	AdvanceBitstream(bsi, nBits);
   //PROFILE_END();
 	return val;
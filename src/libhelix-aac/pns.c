@@ -288,7 +288,8 @@ int PNS(AACDecInfo *aacDecInfo, int ch)
 	psi = (PSInfoBase *)(aacDecInfo->psInfoBase);
 	icsInfo = (ch == 1 && psi->commonWin == 1) ? &(psi->icsInfo[0]) : &(psi->icsInfo[ch]);
 	
-	if (!psi->pnsUsed[ch])
+	/* pnsUsed is set by the dequantizer, which is skipped when only parsing */
+	if (!psi->pnsUsed[ch] && !aacDecInfo->parseOnly)
 		return 0;
 	
 	if (icsInfo->winSequence == 2) {
@@ -319,6 +320,7 @@ int PNS(AACDecInfo *aacDecInfo, int ch)
 						 *    the copied values will be overwritten when we process ch 1
 						 */
 						GenerateNoiseVector(coef, &psi->pnsLastVal, width);
+						psi->pnsCount += width;
 						if (checkCorr && psi->sfbCodeBook[1][gp*icsInfo->maxSFB + sfb] == 13)
 							CopyNoiseVector(coef, psi->coef[1] + (coef - psi->coef[0]), width);
 					} else {
@@ -328,8 +330,10 @@ int PNS(AACDecInfo *aacDecInfo, int ch)
 							if ( (psi->msMaskPresent == 1 && (msMask & 0x01)) || psi->msMaskPresent == 2 )
 								genNew = 0;
 						}
-						if (genNew)
+						if (genNew) {
 							GenerateNoiseVector(coef, &psi->pnsLastVal, width);
+							psi->pnsCount += width;
+						}
 					}
 					gbMask |= ScaleNoiseVector(coef, width, psi->scaleFactors[ch][gp*icsInfo->maxSFB + sfb]);
 				}
@@ -355,3 +359,61 @@ int PNS(AACDecInfo *aacDecInfo, int ch)
 	
 	return 0;
 }
+
+/**************************************************************************************
+ * Function:    GetNoiseState
+ *
+ * Description: get the state of the PNS noise generator
+ *
+ * Inputs:      valid AACDecInfo struct
+ *
+ * Outputs:     last generated value (seed for the next one), if seed != 0
+ *              number of values generated since the last call to SetNoiseState(), 
+ *                if count != 0
+ *
+ * Return:      0 if successful, -1 if error
+ **************************************************************************************/
+int GetNoiseState(AACDecInfo *aacDecInfo, unsigned int *seed, unsigned int *count)
+{
+	PSInfoBase *psi;
+
+	/* validate pointers */
+	if (!aacDecInfo || !aacDecInfo->psInfoBase)
+		return -1;
+	psi = (PSInfoBase *)(aacDecInfo->psInfoBase);
+
+	if (seed)
+		*seed = (unsigned int)psi->pnsLastVal;
+	if (count)
+		*count = psi->pnsCount;
+
+	return 0;
+}
+
+/**************************************************************************************
+ * Function:    SetNoiseState
+ *
+ * Description: set the seed of the PNS noise generator and clear the count of 
+ *                generated values
+ *
+ * Inputs:      valid AACDecInfo struct
+ *              new seed
+ *
+ * Outputs:     updated noise generator state
+ *
+ * Return:      0 if successful, -1 if error
+ **************************************************************************************/
+int SetNoiseState(AACDecInfo *aacDecInfo, unsigned int seed)
+{
+	PSInfoBase *psi;
+
+	/* validate pointers */
+	if (!aacDecInfo || !aacDecInfo->psInfoBase)
+		return -1;
+	psi = (PSInfoBase *)(aacDecInfo->psInfoBase);
+
+	psi->pnsLastVal = (int)seed;
+	psi->pnsCount = 0;
+
+	return 0;
+}
@@ -50,6 +50,7 @@
 #include "hlxclib/stdlib.h"
 #endif
 
+#include <stddef.h>
 #include "sbr.h"
 
 /**************************************************************************************
@@ -57,24 +58,25 @@
  *
  * Description: initialize PSInfoSBR struct at start of stream or after flush
  *
- * Inputs:      valid AACDecInfo struct
+ * Inputs:      valid PSInfoSBR struct
+ *              number of bytes to clear, starting at the beginning of the struct
  *
  * Outputs:     PSInfoSBR struct with proper initial state
  *
  * Return:      none
+ *
+ * Notes:       XBuf (last member) is completely rewritten for every frame, so a
+ *                flush can skip it by clearing only offsetof(PSInfoSBR, XBuf) bytes
  **************************************************************************************/
-static void InitSBRState(PSInfoSBR *psi)
+static void InitSBRState(PSInfoSBR *psi, int nBytes)
 {
-	int i, ch;
-	unsigned char *c;
+	int ch;
 
 	if (!psi)
 		return;
 
 	/* clear SBR state structure */
-	c = (unsigned char *)psi;
-	for (i = 0; i < (int)sizeof(PSInfoSBR); i++)
-		*c++ = 0;
+	ClearBuffer(psi, nBytes);
 
 	/* initialize non-zero state variables */
 	for (ch = 0; ch < AAC_MAX_NCHANS; ch++) {
@@ -95,6 +97,8 @@ static void InitSBRState(PSInfoSBR *psi)
  * Return:      0 if successful, error code (< 0) if error
  *
  * Note:        memory allocation for SBR is only done here
+ *              with AAC_SBR_LAZY_ALLOC this is called by AACDecode() for the first
+ *                SBR fill element instead of by AACInitDecoder()
  **************************************************************************************/
 int InitSBR(AACDecInfo *aacDecInfo)
 {
@@ -109,7 +113,7 @@ int InitSBR(AACDecInfo *aacDecInfo)
 		printf("OOM in SBR, can't allocate %d bytes\n", (int)sizeof(PSInfoSBR));
 		return ERR_AAC_SBR_INIT;
 	}
-	InitSBRState(psi);
+	InitSBRState(psi, sizeof(PSInfoSBR));
 
 	aacDecInfo->psInfoSBR = psi;
 	return ERR_AAC_NONE;
@@ -129,7 +133,7 @@ int InitSBRPre(AACDecInfo *aacDecInfo, void **ptr, int *sz)
                 printf("OOM in SBR, can't allocate %d bytes\n", (int)sizeof(PSInfoSBR));
                 return ERR_AAC_SBR_INIT;
         }
-        InitSBRState(psi);
+        InitSBRState(psi, sizeof(PSInfoSBR));
 
 	*ptr = (void*)((char*)(*ptr) + sizeof(PSInfoSBR));
         aacDecInfo->psInfoSBR = psi;
@@ -153,8 +157,10 @@ int InitSBRPre(AACDecInfo *aacDecInfo, void **ptr, int *sz)
  **************************************************************************************/
 void FreeSBR(AACDecInfo *aacDecInfo)
 {
-	if (aacDecInfo && aacDecInfo->psInfoSBR)
+	if (aacDecInfo && aacDecInfo->psInfoSBR) {
 		free(aacDecInfo->psInfoSBR);
+		aacDecInfo->psInfoSBR = 0;
+	}
 
 	return;
 }
@@ -208,8 +214,10 @@ int DecodeSBRBitstream(AACDecInfo *aacDecInfo, int chBase)
 			return ERR_AAC_SBR_SINGLERATE_UNSUPPORTED;
 
 		/* reset flag = 1 if header values changed */
-		if (UnpackSBRHeader(&bsi, &(psi->sbrHdr[chBase])))
+		if (UnpackSBRHeader(&bsi, &(psi->sbrHdr[chBase]))) {
 			psi->sbrChan[chBase].reset = 1;
+			psi->resetCount++;
+		}
 	
 		/* first valid SBR header should always trigger CalcFreqTables(), since psi->reset was set in InitSBR() */
 		if (psi->sbrChan[chBase].reset)
@@ -250,12 +258,18 @@ int DecodeSBRBitstream(AACDecInfo *aacDecInfo, int chBase)
  *              initialized state structs (SBRHdr, SBRGrid, SBRFreq, SBRChan)
  *
  * Outputs:     2048 samples of decoded 16-bit PCM, after SBR
+ *                (1024 at the core sample rate with aacDecInfo->sbrDownsampled)
+ *
+ * Notes:       with aacDecInfo->sbrLowPower the real-valued (low power) QMF banks,
+ *                HF generation and HF adjustment are used
+ *              with aacDecInfo->parseOnly only the phases of the noise and sinusoid
+ *                generators are advanced, nothing is written to outbuf
  *
  * Return:      0 if successful, error code (< 0) if error
  **************************************************************************************/
 int DecodeSBRData(AACDecInfo *aacDecInfo, int chBase, short *outbuf)
 {
-	int k, l, ch, chBlock, qmfaBands, qmfsBands;
+	int k, l, ch, chBlock, qmfaBands, qmfsBands, nSampsOut;
 	int upsampleOnly, gbIdx, gbMask;
 	int *inbuf;
 	short *outptr;
@@ -299,6 +313,26 @@ int DecodeSBRData(AACDecInfo *aacDecInfo, int chBase, short *outbuf)
 		sbrFreq->numQMFBands = 0;
 	}
 
+	if (aacDecInfo->parseOnly) {
+		/* no output, only keep the phases of the HF adjustment (see AACSetParseOnly) */
+		for (ch = 0; ch < chBlock; ch++) {
+			sbrChan = &(psi->sbrChan[chBase + ch]);
+			if (!upsampleOnly)
+				AdvanceHighFreqPhase(&(psi->sbrGrid[chBase + ch]), sbrFreq, sbrChan);
+			if (sbrHdr->count > 0)
+				sbrChan->reset = 0;
+		}
+		sbrFreq->kStartPrev = sbrFreq->kStart;
+		sbrFreq->numQMFBandsPrev = sbrFreq->numQMFBands;
+		if (aacDecInfo->nChans > 0 && (chBase + ch) == aacDecInfo->nChans)
+			psi->frameCount++;
+		return ERR_AAC_NONE;
+	}
+
+	/* output samples per QMF time slot */
+	nSampsOut = (aacDecInfo->sbrDownsampled ? 32 : 64);
+	psi->lowPower = aacDecInfo->sbrLowPower;
+
 	for (ch = 0; ch < chBlock; ch++) {
 		sbrGrid = &(psi->sbrGrid[chBase + ch]);	
 		sbrChan = &(psi->sbrChan[chBase + ch]);
@@ -320,19 +354,19 @@ int DecodeSBRData(AACDecInfo *aacDecInfo, int chBase, short *outbuf)
 		qmfaBands = sbrFreq->kStart;
 		for (l = 0; l < 32; l++) {
 			gbMask = QMFAnalysis(inbuf + l*32, psi->delayQMFA[chBase + ch], psi->XBuf[l + HF_GEN][0], 
-				aacDecInfo->rawSampleFBits, &(psi->delayIdxQMFA[chBase + ch]), qmfaBands);
+				aacDecInfo->rawSampleFBits, &(psi->delayIdxQMFA[chBase + ch]), qmfaBands, psi->lowPower);
 
 			gbIdx = ((l + HF_GEN) >> 5) & 0x01;	
 			sbrChan->gbMask[gbIdx] |= gbMask;	/* gbIdx = (0 if i < 32), (1 if i >= 32) */
 		}
 
 		if (upsampleOnly) {
-			/* no SBR - just run synthesis QMF to upsample by 2x */
+			/* no SBR - just run synthesis QMF to upsample by 2x (or to keep the core rate if downsampled) */
 			qmfsBands = 32;
 			for (l = 0; l < 32; l++) {
 				/* step 4 - synthesis QMF */
-				QMFSynthesis(psi->XBuf[l + HF_ADJ][0], psi->delayQMFS[chBase + ch], &(psi->delayIdxQMFS[chBase + ch]), qmfsBands, outptr, aacDecInfo->nChans);
-				outptr += 64*aacDecInfo->nChans;
+				QMFSynthesis(psi->XBuf[l + HF_ADJ][0], psi->delayQMFS[chBase + ch], &(psi->delayIdxQMFS[chBase + ch]), qmfsBands, outptr, aacDecInfo->nChans, aacDecInfo->sbrDownsampled, psi->lowPower);
+				outptr += nSampsOut*aacDecInfo->nChans;
 			}
 		} else {
 			/* if previous frame had lower SBR starting freq than current, zero out the synthesized QMF
@@ -365,15 +399,15 @@ int DecodeSBRData(AACDecInfo *aacDecInfo, int chBase, short *outbuf)
 			qmfsBands = sbrFreq->kStartPrev + sbrFreq->numQMFBandsPrev;
 			for (l = 0; l < sbrGrid->envTimeBorder[0]; l++) {
 				/* if new envelope starts mid-frame, use old settings until start of first envelope in this frame */
-				QMFSynthesis(psi->XBuf[l + HF_ADJ][0], psi->delayQMFS[chBase + ch], &(psi->delayIdxQMFS[chBase + ch]), qmfsBands, outptr, aacDecInfo->nChans);
-				outptr += 64*aacDecInfo->nChans;
+				QMFSynthesis(psi->XBuf[l + HF_ADJ][0], psi->delayQMFS[chBase + ch], &(psi->delayIdxQMFS[chBase + ch]), qmfsBands, outptr, aacDecInfo->nChans, aacDecInfo->sbrDownsampled, psi->lowPower);
+				outptr += nSampsOut*aacDecInfo->nChans;
 			}
 
 			qmfsBands = sbrFreq->kStart + sbrFreq->numQMFBands;
 			for (     ; l < 32; l++) {
 				/* use new settings for rest of frame (usually the entire frame, unless the first envelope starts mid-frame) */
-				QMFSynthesis(psi->XBuf[l + HF_ADJ][0], psi->delayQMFS[chBase + ch], &(psi->delayIdxQMFS[chBase + ch]), qmfsBands, outptr, aacDecInfo->nChans);
-				outptr += 64*aacDecInfo->nChans;
+				QMFSynthesis(psi->XBuf[l + HF_ADJ][0], psi->delayQMFS[chBase + ch], &(psi->delayIdxQMFS[chBase + ch]), qmfsBands, outptr, aacDecInfo->nChans, aacDecInfo->sbrDownsampled, psi->lowPower);
+				outptr += nSampsOut*aacDecInfo->nChans;
 			}
 		}
 
@@ -425,7 +459,93 @@ int FlushCodecSBR(AACDecInfo *aacDecInfo)
 		return ERR_AAC_NULL_POINTER;
 	psi = (PSInfoSBR *)(aacDecInfo->psInfoSBR);
 
-	InitSBRState(psi);
+	InitSBRState(psi, offsetof(PSInfoSBR, XBuf));
 
 	return 0;
 }
+
+/**************************************************************************************
+ * Function:    GetSBRPhase
+ *
+ * Description: get the phase of the noise and sinusoid generators of the HF adjustment
+ *
+ * Inputs:      valid AACDecInfo struct
+ *
+ * Outputs:     phase of each channel (AAC_MAX_NCHANS entries): noise table index 
+ *                (0-511) + 512 * sinusoid index (0-3), -1 if SBR is not running for 
+ *                the channel (no header yet)
+ *              number of SBR headers received, if headers != 0
+ *              number of header changes (which restart the noise table), if resets != 0
+ *
+ * Return:      0 if successful, error code (< 0) if error
+ *
+ * Notes:       the phases advance with every QMF time slot and every SBR band, so
+ *                like the PNS generator they depend on all frames decoded so far
+ **************************************************************************************/
+int GetSBRPhase(AACDecInfo *aacDecInfo, int *phase, unsigned int *headers, unsigned int *resets)
+{
+	int ch;
+	PSInfoSBR *psi;
+	SBRChan *sbrChan;
+
+	/* validate pointers */
+	if (!aacDecInfo || !aacDecInfo->psInfoSBR) {
+		for (ch = 0; ch < AAC_MAX_NCHANS; ch++)
+			phase[ch] = -1;
+		if (headers)
+			*headers = 0;
+		if (resets)
+			*resets = 0;
+		return ERR_AAC_NULL_POINTER;
+	}
+	psi = (PSInfoSBR *)(aacDecInfo->psInfoSBR);
+
+	for (ch = 0; ch < AAC_MAX_NCHANS; ch++) {
+		sbrChan = &(psi->sbrChan[ch]);
+		phase[ch] = (sbrChan->reset ? -1 : (sbrChan->noiseTabIndex >> 1) | (sbrChan->sinIndex << 9));
+	}
+	if (headers)
+		*headers = (unsigned int)psi->sbrHdr[0].count;
+	if (resets)
+		*resets = (unsigned int)psi->resetCount;
+
+	return ERR_AAC_NONE;
+}
+
+/**************************************************************************************
+ * Function:    SetSBRPhase
+ *
+ * Description: set the phase of the noise and sinusoid generators of the HF adjustment
+ *
+ * Inputs:      valid AACDecInfo struct
+ *              phase of each channel (AAC_MAX_NCHANS entries, see GetSBRPhase), 
+ *                channels with a negative phase are not changed
+ *
+ * Outputs:     updated SBR channel state
+ *
+ * Return:      0 if successful, error code (< 0) if error
+ *
+ * Notes:       only has an effect on channels where SBR is running: a header reset
+ *                restarts the noise table
+ **************************************************************************************/
+int SetSBRPhase(AACDecInfo *aacDecInfo, const int *phase)
+{
+	int ch;
+	PSInfoSBR *psi;
+	SBRChan *sbrChan;
+
+	/* validate pointers */
+	if (!aacDecInfo || !aacDecInfo->psInfoSBR)
+		return ERR_AAC_NULL_POINTER;
+	psi = (PSInfoSBR *)(aacDecInfo->psInfoSBR);
+
+	for (ch = 0; ch < AAC_MAX_NCHANS; ch++) {
+		sbrChan = &(psi->sbrChan[ch]);
+		if (phase[ch] >= 0 && !sbrChan->reset) {
+			sbrChan->noiseTabIndex = (phase[ch] & 511) << 1;
+			sbrChan->sinIndex = (phase[ch] >> 9) & 3;
+		}
+	}
+
+	return ERR_AAC_NONE;
+}
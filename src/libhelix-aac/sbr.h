@@ -103,8 +103,10 @@
 
 /* additional external symbols to name-mangle for static linking */
 #define FFT32C							STATNAME(FFT32C)
+#define FFT16C							STATNAME(FFT16C)
 #define CalcFreqTables					STATNAME(CalcFreqTables)
 #define AdjustHighFreq					STATNAME(AdjustHighFreq)
+#define AdvanceHighFreqPhase			STATNAME(AdvanceHighFreqPhase)
 #define GenerateHighFreq				STATNAME(GenerateHighFreq)
 #define DecodeSBREnvelope				STATNAME(DecodeSBREnvelope)
 #define DecodeSBRNoise					STATNAME(DecodeSBRNoise)
@@ -274,6 +276,7 @@ typedef struct _SBRChan {
 typedef struct _PSInfoSBR {
 	/* save for entire file */
 	int                   frameCount;
+	int                   resetCount;	/* number of header changes (see GetSBRPhase) */
 	int                   sampRateIdx;
 
 	/* state info that must be saved for each channel */
@@ -326,6 +329,11 @@ typedef struct _PSInfoSBR {
 	int                   gFiltLast[MAX_QMF_BANDS];
 	int                   qFiltLast[MAX_QMF_BANDS];
 
+	int                   lowPower;		/* real-valued SBR, copied from AACDecInfo for each frame */
+	int                   lpCoefs[64][2];			/* real a0, a1 of each low band (low power only) */
+	int                   aliasDeg[64];				/* degree of aliasing of each QMF band (low power only) */
+	unsigned char         sMappedBuf[MAX_QMF_BANDS];	/* sMapped of each SBR band in current envelope */
+
 	/* large buffers */
 	int                   delayIdxQMFA[AAC_MAX_NCHANS];
 	int                   delayQMFA[AAC_MAX_NCHANS][DELAY_SAMPS_QMFA];
@@ -338,12 +346,14 @@ typedef struct _PSInfoSBR {
 
 /* sbrfft.c */
 void FFT32C(int *x);
+void FFT16C(int *x);
 
 /* sbrfreq.c */
 int CalcFreqTables(SBRHeader *sbrHdr, SBRFreq *sbrFreq, int sampRateIdx);
 
 /* sbrhfadj.c */
 void AdjustHighFreq(PSInfoSBR *psi, SBRHeader *sbrHdr, SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRChan *sbrChan, int ch);
+void AdvanceHighFreqPhase(SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRChan *sbrChan);
 
 /* sbrhfgen.c */
 void GenerateHighFreq(PSInfoSBR *psi, SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRChan *sbrChan, int ch);
@@ -360,8 +370,8 @@ int RatioPowInv(int a, int b, int c);
 int SqrtFix(int x, int fBitsIn, int *fBitsOut);
 
 /* sbrqmf.c */
-int QMFAnalysis(int *inbuf, int *delay, int *XBuf, int fBitsIn, int *delayIdx, int qmfaBands);
-void QMFSynthesis(int *inbuf, int *delay, int *delayIdx, int qmfsBands, short *outbuf, int nChans);
+int QMFAnalysis(int *inbuf, int *delay, int *XBuf, int fBitsIn, int *delayIdx, int qmfaBands, int lowPower);
+void QMFSynthesis(int *inbuf, int *delay, int *delayIdx, int qmfsBands, short *outbuf, int nChans, int downsampled, int lowPower);
 
 /* sbrside.c */
 int GetSampRateIdx(int sampRate);
@@ -68,6 +68,13 @@ static const int twidTabOdd32[8*6] = {
 	0xac6145bb, 0x187de2a7, 0xdd5d0b08, 0xe7821d59, 0x4b418bbe, 0xc13ad060, 0xa73abd3b, 0x3536cc52, 
 };
 
+/* twiddle table for radix 4 pass of the 16-point FFT, format = Q30 (same layout as twidTabOdd32) */
+static const int twidTabEven16[4*6] = {
+	0x40000000, 0x00000000, 0x40000000, 0x00000000, 0x40000000, 0x00000000, 0x5a82799a, 0xd2bec333, 
+	0x539eba45, 0xe7821d59, 0x539eba45, 0xc4df2862, 0x40000000, 0xc0000000, 0x5a82799a, 0xd2bec333, 
+	0x00000000, 0xd2bec333, 0x00000000, 0xd2bec333, 0x539eba45, 0xc4df2862, 0xac6145bb, 0x187de2a7, 
+};
+
 /**************************************************************************************
  * Function:    BitReverse32
  *
@@ -122,7 +129,113 @@ static void R8FirstPass32(int *r0)
 
 	/* number of passes = fft size / 8 = 32 / 8 = 4 */
 	r1 = (32 >> 3);
-	do {
+
+#ifdef AAC_SIMD_SSE41
+	/* all 4 passes at once, transposed so that lane k holds pass k, same operations as the C code below */
+	for (; r1 >= 4; r1 -= 4) {
+		__m128i x[16];
+		__m128i v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v14;
+		int m;
+
+		for (m = 0; m < 4; m++) {
+			x[4*m+0] = LOAD_X4(r0 + 4*m +  0);
+			x[4*m+1] = LOAD_X4(r0 + 4*m + 16);
+			x[4*m+2] = LOAD_X4(r0 + 4*m + 32);
+			x[4*m+3] = LOAD_X4(r0 + 4*m + 48);
+			TRANSPOSE_X4(&x[4*m+0], &x[4*m+1], &x[4*m+2], &x[4*m+3]);
+		}
+
+		v10 = _mm_add_epi32(x[8], x[10]);
+		v11 = _mm_add_epi32(x[9], x[11]);
+		v12 = _mm_add_epi32(x[12], x[14]);
+		v14 = _mm_add_epi32(x[13], x[15]);
+
+		v2 = _mm_sub_epi32(x[8], x[10]);
+		v3 = _mm_sub_epi32(x[9], x[11]);
+		v6 = _mm_sub_epi32(x[12], x[14]);
+		v7 = _mm_sub_epi32(x[13], x[15]);
+
+		v4 = _mm_sub_epi32(v2, v7);
+		v5 = _mm_add_epi32(v2, v7);
+		v8 = _mm_sub_epi32(v3, v6);
+		v9 = _mm_add_epi32(v3, v6);
+
+		v2 = MULSHIFT32_C4(SQRT1_2, _mm_sub_epi32(v4, v9));
+		v3 = MULSHIFT32_C4(SQRT1_2, _mm_add_epi32(v4, v9));
+		v6 = MULSHIFT32_C4(SQRT1_2, _mm_sub_epi32(v5, v8));
+		v7 = MULSHIFT32_C4(SQRT1_2, _mm_add_epi32(v5, v8));
+
+		v4 = _mm_add_epi32(v10, v12);
+		v5 = _mm_sub_epi32(v10, v12);
+		v8 = _mm_add_epi32(v11, v14);
+		v9 = _mm_sub_epi32(v11, v14);
+
+		/* even outputs from x[0], x[2], x[4], x[6] */
+		v10 = _mm_add_epi32(x[0], x[2]);
+		v12 = _mm_add_epi32(x[4], x[6]);
+		v11 = x[2];
+		v14 = x[6];
+
+		v4 = _mm_srai_epi32(v4, 1);
+		v10 = _mm_add_epi32(v10, v12);
+		x[0] = _mm_add_epi32(v4, _mm_srai_epi32(v10, 1));
+		x[8] = _mm_sub_epi32(_mm_srai_epi32(v10, 1), v4);
+
+		v9 = _mm_srai_epi32(v9, 1);
+		v10 = _mm_sub_epi32(v10, _mm_slli_epi32(v12, 1));
+		x[4]  = _mm_add_epi32(_mm_srai_epi32(v10, 1), v9);
+		x[12] = _mm_sub_epi32(_mm_srai_epi32(v10, 1), v9);
+		v10 = _mm_add_epi32(v10, v12);
+
+		v10 = _mm_sub_epi32(v10, _mm_slli_epi32(v11, 1));
+		v12 = _mm_sub_epi32(v12, _mm_slli_epi32(v14, 1));
+
+		/* odd outputs from x[1], x[3], x[5], x[7] */
+		v4 = _mm_add_epi32(x[1], x[3]);
+		v11 = _mm_add_epi32(x[5], x[7]);
+		v14 = x[7];
+
+		v8 = _mm_srai_epi32(v8, 1);
+		v4 = _mm_add_epi32(v4, v11);
+		x[1] = _mm_add_epi32(v8, _mm_srai_epi32(v4, 1));
+		x[9] = _mm_sub_epi32(_mm_srai_epi32(v4, 1), v8);
+
+		v5 = _mm_srai_epi32(v5, 1);
+		v4 = _mm_sub_epi32(v4, _mm_slli_epi32(v11, 1));
+		x[5]  = _mm_sub_epi32(_mm_srai_epi32(v4, 1), v5);
+		x[13] = _mm_add_epi32(_mm_srai_epi32(v4, 1), v5);
+		v4 = _mm_add_epi32(v4, v11);
+
+		v4 = _mm_sub_epi32(v4, _mm_slli_epi32(x[3], 1));
+		v11 = _mm_sub_epi32(v11, _mm_slli_epi32(v14, 1));
+
+		v9 = _mm_sub_epi32(v10, v11);
+		v10 = _mm_add_epi32(v10, v11);
+		v14 = _mm_add_epi32(v4, v12);
+		v4 = _mm_sub_epi32(v4, v12);
+
+		x[2]  = _mm_add_epi32(_mm_srai_epi32(v10, 1), v7);
+		x[3]  = _mm_sub_epi32(_mm_srai_epi32(v4, 1), v6);
+		x[6]  = _mm_sub_epi32(_mm_srai_epi32(v9, 1), v2);
+		x[7]  = _mm_sub_epi32(_mm_srai_epi32(v14, 1), v3);
+		x[10] = _mm_sub_epi32(_mm_srai_epi32(v10, 1), v7);
+		x[11] = _mm_add_epi32(_mm_srai_epi32(v4, 1), v6);
+		x[14] = _mm_add_epi32(_mm_srai_epi32(v9, 1), v2);
+		x[15] = _mm_add_epi32(_mm_srai_epi32(v14, 1), v3);
+
+		for (m = 0; m < 4; m++) {
+			TRANSPOSE_X4(&x[4*m+0], &x[4*m+1], &x[4*m+2], &x[4*m+3]);
+			STORE_X4(r0 + 4*m +  0, x[4*m+0]);
+			STORE_X4(r0 + 4*m + 16, x[4*m+1]);
+			STORE_X4(r0 + 4*m + 32, x[4*m+2]);
+			STORE_X4(r0 + 4*m + 48, x[4*m+3]);
+		}
+
+		r0 += 64;
+	}
+#endif
+
+	while (r1 != 0) {
 
 		r2 = r0[8];
 		r3 = r0[9];
@@ -244,8 +357,111 @@ static void R8FirstPass32(int *r0)
 
 		r0 += 16;
 		r1--;
-	} while (r1 != 0);
+	}
+}
+
+#ifdef AAC_SIMD_SSE41
+/**************************************************************************************
+ * Function:    R4CoreX4
+ *
+ * Description: 4 butterflies of the radix-4 pass (R4Core32, R4Core16)
+ *
+ * Inputs:      buffer of samples, pointing to the first butterfly
+ *              twiddles for the 4 butterflies, stored as 4 x (b, c, d) x (ws, wi)
+ *              distance between the inputs of a butterfly (in ints)
+ *
+ * Outputs:     processed samples in same buffer
+ *
+ * Return:      none
+ *
+ * Notes:       same operations as the C code in R4Core32, so the results are bit-exact
+ **************************************************************************************/
+static void R4CoreX4(int *r0, const int *r1, int step)
+{
+	__m128i a0, a1, w0, w1, w2, w3, w4, w5, p, q;
+	__m128i var, vai, vbr, vbi, vcr, vci, vdr, vdi, vtr, vti, vwd, vws, vwi;
+
+	/* twiddles for 4 butterflies are stored as 4 x (b, c, d) x (ws, wi) */
+	w0 = LOAD_X4(r1 +  0);
+	w1 = LOAD_X4(r1 +  4);
+	w2 = LOAD_X4(r1 +  8);
+	w3 = LOAD_X4(r1 + 12);
+	w4 = LOAD_X4(r1 + 16);
+	w5 = LOAD_X4(r1 + 20);
+
+	p = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(w0), _mm_castsi128_ps(w1), _MM_SHUFFLE(3,2,1,0)));
+	q = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(w3), _mm_castsi128_ps(w4), _MM_SHUFFLE(3,2,1,0)));
+	vws = EVEN_X4(p, q);
+	vwi = ODD_X4(p, q);
+	a0 = LOAD_X4(r0 + step);
+	a1 = LOAD_X4(r0 + step + 4);
+	vbr = EVEN_X4(a0, a1);
+	vbi = ODD_X4(a0, a1);
+	vwd = _mm_add_epi32(vws, _mm_slli_epi32(vwi, 1));
+	vtr = MULSHIFT32_X4(vwi, _mm_add_epi32(vbr, vbi));
+	vbr = _mm_sub_epi32(MULSHIFT32_X4(vwd, vbr), vtr);
+	vbi = _mm_add_epi32(MULSHIFT32_X4(vws, vbi), vtr);
+
+	p = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(w0), _mm_castsi128_ps(w2), _MM_SHUFFLE(1,0,3,2)));
+	q = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(w3), _mm_castsi128_ps(w5), _MM_SHUFFLE(1,0,3,2)));
+	vws = EVEN_X4(p, q);
+	vwi = ODD_X4(p, q);
+	a0 = LOAD_X4(r0 + 2*step);
+	a1 = LOAD_X4(r0 + 2*step + 4);
+	vcr = EVEN_X4(a0, a1);
+	vci = ODD_X4(a0, a1);
+	vwd = _mm_add_epi32(vws, _mm_slli_epi32(vwi, 1));
+	vtr = MULSHIFT32_X4(vwi, _mm_add_epi32(vcr, vci));
+	vcr = _mm_sub_epi32(MULSHIFT32_X4(vwd, vcr), vtr);
+	vci = _mm_add_epi32(MULSHIFT32_X4(vws, vci), vtr);
+
+	p = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(w1), _mm_castsi128_ps(w2), _MM_SHUFFLE(3,2,1,0)));
+	q = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(w4), _mm_castsi128_ps(w5), _MM_SHUFFLE(3,2,1,0)));
+	vws = EVEN_X4(p, q);
+	vwi = ODD_X4(p, q);
+	a0 = LOAD_X4(r0 + 3*step);
+	a1 = LOAD_X4(r0 + 3*step + 4);
+	vdr = EVEN_X4(a0, a1);
+	vdi = ODD_X4(a0, a1);
+	vwd = _mm_add_epi32(vws, _mm_slli_epi32(vwi, 1));
+	vtr = MULSHIFT32_X4(vwi, _mm_add_epi32(vdr, vdi));
+	vdr = _mm_sub_epi32(MULSHIFT32_X4(vwd, vdr), vtr);
+	vdi = _mm_add_epi32(MULSHIFT32_X4(vws, vdi), vtr);
+
+	a0 = LOAD_X4(r0 + 0);
+	a1 = LOAD_X4(r0 + 4);
+	var = _mm_srai_epi32(EVEN_X4(a0, a1), 2);
+	vai = _mm_srai_epi32(ODD_X4(a0, a1), 2);
+
+	vtr = _mm_add_epi32(vcr, vdr);	/* r12 */
+	vcr = _mm_sub_epi32(vcr, vdr);	/* r8 */
+	vti = _mm_sub_epi32(vdi, vci);	/* r14 */
+	vdi = _mm_add_epi32(vdi, vci);	/* r9 */
+
+	vdr = _mm_sub_epi32(var, vbr);	/* r6 */
+	vci = _mm_sub_epi32(vai, vbi);	/* r7 */
+	vbr = _mm_add_epi32(vbr, var);	/* r4 */
+	vbi = _mm_add_epi32(vbi, vai);	/* r5 */
+
+	p = _mm_add_epi32(vbr, vtr);
+	q = _mm_add_epi32(vbi, vdi);
+	STORE_X4(r0 + 0, _mm_unpacklo_epi32(p, q));
+	STORE_X4(r0 + 4, _mm_unpackhi_epi32(p, q));
+	p = _mm_sub_epi32(vdr, vti);
+	q = _mm_sub_epi32(vci, vcr);
+	STORE_X4(r0 + step, _mm_unpacklo_epi32(p, q));
+	STORE_X4(r0 + step + 4, _mm_unpackhi_epi32(p, q));
+	p = _mm_sub_epi32(vbr, vtr);
+	q = _mm_sub_epi32(vbi, vdi);
+	STORE_X4(r0 + 2*step, _mm_unpacklo_epi32(p, q));
+	STORE_X4(r0 + 2*step + 4, _mm_unpackhi_epi32(p, q));
+	p = _mm_add_epi32(vdr, vti);
+	q = _mm_add_epi32(vci, vcr);
+	STORE_X4(r0 + 3*step, _mm_unpacklo_epi32(p, q));
+	STORE_X4(r0 + 3*step + 4, _mm_unpackhi_epi32(p, q));
+
 }
+#endif
 
 /**************************************************************************************
  * Function:    R4Core32
@@ -273,7 +489,17 @@ static void R4Core32(int *r0)
 
 	r1 = (int *)twidTabOdd32;
 	r10 = 8;
-	do {
+
+#ifdef AAC_SIMD_SSE41
+	/* 4 butterflies per step */
+	for (; r10 >= 4; r10 -= 4) {
+		R4CoreX4(r0, r1, 16);
+		r0 += 8;
+		r1 += 24;
+	}
+#endif
+
+	while (r10 != 0) {
 		/* can use r14 for lo32 scratch register in all MULSHIFT32 */
 		r2 = r1[0];
 		r3 = r1[1];
@@ -338,7 +564,7 @@ static void R4Core32(int *r0)
 		r0 += 2;
 		r1 += 6;
 		r10--;
-	} while (r10 != 0);
+	}
 }
 
 /**************************************************************************************
@@ -366,3 +592,185 @@ void FFT32C(int *x)
 	R8FirstPass32(x);	/* gain 1 int bit,  lose 2 GB (making assumptions about input) */
 	R4Core32(x);		/* gain 2 int bits, lose 0 GB (making assumptions about input) */
 }
+
+/**************************************************************************************
+ * Function:    BitReverse16
+ *
+ * Description: in-place bit reverse for the 16-point FFT
+ *
+ * Inputs:      buffer of 16 complex samples
+ *
+ * Outputs:     bit-reversed samples in same buffer
+ *
+ * Return:      none
+**************************************************************************************/
+static void BitReverse16(int *inout)
+{
+	int t, t1;
+
+	swapcplx(inout[2],  inout[16]);
+	swapcplx(inout[4],  inout[8]);
+	swapcplx(inout[6],  inout[24]);
+	swapcplx(inout[10], inout[20]);
+	swapcplx(inout[14], inout[28]);
+	swapcplx(inout[22], inout[26]);
+}
+
+/**************************************************************************************
+ * Function:    R4FirstPass16
+ *
+ * Description: radix-4 trivial pass for decimation-in-time FFT (log2(N) = 4)
+ *
+ * Inputs:      buffer of (bit-reversed) samples
+ *
+ * Outputs:     processed samples in same buffer
+ *
+ * Return:      none
+ *
+ * Notes:       assumes 2 guard bits, gains no integer bits
+ *              guard bits out = guard bits in - 2
+ *              see R4FirstPass in fft.c for base AAC
+ **************************************************************************************/
+static void R4FirstPass16(int *x)
+{
+	int i, ar, ai, br, bi, cr, ci, dr, di;
+
+	for (i = (16 >> 2); i != 0; i--) {
+		ar = x[0] + x[2];
+		br = x[0] - x[2];
+		ai = x[1] + x[3];
+		bi = x[1] - x[3];
+		cr = x[4] + x[6];
+		dr = x[4] - x[6];
+		ci = x[5] + x[7];
+		di = x[5] - x[7];
+
+		x[0] = ar + cr;
+		x[4] = ar - cr;
+		x[1] = ai + ci;
+		x[5] = ai - ci;
+		x[2] = br + di;
+		x[6] = br - di;
+		x[3] = bi - dr;
+		x[7] = bi + dr;
+
+		x += 8;
+	}
+}
+
+/**************************************************************************************
+ * Function:    R4Core16
+ *
+ * Description: radix-4 pass for 16-point decimation-in-time FFT
+ *
+ * Inputs:      buffer of samples
+ *
+ * Outputs:     processed samples in same buffer
+ *
+ * Return:      none
+ *
+ * Notes:       gain 2 integer bits
+ *              guard bits out = guard bits in - 1 (if inputs are full scale)
+ *              same butterflies as R4Core32, with 4 groups of 4 samples
+ **************************************************************************************/
+static void R4Core16(int *r0)
+{
+	int r2, r3, r4, r5, r6, r7;
+	int r8, r9, r10, r12, r14;
+	int *r1;
+
+	r1 = (int *)twidTabEven16;
+	r10 = 4;
+
+#ifdef AAC_SIMD_SSE41
+	/* 4 butterflies per step */
+	for (; r10 >= 4; r10 -= 4) {
+		R4CoreX4(r0, r1, 8);
+		r0 += 8;
+		r1 += 24;
+	}
+#endif
+
+	while (r10 != 0) {
+		r2 = r1[0];
+		r3 = r1[1];
+		r4 = r0[8];
+		r5 = r0[9];
+		r12 = r4 + r5;
+		r12 = MULSHIFT32(r3, r12);
+		r5  = MULSHIFT32(r2, r5) + r12;
+		r2 += 2*r3;
+		r4  = MULSHIFT32(r2, r4) - r12;	
+
+		r2 = r1[2];
+		r3 = r1[3];
+		r6 = r0[16];
+		r7 = r0[17];
+		r12 = r6 + r7;
+		r12 = MULSHIFT32(r3, r12);
+		r7  = MULSHIFT32(r2, r7) + r12;
+		r2 += 2*r3;
+		r6  = MULSHIFT32(r2, r6) - r12;
+		
+		r2 = r1[4];
+		r3 = r1[5];
+		r8 = r0[24];
+		r9 = r0[25];
+		r12 = r8 + r9;
+		r12 = MULSHIFT32(r3, r12);
+		r9  = MULSHIFT32(r2, r9) + r12;
+		r2 += 2*r3;
+		r8  = MULSHIFT32(r2, r8) - r12;
+
+		r2 = r0[0];
+		r3 = r0[1];
+
+		r12 = r6 + r8;
+		r8  = r6 - r8;
+		r14 = r9 - r7;
+		r9  = r9 + r7;
+
+		r6 = (r2 >> 2) - r4;
+		r7 = (r3 >> 2) - r5;
+		r4 += (r2 >> 2);
+		r5 += (r3 >> 2);
+
+		r0[0]  = r4 + r12;
+		r0[1]  = r5 + r9;
+		r0[8]  = r6 - r14;
+		r0[9]  = r7 - r8;
+		r0[16] = r4 - r12;
+		r0[17] = r5 - r9;
+		r0[24] = r6 + r14;
+		r0[25] = r7 + r8;
+
+		r0 += 2;
+		r1 += 6;
+		r10--;
+	}
+}
+
+/**************************************************************************************
+ * Function:    FFT16C
+ *
+ * Description: in-place radix-4 decimation-in-time FFT, used by the real-valued
+ *                (low power) analysis QMF
+ *
+ * Inputs:      buffer of 16 complex samples (before bit-reversal)
+ *
+ * Outputs:     processed samples in same buffer
+ *
+ * Return:      none
+ *
+ * Notes:       assumes 2 guard bits in, gains 2 integer bits
+ *              guard bits out = guard bits in - 2 (if inputs are full scale)
+ **************************************************************************************/
+void FFT16C(int *x)
+{
+	/* decimation in time */
+	BitReverse16(x);
+
+	/* 16-point complex FFT */
+	R4FirstPass16(x);	/* gain 0 int bits, lose 2 GB */
+	R4Core16(x);		/* gain 2 int bits, lose 0 GB (making assumptions about input) */
+}
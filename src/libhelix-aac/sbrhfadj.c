@@ -124,7 +124,7 @@ static void EstimateEnvelope(PSInfoSBR *psi, SBRHeader *sbrHdr, SBRGrid *sbrGrid
 
 			invFact = invBandTab[(iEnd - iStart)-1];
 			psi->eCurr[m] = MULSHIFT32(t, invFact);
-			psi->eCurrExp[m] = nScale + 1;	/* +1 for invFact = Q31 */
+			psi->eCurrExp[m] = nScale + 1 + psi->lowPower;	/* +1 for invFact = Q31, +1 for real-valued samples */
 			if (psi->eCurrExp[m] > expMax)
 				expMax = psi->eCurrExp[m];
 		}
@@ -161,7 +161,7 @@ static void EstimateEnvelope(PSInfoSBR *psi, SBRHeader *sbrHdr, SBRGrid *sbrGrid
 
 			for (m = mStart; m < mEnd; m++) {
 				psi->eCurr[m - sbrFreq->kStart] = t;
-				psi->eCurrExp[m - sbrFreq->kStart] = nScale + 1;	/* +1 for invFact = Q31 */
+				psi->eCurrExp[m - sbrFreq->kStart] = nScale + 1 + psi->lowPower;	/* +1 for invFact = Q31, +1 for real-valued samples */
 			}
 			if (psi->eCurrExp[mStart - sbrFreq->kStart] > expMax)
 				expMax = psi->eCurrExp[mStart - sbrFreq->kStart];
@@ -383,6 +383,7 @@ static void CalcComponentGains(PSInfoSBR *psi, SBRGrid *sbrGrid, SBRFreq *sbrFre
 			psi->sBand++;
 			psi->sMapped = GetSMapped(sbrGrid, sbrFreq, sbrChan, env, psi->sBand, psi->la);
 		}
+		psi->sMappedBuf[m] = (unsigned char)psi->sMapped;
 
 		/* get sIndexMapped for this QMF subband */
 		sIndexMapped = 0;
@@ -621,6 +622,171 @@ static void CalcGain(PSInfoSBR *psi, SBRHeader *sbrHdr, SBRGrid *sbrGrid, SBRFre
 	}
 }
 
+/**************************************************************************************
+ * Function:    ReduceAliasGroup
+ *
+ * Description: move the envelope gains of one group of QMF bands towards the 
+ *                energy-weighted average gain of the group, for the low power tool
+ *                (4.6.18.7.5 for LP)
+ *
+ * Inputs:      initialized PSInfoSBR struct
+ *              degree of aliasing of each QMF band, starting at kStart, format = Q30
+ *              number of QMF bands in the SBR range
+ *              first and last + 1 QMF band of the group (offsets from kStart)
+ *
+ * Outputs:     updated envelope gain, format = Q(FBITS_GLIM_BOOST)
+ *
+ * Return:      none
+ *
+ * Notes:       new gain^2 = deg * gTarget^2 + (1 - deg) * gain^2 for each band, 
+ *                where gTarget^2 = sum(eCurr * gain^2) / sum(eCurr) over the group
+ *              bands with deg = 0 keep their gain unchanged
+ **************************************************************************************/
+static void ReduceAliasGroup(PSInfoSBR *psi, int *deg, int numQMFBands, int mStart, int mEnd)
+{
+	int m, s, z, r, q, a, fbitsG, fbitsQ, topE, topP, est, tot, gTarget;
+	int pBuf[MAX_QMF_BANDS], pExp[MAX_QMF_BANDS];
+
+	/* energy = eCurr * 2^eCurrExp, energy * gain^2 = pBuf * 2^pExp 
+	 * save the exponent of the MSB of the largest of each
+	 */
+	topE = topP = -256;
+	for (m = mStart; m < mEnd; m++) {
+		pBuf[m] = 0;
+		pExp[m] = 0;
+		if (psi->eCurr[m]) {
+			z = CLZ(psi->eCurr[m]) - 1;
+			if (psi->eCurrExp[m] + 30 - z > topE)
+				topE = psi->eCurrExp[m] + 30 - z;
+			if (psi->gLimBoost[m]) {
+				q = psi->eCurr[m] << z;
+				r = CLZ(psi->gLimBoost[m]) - 1;
+				pBuf[m] = psi->gLimBoost[m] << r;
+				pBuf[m] = MULSHIFT32(q, MULSHIFT32(pBuf[m], pBuf[m]));	/* Q(-eCurrExp + z) * Q(2*(FBITS_GLIM_BOOST + r) - 32) */
+				pExp[m] = psi->eCurrExp[m] - z - (2*(FBITS_GLIM_BOOST + r) - 32) + 32;
+				if (pExp[m] + 31 - CLZ(pBuf[m]) > topP)
+					topP = pExp[m] + 31 - CLZ(pBuf[m]);
+			}
+		}
+	}
+	if (topE == -256)
+		return;
+
+	/* sum over the group with the largest term < 2^25, so the sums (at most 48 bands) fit in 31 bits */
+	est = 0;
+	tot = 0;
+	for (m = mStart; m < mEnd; m++) {
+		s = psi->eCurrExp[m] + 24 - topE;
+		if (s >= 0)
+			est += psi->eCurr[m] << s;
+		else
+			est += psi->eCurr[m] >> MIN(-s, 31);
+		s = pExp[m] + 24 - topP;
+		if (s >= 0)
+			tot += pBuf[m] << s;
+		else
+			tot += pBuf[m] >> MIN(-s, 31);
+	}
+
+	/* gTarget^2 = (tot * 2^(topP - 24)) / (est * 2^(topE - 24)) */
+	gTarget = 0;
+	fbitsG = 0;
+	if (tot) {
+		z = CLZ(est) - 1;
+		r = InvRNormalized(est << z);	/* Q(29 + 31 - z) */
+		s = CLZ(tot) - 1;
+		gTarget = MULSHIFT32(tot << s, r);
+		fbitsG = 28 + s - z - topP + topE;
+	}
+
+	for (m = mStart; m < mEnd; m++) {
+		a = (m < numQMFBands - 1 ? MAX(deg[m], deg[m+1]) : deg[m]);
+		if (a != 0) {
+			/* gain^2 of this band */
+			r = psi->gLimBoost[m];
+			z = MIN(CLZ(r) - 1, 30);
+			r <<= z;
+			r = MULSHIFT32(r, r);
+			fbitsQ = 2*(FBITS_GLIM_BOOST + z) - 32;
+
+			/* a * gTarget^2 + (1 - a) * gain^2, in Q format of the larger term */
+			q = MULSHIFT32(a, gTarget);				/* Q30 * Q(fbitsG) --> Q(fbitsG - 2) */
+			r = MULSHIFT32(0x40000000 - a, r);		/* Q30 * Q(fbitsQ) --> Q(fbitsQ - 2) */
+			if (r == 0 || (q != 0 && CLZ(q) + fbitsG < CLZ(r) + fbitsQ)) {
+				z = fbitsQ - fbitsG;
+				fbitsQ = fbitsG;
+				if (z >= 0)
+					r >>= MIN(z, 31);
+				else
+					r <<= MIN(-z, 31);	/* no overflow, r < q */
+			} else {
+				z = fbitsG - fbitsQ;
+				if (z >= 0)
+					q >>= MIN(z, 31);
+				else
+					q <<= MIN(-z, 31);	/* no overflow, q <= r */
+			}
+			q = (q + r) << 2;
+
+			r = SqrtFix(q, fbitsQ, &z);
+			z -= FBITS_GLIM_BOOST;
+			if (z >= 0) {
+				psi->gLimBoost[m] = r >> MIN(z, 31);
+			} else {
+				z = MIN(30, -z);
+				CLIP_2N_SHIFT30(r, z);
+				psi->gLimBoost[m] = r;
+			}
+		}
+	}
+}
+
+/**************************************************************************************
+ * Function:    ReduceAliasing
+ *
+ * Description: aliasing reduction for the low power (real-valued) tool, applied to 
+ *                the envelope gains of one envelope (4.6.18.7.5 for LP)
+ *
+ * Inputs:      initialized PSInfoSBR struct, with degree of aliasing from 
+ *                GenerateHighFreq and gains from CalcGain
+ *              initialized SBRFreq struct for this SCE/CPE block
+ *
+ * Outputs:     updated envelope gain, format = Q(FBITS_GLIM_BOOST)
+ *
+ * Return:      none
+ *
+ * Notes:       consecutive bands with aliasing and no added sinusoid are grouped
+ *                together, so that the aliased components cancel in the synthesis
+ *                filterbank as they would with equal gains
+ **************************************************************************************/
+static void ReduceAliasing(PSInfoSBR *psi, SBRFreq *sbrFreq)
+{
+	int m, mStart, grouping, numQMFBands;
+	int *deg;
+
+	deg = psi->aliasDeg + sbrFreq->kStart;
+	numQMFBands = sbrFreq->numQMFBands;
+
+	mStart = 0;
+	grouping = 0;
+	for (m = 0; m < numQMFBands - 1; m++) {
+		if (deg[m+1] && psi->sMappedBuf[m] == 0) {
+			if (!grouping) {
+				mStart = m;
+				grouping = 1;
+			}
+		} else if (grouping) {
+			ReduceAliasGroup(psi, deg, numQMFBands, mStart, (psi->sMappedBuf[m] ? m : m + 1));
+			grouping = 0;
+		}
+	}
+	if (grouping)
+		ReduceAliasGroup(psi, deg, numQMFBands, mStart, numQMFBands);
+}
+
+/* sinusoid leakage into neighbouring bands for the low power tool, format = Q31 */
+#define SIN_LP_COEF	0x010b0f28	/* 0.00815 */
+
 /* hSmooth table from 4.7.18.7.6, format = Q31 */
 static const int hSmoothCoef[MAX_NUM_SMOOTH_COEFS] PROGMEM = {
 	0x2aaaaaab, 0x2697a512, 0x1becfa68, 0x0ebdb043, 0x04130598, 
@@ -650,7 +816,7 @@ static const int hSmoothCoef[MAX_NUM_SMOOTH_COEFS] PROGMEM = {
 static void MapHF(PSInfoSBR *psi, SBRHeader *sbrHdr, SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRChan *sbrChan, int env, int hfReset)
 {
 	int noiseTabIndex, sinIndex, gainNoiseIndex, hSL;
-	int i, iStart, iEnd, m, idx, j, s, n, smre, smim;
+	int i, iStart, iEnd, m, idx, j, s, n, smre, smim, smlp, smNext;
 	int gFilt, qFilt, xre, xim, gbMask, gbIdx;
 	int *XBuf;
 
@@ -692,6 +858,7 @@ static void MapHF(PSInfoSBR *psi, SBRHeader *sbrHdr, SBRGrid *sbrGrid, SBRFreq *
 		/* see 4.6.18.7.6 */
 		XBuf = psi->XBuf[i + HF_ADJ][sbrFreq->kStart];
 		gbMask = 0;
+		smNext = 0;
 		for (m = 0; m < sbrFreq->numQMFBands; m++) {
 			if (env == psi->la || env == sbrChan->laPrev) {
 				/* no smoothing filter for gain, and qFilt = 0 (only need to do once) */
@@ -743,6 +910,7 @@ static void MapHF(PSInfoSBR *psi, SBRHeader *sbrHdr, SBRGrid *sbrGrid, SBRFreq *
 				smim &= (s >> 31);
 				s ^= 0x80000000;
 				smre &= (s >> 31);
+				smlp = smim;
 
 				noiseTabIndex += 2;		/* noise filtered by 0, but still need to bump index */
 			} else {
@@ -753,20 +921,40 @@ static void MapHF(PSInfoSBR *psi, SBRHeader *sbrHdr, SBRGrid *sbrGrid, SBRFreq *
 
 				n = noiseTab[noiseTabIndex++];
 				smim = MULSHIFT32(n, qFilt) >> (FBITS_QLIM_BOOST - 1 - FBITS_OUT_QMFA);
+				smlp = 0;
 			}
 			noiseTabIndex &= 1023;	/* 512 complex numbers */
 
 			gFilt = psi->gFiltLast[m];
-			xre = MULSHIFT32(gFilt, XBuf[0]);
-			xim = MULSHIFT32(gFilt, XBuf[1]);
-			CLIP_2N_SHIFT30(xre, 32 - FBITS_GLIM_BOOST);
-			CLIP_2N_SHIFT30(xim, 32 - FBITS_GLIM_BOOST);
+			if (psi->lowPower) {
+				/* real-valued: only the real parts of the sinusoid and the noise are used
+				 * when sinIndex is odd the sinusoid has no real part, so a small part of it is 
+				 *   added to the two neighbouring bands instead (band m-1 can be kStart-1)
+				 */
+				xre = MULSHIFT32(gFilt, XBuf[0]);
+				CLIP_2N_SHIFT30(xre, 32 - FBITS_GLIM_BOOST);
+				xre += smre + smNext;	*XBuf = xre;
+				gbMask |= FASTABS(xre);
+
+				smNext = 0;
+				if (smlp) {
+					smNext = MULSHIFT32(smlp, SIN_LP_COEF) << 1;
+					XBuf[-2] -= smNext;
+					gbMask |= FASTABS(XBuf[-2]);
+				}
+				XBuf += 2;
+			} else {
+				xre = MULSHIFT32(gFilt, XBuf[0]);
+				xim = MULSHIFT32(gFilt, XBuf[1]);
+				CLIP_2N_SHIFT30(xre, 32 - FBITS_GLIM_BOOST);
+				CLIP_2N_SHIFT30(xim, 32 - FBITS_GLIM_BOOST);
 
-			xre += smre;	*XBuf++ = xre;
-			xim += smim;	*XBuf++ = xim;
+				xre += smre;	*XBuf++ = xre;
+				xim += smim;	*XBuf++ = xim;
 
-			gbMask |= FASTABS(xre);
-			gbMask |= FASTABS(xim);
+				gbMask |= FASTABS(xre);
+				gbMask |= FASTABS(xim);
+			}
 		}
 		/* update circular buffer index */
 		gainNoiseIndex++;
@@ -834,6 +1022,8 @@ void AdjustHighFreq(PSInfoSBR *psi, SBRHeader *sbrHdr, SBRGrid *sbrGrid, SBRFreq
 	for (env = 0; env < sbrGrid->numEnv; env++) {
 		EstimateEnvelope(psi, sbrHdr, sbrGrid, sbrFreq, env);
 		CalcGain(psi, sbrHdr, sbrGrid, sbrFreq, sbrChan, ch, env);
+		if (psi->lowPower)
+			ReduceAliasing(psi, sbrFreq);
 		MapHF(psi, sbrHdr, sbrGrid, sbrFreq, sbrChan, env, hfReset);
 		hfReset = 0;	/* only set for first envelope after header reset */
 	}
@@ -851,3 +1041,32 @@ void AdjustHighFreq(PSInfoSBR *psi, SBRHeader *sbrHdr, SBRGrid *sbrGrid, SBRFreq
 	else
 		sbrChan->laPrev = -1;
 }
+
+/**************************************************************************************
+ * Function:    AdvanceHighFreqPhase
+ *
+ * Description: advance the noise and sinusoid generators of the HF adjustment by one
+ *                frame, without adjusting any QMF samples (parse only)
+ *
+ * Inputs:      initialized SBRGrid struct for this channel
+ *              initialized SBRFreq struct for this SCE/CPE block
+ *              initialized SBRChan struct for this channel
+ *
+ * Outputs:     updated noise table index and sinusoid index
+ *
+ * Return:      none
+ *
+ * Notes:       same result as AdjustHighFreq(): MapHF() restarts the noise table on
+ *                reset and advances both generators for every time slot of every
+ *                envelope, the noise table by one entry per QMF band
+ **************************************************************************************/
+void AdvanceHighFreqPhase(SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRChan *sbrChan)
+{
+	int n;
+
+	n = sbrGrid->envTimeBorder[sbrGrid->numEnv] - sbrGrid->envTimeBorder[0];
+	if (sbrChan->reset)
+		sbrChan->noiseTabIndex = 2;
+	sbrChan->noiseTabIndex = (sbrChan->noiseTabIndex + 2*n*sbrFreq->numQMFBands) & 1023;
+	sbrChan->sinIndex = (sbrChan->sinIndex + n) & 3;
+}
@@ -141,6 +141,56 @@ void CVKernel1(int *XBuf, int *accBuf)
 }
 #endif
 
+/**************************************************************************************
+ * Function:    CVKernel1LP
+ *
+ * Description: real-valued version of CVKernel1 for low power SBR
+ *
+ * Inputs:      buffer of low-freq samples, starting at time index = 0, 
+ *                freq index = patch subband
+ *
+ * Outputs:     64-bit accumulators for p01re, p12re, p11re, p22re stored in accBuf
+ *                (p01im = p12im = 0)
+ *
+ * Return:      none
+ *
+ * Notes:       the imaginary parts of the QMF samples are 0 in low power mode, so
+ *                this gives exactly the same result as CVKernel1
+ **************************************************************************************/
+static void CVKernel1LP(int *XBuf, int *accBuf)
+{
+	U64 p01re, p12re, p11re, p22re;
+	int n, x0re, x1re;
+
+	x0re = XBuf[0];
+	XBuf += (2*64);
+	x1re = XBuf[0];
+	XBuf += (2*64);
+
+	p01re.w64 = 0;
+	p11re.w64 = 0;
+	p12re.w64 = MADD64(0, x1re, x0re);
+	p22re.w64 = MADD64(0, x0re, x0re);
+	for (n = (NUM_TIME_SLOTS*SAMPLES_PER_SLOT + 6); n != 0; n--) {
+		x0re = x1re;
+		x1re = XBuf[0];
+		p01re.w64 = MADD64(p01re.w64, x1re, x0re);
+		p11re.w64 = MADD64(p11re.w64, x0re, x0re);
+		XBuf += (2*64);
+	}
+	p12re.w64 += p01re.w64;
+	p12re.w64 = MADD64(p12re.w64, x1re, -x0re);
+	p22re.w64 += p11re.w64;
+	p22re.w64 = MADD64(p22re.w64, x0re, -x0re);
+
+	accBuf[0]  = p01re.r.lo32;	accBuf[1]  = p01re.r.hi32;
+	accBuf[2]  = 0;				accBuf[3]  = 0;
+	accBuf[4]  = p11re.r.lo32;	accBuf[5]  = p11re.r.hi32;
+	accBuf[6]  = p12re.r.lo32;	accBuf[7]  = p12re.r.hi32;
+	accBuf[8]  = 0;				accBuf[9]  = 0;
+	accBuf[10] = p22re.r.lo32;	accBuf[11] = p22re.r.hi32;
+}
+
 /**************************************************************************************
  * Function:    CalcCovariance1
  *
@@ -148,6 +198,7 @@ void CVKernel1(int *XBuf, int *accBuf)
  *
  * Inputs:      buffer of low-freq samples, starting at time index 0, 
  *                freq index = patch subband
+ *              flag for low power (real-valued) SBR
  *
  * Outputs:     complex covariance elements p01re, p01im, p12re, p12im, p11re, p22re
  *                (p11im = p22im = 0)
@@ -157,13 +208,16 @@ void CVKernel1(int *XBuf, int *accBuf)
  *
  * Notes:       outputs are normalized to have 1 GB (sign in at least top 2 bits)
  **************************************************************************************/
-static int CalcCovariance1(int *XBuf, int *p01reN, int *p01imN, int *p12reN, int *p12imN, int *p11reN, int *p22reN)
+static int CalcCovariance1(int *XBuf, int *p01reN, int *p01imN, int *p12reN, int *p12imN, int *p11reN, int *p22reN, int lowPower)
 {
 	int accBuf[2*6];
 	int n, z, s, loShift, hiShift, gbMask;
 	U64 p01re, p01im, p12re, p12im, p11re, p22re;
 
-	CVKernel1(XBuf, accBuf);
+	if (lowPower)
+		CVKernel1LP(XBuf, accBuf);
+	else
+		CVKernel1(XBuf, accBuf);
 	p01re.r.lo32 = accBuf[0];	p01re.r.hi32 = accBuf[1];
 	p01im.r.lo32 = accBuf[2];	p01im.r.hi32 = accBuf[3];
 	p11re.r.lo32 = accBuf[4];	p11re.r.hi32 = accBuf[5];
@@ -281,6 +335,44 @@ void CVKernel2(int *XBuf, int *accBuf)
 }
 #endif
 
+/**************************************************************************************
+ * Function:    CVKernel2LP
+ *
+ * Description: real-valued version of CVKernel2 for low power SBR
+ *
+ * Inputs:      buffer of low-freq samples, starting at time index = 0, 
+ *                freq index = patch subband
+ *
+ * Outputs:     64-bit accumulator for p02re stored in accBuf (p02im = 0)
+ *
+ * Return:      none
+ **************************************************************************************/
+static void CVKernel2LP(int *XBuf, int *accBuf)
+{
+	U64 p02re;
+	int n, x0re, x1re, x2re;
+
+	p02re.w64 = 0;
+
+	x0re = XBuf[0];
+	XBuf += (2*64);
+	x1re = XBuf[0];
+	XBuf += (2*64);
+
+	for (n = (NUM_TIME_SLOTS*SAMPLES_PER_SLOT + 6); n != 0; n--) {
+		x2re = XBuf[0];
+		p02re.w64 = MADD64(p02re.w64, x2re, x0re);
+		x0re = x1re;
+		x1re = x2re;
+		XBuf += (2*64);
+	}
+
+	accBuf[0] = p02re.r.lo32;
+	accBuf[1] = p02re.r.hi32;
+	accBuf[2] = 0;
+	accBuf[3] = 0;
+}
+
 /**************************************************************************************
  * Function:    CalcCovariance2
  *
@@ -288,6 +380,7 @@ void CVKernel2(int *XBuf, int *accBuf)
  *
  * Inputs:      buffer of low-freq samples, starting at time index = 0, 
  *                freq index = patch subband
+ *              flag for low power (real-valued) SBR
  *
  * Outputs:     complex covariance element p02re, p02im
  *              format = integer (Q0) * 2^N, with scalefactor N >= 0
@@ -296,13 +389,16 @@ void CVKernel2(int *XBuf, int *accBuf)
  *
  * Notes:       outputs are normalized to have 1 GB (sign in at least top 2 bits)
  **************************************************************************************/
-static int CalcCovariance2(int *XBuf, int *p02reN, int *p02imN)
+static int CalcCovariance2(int *XBuf, int *p02reN, int *p02imN, int lowPower)
 {
 	U64 p02re, p02im;
 	int n, z, s, loShift, hiShift, gbMask;
 	int accBuf[2*2];
 
-	CVKernel2(XBuf, accBuf);
+	if (lowPower)
+		CVKernel2LP(XBuf, accBuf);
+	else
+		CVKernel2(XBuf, accBuf);
 	p02re.r.lo32 = accBuf[0];
 	p02re.r.hi32 = accBuf[1];
 	p02im.r.lo32 = accBuf[2];
@@ -353,16 +449,22 @@ static int CalcCovariance2(int *XBuf, int *p02reN, int *p02imN)
  * Inputs:      buffer of low-freq samples, starting at time index = 0, 
  *                freq index = patch subband
  *              number of guard bits in input sample buffer
+ *              flag for low power (real-valued) SBR
  *
  * Outputs:     complex LP coefficients a0re, a0im, a1re, a1im, format = Q29
+ *              reflection coefficient -p01re/p11re, clipped to range [-1, 1], 
+ *                format = Q30
  *
  * Return:      none
  *
  * Notes:       output coefficients (a0re, a0im, a1re, a1im) clipped to range (-4, 4)
  *              if the comples coefficients have magnitude >= 4.0, they are all
  *                set to 0 (see spec)
+ *              in low power mode the imaginary parts are 0, so a0im = a1im = 0
+ *              the reflection coefficient is only used by the low power tool 
+ *                (see CalcAliasDegree), it is 0 if p11re = 0
  **************************************************************************************/
-static void CalcLPCoefs(int *XBuf, int *a0re, int *a0im, int *a1re, int *a1im, int gb)
+static void CalcLPCoefs(int *XBuf, int *a0re, int *a0im, int *a1re, int *a1im, int *rCoef, int gb, int lowPower)
 {
 	int zFlag, n1, n2, nd, d, dInv, tre, tim;
 	int p01re, p01im, p02re, p02im, p12re, p12im, p11re, p22re;
@@ -382,8 +484,8 @@ static void CalcLPCoefs(int *XBuf, int *a0re, int *a0im, int *a1re, int *a1im, i
 	}
 	
 	/* calculate covariance elements */
-	n1 = CalcCovariance1(XBuf, &p01re, &p01im, &p12re, &p12im, &p11re, &p22re);
-	n2 = CalcCovariance2(XBuf, &p02re, &p02im);
+	n1 = CalcCovariance1(XBuf, &p01re, &p01im, &p12re, &p12im, &p11re, &p22re, lowPower);
+	n2 = CalcCovariance2(XBuf, &p02re, &p02im, lowPower);
 
 	/* normalize everything to larger power of 2 scalefactor, call it n1 */
 	if (n1 < n2) {
@@ -406,6 +508,7 @@ static void CalcLPCoefs(int *XBuf, int *a0re, int *a0im, int *a1re, int *a1im, i
 	zFlag = 0;
 	*a0re = *a0im = 0;
 	*a1re = *a1im = 0;
+	*rCoef = 0;
 	if (d > 0) {
 		/* input =   Q31  d    = Q(-2*n1 - 32 + nd) = Q31 * 2^(31 + 2*n1 + 32 - nd)
 		 * inverse = Q29  dInv = Q29 * 2^(-31 - 2*n1 - 32 + nd) = Q(29 + 31 + 2*n1 + 32 - nd)
@@ -447,6 +550,13 @@ static void CalcLPCoefs(int *XBuf, int *a0re, int *a0im, int *a1re, int *a1im, i
 		p11re <<= nd;
 		dInv = InvRNormalized(p11re);
 
+		/* same Q format as a0, so clip to 1.0 and convert Q(25 - nd) to Q30 */
+		tre = -MULSHIFT32(p01re >> 3, dInv);
+		if (nd <= 25 && (FASTABS(tre) >> (25 - nd)) == 0)
+			*rCoef = tre << (30 - 25 + nd);
+		else if (tre != 0)
+			*rCoef = (tre < 0 ? -0x40000000 : 0x40000000);
+
 		/* a1re, a1im = Q29, so scaled by (n1 + 3) */
 		tre = (p01re >> 3) + MULSHIFT32(p12re, *a1re) + MULSHIFT32(p12im, *a1im);
 		tre = -MULSHIFT32(tre, dInv);
@@ -480,6 +590,55 @@ static void CalcLPCoefs(int *XBuf, int *a0re, int *a0im, int *a1re, int *a1im, i
 	}
 }
 
+/**************************************************************************************
+ * Function:    CalcAliasDegree
+ *
+ * Description: calculate degree of aliasing for each low band, for the low power
+ *                (real-valued) tool
+ *
+ * Inputs:      reflection coefficient of each low band (see CalcLPCoefs), 
+ *                format = Q30
+ *              number of low bands (k0)
+ *
+ * Outputs:     degree of aliasing for bands [0, k0), range = [0, 1], format = Q30
+ *
+ * Return:      none
+ *
+ * Notes:       with real-valued subbands a sinusoid close to the border between 
+ *                two bands aliases into both, which is detected by the signs of 
+ *                the reflection coefficients of neighbouring bands (a negative 
+ *                coefficient in an even band and a positive one in an odd band 
+ *                indicate energy at the upper border of the band)
+ **************************************************************************************/
+static void CalcAliasDegree(int *rCoef, int *deg, int k0)
+{
+	int k, t;
+
+	deg[0] = 0;
+	deg[1] = 0;
+	for (k = 2; k < k0; k++) {
+		deg[k] = 0;
+		t = 0x40000000 - (MULSHIFT32(rCoef[k-1], rCoef[k-1]) << 2);	/* 1 - r[k-1]^2 */
+		if ((k & 0x01) == 0 && rCoef[k] < 0) {
+			if (rCoef[k-1] < 0) {
+				deg[k] = 0x40000000;
+				if (rCoef[k-2] > 0)
+					deg[k-1] = t;
+			} else if (rCoef[k-2] > 0) {
+				deg[k] = t;
+			}
+		} else if ((k & 0x01) == 1 && rCoef[k] > 0) {
+			if (rCoef[k-1] > 0) {
+				deg[k] = 0x40000000;
+				if (rCoef[k-2] < 0)
+					deg[k-1] = t;
+			} else if (rCoef[k-2] < 0) {
+				deg[k] = t;
+			}
+		}
+	}
+}
+
 /**************************************************************************************
  * Function:    GenerateHighFreq
  *
@@ -499,7 +658,7 @@ void GenerateHighFreq(PSInfoSBR *psi, SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRCha
 {
 	int band, newBW, c, t, gb, gbMask, gbIdx;
 	int currPatch, p, x, k, g, i, iStart, iEnd, bw, bwsq;
-	int a0re, a0im, a1re, a1im;
+	int a0re, a0im, a1re, a1im, k0, rCoef[64];
 	int x1re, x1im, x2re, x2im;
 	int ACCre, ACCim;
 	int *XBufLo, *XBufHi;
@@ -539,6 +698,19 @@ void GenerateHighFreq(PSInfoSBR *psi, SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRCha
 	gbMask = (sbrChan->gbMask[0] | sbrChan->gbMask[1]);	/* older 32 | newer 8 */
 	gb = CLZ(gbMask) - 1;
 
+	if (psi->lowPower) {
+		/* real-valued LP coefficients for every low band, calculated once even if the band 
+		 *   is used by several patches, and the degree of aliasing for AdjustHighFreq
+		 */
+		k0 = sbrFreq->freqMaster[0];
+		for (p = 0; p < k0; p++)
+			CalcLPCoefs(psi->XBuf[0][p], &(psi->lpCoefs[p][0]), &a0im, &(psi->lpCoefs[p][1]), &a1im, &rCoef[p], gb, 1);
+		rCoef[0] = 0;
+		CalcAliasDegree(rCoef, psi->aliasDeg, k0);
+		for (p = k0; p < 64; p++)
+			psi->aliasDeg[p] = 0;
+	}
+
 	for (currPatch = 0; currPatch < sbrFreq->numPatches; currPatch++) {
 		for (x = 0; x < sbrFreq->patchNumSubbands[currPatch]; x++) {
 			/* map k to corresponding noise floor band */
@@ -550,8 +722,16 @@ void GenerateHighFreq(PSInfoSBR *psi, SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRCha
 		
 			p = sbrFreq->patchStartSubband[currPatch] + x;	/* low QMF band */
 			XBufHi = psi->XBuf[iStart][k];
+			if (psi->lowPower)
+				psi->aliasDeg[k] = (x == 0 ? 0 : psi->aliasDeg[p]);	/* no aliasing across patch borders */
 			if (bw) {
-				CalcLPCoefs(psi->XBuf[0][p], &a0re, &a0im, &a1re, &a1im, gb);
+				if (psi->lowPower) {
+					a0re = psi->lpCoefs[p][0];
+					a1re = psi->lpCoefs[p][1];
+					a0im = a1im = 0;
+				} else {
+					CalcLPCoefs(psi->XBuf[0][p], &a0re, &a0im, &a1re, &a1im, &t, gb, 0);
+				}
 
 				a0re = MULSHIFT32(bw, a0re);	/* Q31 * Q29 = Q28 */
 				a0im = MULSHIFT32(bw, a0im);
@@ -568,36 +748,56 @@ void GenerateHighFreq(PSInfoSBR *psi, SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRCha
 				x1im = XBufLo[1];	/* IM{XBuf[n-1]} */
 				XBufLo += (64*2);
 
-				for (i = iStart; i < iEnd; i++) {
-					/* a0re/im, a1re/im are Q28 with at least 1 GB, 
-					 *   so the summing for AACre/im is fine (1 GB in, plus 1 from MULSHIFT32) 
-					 */
-					ACCre = MULSHIFT32(x2re, a1re) - MULSHIFT32(x2im, a1im);
-					ACCim = MULSHIFT32(x2re, a1im) + MULSHIFT32(x2im, a1re);
-					x2re = x1re;
-					x2im = x1im;
+				if (psi->lowPower) {
+					/* real-valued: imaginary parts of samples and coefficients are 0 */
+					for (i = iStart; i < iEnd; i++) {
+						ACCre = MULSHIFT32(x2re, a1re) + MULSHIFT32(x1re, a0re);
+						x2re = x1re;
+						x1re = XBufLo[0];
+						XBufLo += (64*2);
+
+						CLIP_2N_SHIFT30(ACCre, 4);
+						ACCre += x1re;
+
+						XBufHi[0] = ACCre;
+						XBufHi[1] = 0;
+						XBufHi += (64*2);
+
+						gbIdx = (i >> 5) & 0x01;
+						sbrChan->gbMask[gbIdx] |= FASTABS(ACCre);
+					}
+				} else {
+					for (i = iStart; i < iEnd; i++) {
+						/* a0re/im, a1re/im are Q28 with at least 1 GB, 
+						 *   so the summing for AACre/im is fine (1 GB in, plus 1 from MULSHIFT32) 
+						 */
+						ACCre = MULSHIFT32(x2re, a1re) - MULSHIFT32(x2im, a1im);
+						ACCim = MULSHIFT32(x2re, a1im) + MULSHIFT32(x2im, a1re);
+						x2re = x1re;
+						x2im = x1im;
 					
-					ACCre += MULSHIFT32(x1re, a0re) - MULSHIFT32(x1im, a0im);
-					ACCim += MULSHIFT32(x1re, a0im) + MULSHIFT32(x1im, a0re);
-					x1re = XBufLo[0];	/* RE{XBuf[n]} */
-					x1im = XBufLo[1];	/* IM{XBuf[n]} */
-					XBufLo += (64*2);
-
-					/* lost 4 fbits when scaling by a0re/im, a1re/im (Q28) */
-					CLIP_2N_SHIFT30(ACCre, 4);
-					ACCre += x1re;
-					CLIP_2N_SHIFT30(ACCim, 4);
-					ACCim += x1im;
-
-					XBufHi[0] = ACCre;
-					XBufHi[1] = ACCim;
-					XBufHi += (64*2);
-
-					/* update guard bit masks */
-					gbMask  = FASTABS(ACCre);
-					gbMask |= FASTABS(ACCim);
-					gbIdx = (i >> 5) & 0x01;	/* 0 if i < 32, 1 if i >= 32 */
-					sbrChan->gbMask[gbIdx] |= gbMask;
+						ACCre += MULSHIFT32(x1re, a0re) - MULSHIFT32(x1im, a0im);
+						ACCim += MULSHIFT32(x1re, a0im) + MULSHIFT32(x1im, a0re);
+						x1re = XBufLo[0];	/* RE{XBuf[n]} */
+						x1im = XBufLo[1];	/* IM{XBuf[n]} */
+						XBufLo += (64*2);
+
+						/* lost 4 fbits when scaling by a0re/im, a1re/im (Q28) */
+						CLIP_2N_SHIFT30(ACCre, 4);
+						ACCre += x1re;
+						CLIP_2N_SHIFT30(ACCim, 4);
+						ACCim += x1im;
+
+						XBufHi[0] = ACCre;
+						XBufHi[1] = ACCim;
+						XBufHi += (64*2);
+
+						/* update guard bit masks */
+						gbMask  = FASTABS(ACCre);
+						gbMask |= FASTABS(ACCim);
+						gbIdx = (i >> 5) & 0x01;	/* 0 if i < 32, 1 if i >= 32 */
+						sbrChan->gbMask[gbIdx] |= gbMask;
+					}
 				}
 			} else {
 				XBufLo = (int *)psi->XBuf[iStart][p];
@@ -65,7 +65,11 @@
  **************************************************************************************/
 void DecWindowOverlapNoClip(int *buf0, int *over0, int *out0, int winTypeCurr, int winTypePrev)
 {
+#ifdef AAC_SIMD_SSE41
+	__m128i in, w0, w1, f0, f1;
+#else
 	int in, w0, w1, f0, f1;
+#endif
 	int *buf1, *over1, *out1;
 	const int *wndPrev, *wndCurr;
 
@@ -75,6 +79,34 @@ void DecWindowOverlapNoClip(int *buf0, int *over0, int *out0, int winTypeCurr, i
 	over1 = over0 + 1024 - 1;
 
 	wndPrev = (winTypePrev == 1 ? kbdWindow + kbdWindowOffset[1] : sinWindow + sinWindowOffset[1]);
+#ifdef AAC_SIMD_SSE41
+	wndCurr = (winTypeCurr == 1 ? kbdWindow + kbdWindowOffset[1] : sinWindow + sinWindowOffset[1]);
+	do {
+		WINDOW_X4(wndPrev, &w0, &w1);
+		wndPrev += 8;
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+
+		f0 = MULSHIFT32_X4(w0, in);
+		f1 = MULSHIFT32_X4(w1, in);
+
+		STORE_X4(out0, _mm_sub_epi32(LOAD_X4(over0), f0));
+		out0 += 4;
+
+		STOREREV_X4(out1, _mm_add_epi32(LOADREV_X4(over1), f1));
+		out1 -= 4;
+
+		WINDOW_X4(wndCurr, &w0, &w1);
+		wndCurr += 8;
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+		over1 -= 4;
+		STORE_X4(over0, MULSHIFT32_X4(w1, in));
+		over0 += 4;
+	} while (over0 < over1);
+#else
 	if (winTypeCurr == winTypePrev) {
 		/* cut window loads in half since current and overlap sections use same symmetric window */
 		do {
@@ -120,6 +152,7 @@ void DecWindowOverlapNoClip(int *buf0, int *over0, int *out0, int winTypeCurr, i
 			*over0++ = MULSHIFT32(w1, in);
 		} while (over0 < over1);
 	}
+#endif
 }
 
 /**************************************************************************************
@@ -141,7 +174,12 @@ void DecWindowOverlapNoClip(int *buf0, int *over0, int *out0, int winTypeCurr, i
  **************************************************************************************/
 void DecWindowOverlapLongStartNoClip(int *buf0, int *over0, int *out0, int winTypeCurr, int winTypePrev)
 {
-	int i,  in, w0, w1, f0, f1;
+	int i;
+#ifdef AAC_SIMD_SSE41
+	__m128i in, w0, w1, f0, f1;
+#else
+	int in, w0, w1, f0, f1;
+#endif
 	int *buf1, *over1, *out1;
 	const int *wndPrev, *wndCurr;
 
@@ -151,6 +189,33 @@ void DecWindowOverlapLongStartNoClip(int *buf0, int *over0, int *out0, int winTy
 	over1 = over0 + 1024 - 1;
 
 	wndPrev = (winTypePrev == 1 ? kbdWindow + kbdWindowOffset[1] : sinWindow + sinWindowOffset[1]);
+#ifdef AAC_SIMD_SSE41
+	i = 448;
+	do {
+		WINDOW_X4(wndPrev, &w0, &w1);
+		wndPrev += 8;
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+
+		f0 = MULSHIFT32_X4(w0, in);
+		f1 = MULSHIFT32_X4(w1, in);
+
+		STORE_X4(out0, _mm_sub_epi32(LOAD_X4(over0), f0));
+		out0 += 4;
+
+		STOREREV_X4(out1, _mm_add_epi32(LOADREV_X4(over1), f1));
+		out1 -= 4;
+
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, _mm_setzero_si128());
+		over1 -= 4;
+		STORE_X4(over0, _mm_srai_epi32(in, 1));
+		over0 += 4;
+		i -= 4;
+	} while (i);
+#else
 	i = 448;	/* 2 outputs, 2 overlaps per loop */
 	do {
 		w0 = *wndPrev++;
@@ -171,10 +236,38 @@ void DecWindowOverlapLongStartNoClip(int *buf0, int *over0, int *out0, int winTy
 		*over1-- = 0;		/* Wn = 0 for n = (2047, 2046, ... 1600) */
 		*over0++ = in >> 1;	/* Wn = 1 for n = (1024, 1025, ... 1471) */
 	} while (--i);
+#endif
 
 	wndCurr = (winTypeCurr == 1 ? kbdWindow + kbdWindowOffset[0] : sinWindow + sinWindowOffset[0]);
 
 	/* do 64 more loops - 2 outputs, 2 overlaps per loop */
+#ifdef AAC_SIMD_SSE41
+	do {
+		WINDOW_X4(wndPrev, &w0, &w1);
+		wndPrev += 8;
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+
+		f0 = MULSHIFT32_X4(w0, in);
+		f1 = MULSHIFT32_X4(w1, in);
+
+		STORE_X4(out0, _mm_sub_epi32(LOAD_X4(over0), f0));
+		out0 += 4;
+
+		STOREREV_X4(out1, _mm_add_epi32(LOADREV_X4(over1), f1));
+		out1 -= 4;
+
+		WINDOW_X4(wndCurr, &w0, &w1);
+		wndCurr += 8;
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+		over1 -= 4;
+		STORE_X4(over0, MULSHIFT32_X4(w1, in));
+		over0 += 4;
+	} while (over0 < over1);
+#else
 	do {
 		w0 = *wndPrev++;
 		w1 = *wndPrev++;
@@ -196,6 +289,7 @@ void DecWindowOverlapLongStartNoClip(int *buf0, int *over0, int *out0, int winTy
 		*over1-- = MULSHIFT32(w0, in);	/* Wn = short window for n = (1599, 1598, ... , 1536) */
 		*over0++ = MULSHIFT32(w1, in);	/* Wn = short window for n = (1472, 1473, ... , 1535) */
 	} while (over0 < over1);
+#endif
 }
 
 /**************************************************************************************
@@ -217,7 +311,12 @@ void DecWindowOverlapLongStartNoClip(int *buf0, int *over0, int *out0, int winTy
  **************************************************************************************/
 void DecWindowOverlapLongStopNoClip(int *buf0, int *over0, int *out0, int winTypeCurr, int winTypePrev)
 {
-	int i, in, w0, w1, f0, f1;
+	int i;
+#ifdef AAC_SIMD_SSE41
+	__m128i in, w0, w1, f0, f1;
+#else
+	int in, w0, w1, f0, f1;
+#endif
 	int *buf1, *over1, *out1;
 	const int *wndPrev, *wndCurr;
 
@@ -229,6 +328,31 @@ void DecWindowOverlapLongStopNoClip(int *buf0, int *over0, int *out0, int winTyp
 	wndPrev = (winTypePrev == 1 ? kbdWindow + kbdWindowOffset[0] : sinWindow + sinWindowOffset[0]);
 	wndCurr = (winTypeCurr == 1 ? kbdWindow + kbdWindowOffset[1] : sinWindow + sinWindowOffset[1]);
 
+#ifdef AAC_SIMD_SSE41
+	i = 448;
+	do {
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+		f1 = _mm_srai_epi32(in, 1);
+
+		STORE_X4(out0, LOAD_X4(over0));
+		out0 += 4;
+
+		STOREREV_X4(out1, _mm_add_epi32(LOADREV_X4(over1), f1));
+		out1 -= 4;
+
+		WINDOW_X4(wndCurr, &w0, &w1);
+		wndCurr += 8;
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+		over1 -= 4;
+		STORE_X4(over0, MULSHIFT32_X4(w1, in));
+		over0 += 4;
+		i -= 4;
+	} while (i);
+#else
 	i = 448;	/* 2 outputs, 2 overlaps per loop */
 	do {
 		/* Wn = 0 for n = (0, 1, ... 447) */
@@ -249,8 +373,36 @@ void DecWindowOverlapLongStopNoClip(int *buf0, int *over0, int *out0, int winTyp
 		*over1-- = MULSHIFT32(w0, in);
 		*over0++ = MULSHIFT32(w1, in);
 	} while (--i);
+#endif
 
 	/* do 64 more loops - 2 outputs, 2 overlaps per loop */
+#ifdef AAC_SIMD_SSE41
+	do {
+		WINDOW_X4(wndPrev, &w0, &w1);
+		wndPrev += 8;
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+
+		f0 = MULSHIFT32_X4(w0, in);
+		f1 = MULSHIFT32_X4(w1, in);
+
+		STORE_X4(out0, _mm_sub_epi32(LOAD_X4(over0), f0));
+		out0 += 4;
+
+		STOREREV_X4(out1, _mm_add_epi32(LOADREV_X4(over1), f1));
+		out1 -= 4;
+
+		WINDOW_X4(wndCurr, &w0, &w1);
+		wndCurr += 8;
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+		over1 -= 4;
+		STORE_X4(over0, MULSHIFT32_X4(w1, in));
+		over0 += 4;
+	} while (over0 < over1);
+#else
 	do {
 		w0 = *wndPrev++;	/* W[0], W[1], ...W[63] */
 		w1 = *wndPrev++;	/* W[127], W[126], ... W[64] */
@@ -272,6 +424,7 @@ void DecWindowOverlapLongStopNoClip(int *buf0, int *over0, int *out0, int winTyp
 		*over1-- = MULSHIFT32(w0, in);
 		*over0++ = MULSHIFT32(w1, in);
 	} while (over0 < over1);
+#endif
 }
 
 /**************************************************************************************
@@ -293,7 +446,12 @@ void DecWindowOverlapLongStopNoClip(int *buf0, int *over0, int *out0, int winTyp
  **************************************************************************************/
 void DecWindowOverlapShortNoClip(int *buf0, int *over0, int *out0, int winTypeCurr, int winTypePrev)
 {
-	int i, in, w0, w1, f0, f1;
+	int i;
+#ifdef AAC_SIMD_SSE41
+	__m128i in, w0, w1, f0, f1;
+#else
+	int in, w0, w1, f0, f1;
+#endif
 	int *buf1, *over1, *out1;
 	const int *wndPrev, *wndCurr;
 
@@ -301,6 +459,15 @@ void DecWindowOverlapShortNoClip(int *buf0, int *over0, int *out0, int winTypeCu
 	wndCurr = (winTypeCurr == 1 ? kbdWindow + kbdWindowOffset[0] : sinWindow + sinWindowOffset[0]);
 
 	/* pcm[0-447] = 0 + overlap[0-447] */
+#ifdef AAC_SIMD_SSE41
+	i = 448;
+	do {
+		STORE_X4(out0, LOAD_X4(over0));
+		out0 += 4;
+		over0 += 4;
+		i -= 4;
+	} while (i);
+#else
 	i = 448;
 	do {
 		f0 = *over0++;
@@ -309,12 +476,40 @@ void DecWindowOverlapShortNoClip(int *buf0, int *over0, int *out0, int winTypeCu
 		*out0++ = f1;
 		i -= 2;
 	} while (i);
+#endif
 
 	/* pcm[448-575] = Wp[0-127] * block0[0-127] + overlap[448-575] */
 	out1  = out0 + (128 - 1);
 	over1 = over0 + 128 - 1;
 	buf0 += 64;
 	buf1  = buf0  - 1;
+#ifdef AAC_SIMD_SSE41
+	do {
+		WINDOW_X4(wndPrev, &w0, &w1);
+		wndPrev += 8;
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+
+		f0 = MULSHIFT32_X4(w0, in);
+		f1 = MULSHIFT32_X4(w1, in);
+
+		STORE_X4(out0, _mm_sub_epi32(LOAD_X4(over0), f0));
+		out0 += 4;
+
+		STOREREV_X4(out1, _mm_add_epi32(LOADREV_X4(over1), f1));
+		out1 -= 4;
+
+		WINDOW_X4(wndCurr, &w0, &w1);
+		wndCurr += 8;
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+		over1 -= 4;
+		STORE_X4(over0, MULSHIFT32_X4(w1, in));
+		over0 += 4;
+	} while (over0 < over1);
+#else
 	do {
 		w0 = *wndPrev++;	/* W[0], W[1], ...W[63] */
 		w1 = *wndPrev++;	/* W[127], W[126], ... W[64] */
@@ -337,6 +532,7 @@ void DecWindowOverlapShortNoClip(int *buf0, int *over0, int *out0, int winTypeCu
 		*over1-- = MULSHIFT32(w0, in);
 		*over0++ = MULSHIFT32(w1, in);
 	} while (over0 < over1);
+#endif
 
 	/* pcm[576-703] = Wc[128-255] * block0[128-255] + Wc[0-127] * block1[0-127] + overlap[576-703] 
 	 * pcm[704-831] = Wc[128-255] * block1[128-255] + Wc[0-127] * block2[0-127] + overlap[704-831] 
@@ -351,6 +547,31 @@ void DecWindowOverlapShortNoClip(int *buf0, int *over0, int *out0, int winTypeCu
 		buf1 = buf0 - 1;
 		wndCurr -= 128;
 
+#ifdef AAC_SIMD_SSE41
+		do {
+			WINDOW_X4(wndCurr, &w0, &w1);
+			wndCurr += 8;
+			in = LOAD_X4(buf0);
+			buf0 += 4;
+
+			f0 = MULSHIFT32_X4(w0, in);
+			f1 = MULSHIFT32_X4(w1, in);
+
+			STORE_X4(out0, _mm_sub_epi32(_mm_add_epi32(LOAD_X4(over0 - 128), LOAD_X4(over0)), f0));
+			out0 += 4;
+
+			STOREREV_X4(out1, _mm_add_epi32(_mm_add_epi32(LOADREV_X4(over1 - 128), LOADREV_X4(over1)), f1));
+			out1 -= 4;
+
+			in = LOADREV_X4(buf1);
+			buf1 -= 4;
+
+			STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+			over1 -= 4;
+			STORE_X4(over0, MULSHIFT32_X4(w1, in));
+			over0 += 4;
+		} while (over0 < over1);
+#else
 		do {
 			w0 = *wndCurr++;	/* W[0], W[1], ...W[63] */
 			w1 = *wndCurr++;	/* W[127], W[126], ... W[64] */
@@ -372,6 +593,7 @@ void DecWindowOverlapShortNoClip(int *buf0, int *over0, int *out0, int winTypeCu
 			*over1-- = MULSHIFT32(w0, in);
 			*over0++ = MULSHIFT32(w1, in);
 		} while (over0 < over1);
+#endif
 	}
 
 	/* pcm[960-1023] = Wc[128-191] * block3[128-191] + Wc[0-63]   * block4[0-63] + overlap[960-1023]  
@@ -383,6 +605,30 @@ void DecWindowOverlapShortNoClip(int *buf0, int *over0, int *out0, int winTypeCu
 	buf0 += 64;
 	buf1 = buf0 - 1;
 	wndCurr -= 128;
+#ifdef AAC_SIMD_SSE41
+	do {
+		WINDOW_X4(wndCurr, &w0, &w1);
+		wndCurr += 8;
+		in = LOAD_X4(buf0);
+		buf0 += 4;
+
+		f0 = MULSHIFT32_X4(w0, in);
+		f1 = MULSHIFT32_X4(w1, in);
+
+		STORE_X4(out0, _mm_sub_epi32(_mm_add_epi32(LOAD_X4(over0 + 768), LOAD_X4(over0 + 896)), f0));
+		out0 += 4;
+
+		STOREREV_X4(over1 - 128, _mm_add_epi32(LOADREV_X4(over1 + 768), f1));
+
+		in = LOADREV_X4(buf1);
+		buf1 -= 4;
+
+		STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+		over1 -= 4;
+		STORE_X4(over0, MULSHIFT32_X4(w1, in));
+		over0 += 4;
+	} while (over0 < over1);
+#else
 	do {
 		w0 = *wndCurr++;	/* W[0], W[1], ...W[63] */
 		w1 = *wndCurr++;	/* W[127], W[126], ... W[64] */
@@ -402,6 +648,7 @@ void DecWindowOverlapShortNoClip(int *buf0, int *over0, int *out0, int winTypeCu
 		*over1-- = MULSHIFT32(w0, in);	/* save in overlap[128-191] */
 		*over0++ = MULSHIFT32(w1, in);	/* save in overlap[64-127] */
 	} while (over0 < over1);
+#endif
 	
 	/* over0 now points at overlap[128] */
 	
@@ -416,6 +663,28 @@ void DecWindowOverlapShortNoClip(int *buf0, int *over0, int *out0, int winTypeCu
 		buf0 += 64;
 		buf1 = buf0 - 1;
 		wndCurr -= 128;
+#ifdef AAC_SIMD_SSE41
+		do {
+			WINDOW_X4(wndCurr, &w0, &w1);
+			wndCurr += 8;
+			in = LOAD_X4(buf0);
+			buf0 += 4;
+
+			f0 = MULSHIFT32_X4(w0, in);
+			f1 = MULSHIFT32_X4(w1, in);
+
+			STORE_X4(over0 - 128, _mm_sub_epi32(LOAD_X4(over0 - 128), f0));
+			STOREREV_X4(over1 - 128, _mm_add_epi32(LOADREV_X4(over1 - 128), f1));
+
+			in = LOADREV_X4(buf1);
+			buf1 -= 4;
+
+			STOREREV_X4(over1, MULSHIFT32_X4(w0, in));
+			over1 -= 4;
+			STORE_X4(over0, MULSHIFT32_X4(w1, in));
+			over0 += 4;
+		} while (over0 < over1);
+#else
 		do {
 			w0 = *wndCurr++;	/* W[0], W[1], ...W[63] */
 			w1 = *wndCurr++;	/* W[127], W[126], ... W[64] */
@@ -432,6 +701,7 @@ void DecWindowOverlapShortNoClip(int *buf0, int *over0, int *out0, int winTypeCu
 			*over1-- = MULSHIFT32(w0, in);
 			*over0++ = MULSHIFT32(w1, in);
 		} while (over0 < over1);
+#endif
 	}
 
 	/* over[576-1024] = 0 */ 
@@ -46,7 +46,7 @@
 #include "sbr.h"
 #include "assembly.h"
 
-/* PreMultiply64() table
+/* PreMultiply() table for the 64-point DCT-IV
  * format = Q30
  * reordered for sequential access
  *
@@ -71,7 +71,7 @@ static const int cos4sin4tab64[64] PROGMEM = {
 	0x5a2d0957, 0x29348937, 0x5a56deec, 0x2ff1d9c7, 0x5a72c63b, 0x2b8ef77d, 0x5a80baf6, 0x2dce88aa,
 };
 
-/* PostMultiply64() table
+/* PostMultiply() table for the 64-point DCT-IV
  * format = Q30
  * reordered for sequential access
  *
@@ -89,12 +89,103 @@ static const int cos1sin1tab64[34] PROGMEM = {
 	0x5a82799a, 0x2d413ccd,
 };
 
+/* PreMultiply() and PostMultiply() tables for the 32-point DCT-IV of the downsampled 
+ *   synthesis QMF, same formulas as above with nmdct = 32
+ */
+static const int cos4sin4tab32[32] PROGMEM = {
+	0x418d2621, 0x0192155f, 0x4488e37f, 0x3fd39b5a, 0x475a5c77, 0x07d59396, 0x49ffd417, 0x3f0ec9f5,
+	0x4c77a88e, 0x0e05c135, 0x4ec05432, 0x3dae81cf, 0x50d86e6d, 0x14135c94, 0x52beac9f, 0x3bb6276e,
+	0x5471e2e6, 0x19ef7944, 0x55f104dc, 0x392a9642, 0x573b2635, 0x1f8ba4dc, 0x584f7b58, 0x361214b0,
+	0x592d59da, 0x24da0a9a, 0x59d438e5, 0x32744493, 0x5a43b190, 0x29cd9578, 0x5a7b7f1a, 0x2e5a1070,
+};
+
+static const int cos1sin1tab32[18] PROGMEM = {
+	0x40000000, 0x00000000, 0x45f704f7, 0x0645e9af, 0x4b418bbe, 0x0c7c5c1e, 0x4fd288dc, 0x1294062f,
+	0x539eba45, 0x187de2a7, 0x569cc31b, 0x1e2b5d38, 0x58c542c5, 0x238e7673, 0x5a12e720, 0x2899e64a,
+	0x5a82799a, 0x2d413ccd,
+};
+
+/* SynthesisDown32() rotation of the input subbands
+ * format = Q31
+ *
+ * for (k = 0; k < 32; k++) {
+ *   x = cos((k + 0.5) * M_PI / 128);
+ *   x = sin((k + 0.5) * M_PI / 128);
+ * }
+ */
+static const int cosSinTabDown32[64] PROGMEM = {
+	0x7ffd885a, 0x01921d20, 0x7fe9cbc0, 0x04b6195d, 0x7fc25596, 0x07d95b9e, 0x7f872bf3, 0x0afb6805,
+	0x7f3857f6, 0x0e1bc2e4, 0x7ed5e5c6, 0x1139f0cf, 0x7e5fe493, 0x145576b1, 0x7dd6668f, 0x176dd9de,
+	0x7d3980ec, 0x1a82a026, 0x7c894bde, 0x1d934fe5, 0x7bc5e290, 0x209f701c, 0x7aef6323, 0x23a6887f,
+	0x7a05eead, 0x26a82186, 0x7909a92d, 0x29a3c485, 0x77fab989, 0x2c98fbba, 0x76d94989, 0x2f875262,
+	0x75a585cf, 0x326e54c7, 0x745f9dd1, 0x354d9057, 0x7307c3d0, 0x382493b0, 0x719e2cd2, 0x3af2eeb7,
+	0x7023109a, 0x3db832a6, 0x6e96a99d, 0x4073f21d, 0x6cf934fc, 0x4325c135, 0x6b4af279, 0x45cd358f,
+	0x698c246c, 0x4869e665, 0x67bd0fbd, 0x4afb6c98, 0x65ddfbd3, 0x4d8162c4, 0x63ef3290, 0x4ffb654d,
+	0x61f1003f, 0x5269126e, 0x5fe3b38d, 0x54ca0a4b, 0x5dc79d7c, 0x571deefa, 0x5b9d1154, 0x59646498,
+};
+
+/* low power (real-valued) QMF tables, format = Q30
+ *
+ * AnalysisLP32() pre-twiddle of DCT-III and split of the 16-point FFT
+ * for (j = 0; j <= 16; j++) {
+ *   x = cos(j * M_PI / 64);
+ *   x = sin(j * M_PI / 64);
+ * }
+ * for (j = 0; j < 16; j++) {
+ *   x = cos(j * M_PI / 16);
+ *   x = sin(j * M_PI / 16);
+ * }
+ */
+static const int cosSinTabLP32[34] PROGMEM = {
+	0x40000000, 0x00000000, 0x3fec43c7, 0x0323ecbe, 0x3fb11b48, 0x0645e9af, 0x3f4eaafe, 0x09640837, 
+	0x3ec52fa0, 0x0c7c5c1e, 0x3e14fdf7, 0x0f8cfcbe, 0x3d3e82ae, 0x1294062f, 0x3c42420a, 0x158f9a76, 
+	0x3b20d79e, 0x187de2a7, 0x39daf5e8, 0x1b5d100a, 0x387165e3, 0x1e2b5d38, 0x36e5068a, 0x20e70f32, 
+	0x3536cc52, 0x238e7673, 0x3367c090, 0x261feffa, 0x317900d6, 0x2899e64a, 0x2f6bbe45, 0x2afad269, 
+	0x2d413ccd, 0x2d413ccd,
+};
+
+static const int cosSinTabLP16[32] PROGMEM = {
+	0x40000000, 0x00000000, 0x3ec52fa0, 0x0c7c5c1e, 0x3b20d79e, 0x187de2a7, 0x3536cc52, 0x238e7673, 
+	0x2d413ccd, 0x2d413ccd, 0x238e7673, 0x3536cc52, 0x187de2a7, 0x3b20d79e, 0x0c7c5c1e, 0x3ec52fa0, 
+	0x00000000, 0x40000000, 0xf383a3e2, 0x3ec52fa0, 0xe7821d59, 0x3b20d79e, 0xdc71898d, 0x3536cc52, 
+	0xd2bec333, 0x2d413ccd, 0xcac933ae, 0x238e7673, 0xc4df2862, 0x187de2a7, 0xc13ad060, 0x0c7c5c1e,
+};
+
+/* SynthesisLP64() post-twiddle of DCT-II
+ * for (m = 0; m <= 32; m++) {
+ *   x = cos(m * M_PI / 128);
+ *   x = sin(m * M_PI / 128);
+ *   x = cos(5 * m * M_PI / 128);
+ *   x = sin(5 * m * M_PI / 128);
+ * }
+ */
+static const int cosSinTabLP64[132] PROGMEM = {
+	0x40000000, 0x00000000, 0x40000000, 0x00000000, 0x3ffb10c1, 0x0192155f, 0x3f84c8e2, 0x07d59396, 
+	0x3fec43c7, 0x0323ecbe, 0x3e14fdf7, 0x0f8cfcbe, 0x3fd39b5a, 0x04b54825, 0x3bb6276e, 0x17088531, 
+	0x3fb11b48, 0x0645e9af, 0x387165e3, 0x1e2b5d38, 0x3f84c8e2, 0x07d59396, 0x34534f41, 0x24da0a9a, 
+	0x3f4eaafe, 0x09640837, 0x2f6bbe45, 0x2afad269, 0x3f0ec9f5, 0x0af10a22, 0x29cd9578, 0x30761c18, 
+	0x3ec52fa0, 0x0c7c5c1e, 0x238e7673, 0x3536cc52, 0x3e71e759, 0x0e05c135, 0x1cc66e99, 0x392a9642, 
+	0x3e14fdf7, 0x0f8cfcbe, 0x158f9a76, 0x3c42420a, 0x3dae81cf, 0x1111d263, 0x0e05c135, 0x3e71e759, 
+	0x3d3e82ae, 0x1294062f, 0x0645e9af, 0x3fb11b48, 0x3cc511d9, 0x14135c94, 0xfe6deaa1, 0x3ffb10c1, 
+	0x3c42420a, 0x158f9a76, 0xf69bf7c9, 0x3f4eaafe, 0x3bb6276e, 0x17088531, 0xeeee2d9d, 0x3dae81cf, 
+	0x3b20d79e, 0x187de2a7, 0xe7821d59, 0x3b20d79e, 0x3a8269a3, 0x19ef7944, 0xe0745b24, 0x37af8159, 
+	0x39daf5e8, 0x1b5d100a, 0xd9e01006, 0x3367c090, 0x392a9642, 0x1cc66e99, 0xd3de9156, 0x2e5a1070, 
+	0x387165e3, 0x1e2b5d38, 0xce86ff2a, 0x2899e64a, 0x37af8159, 0x1f8ba4dc, 0xc9edeb50, 0x223d66a8, 
+	0x36e5068a, 0x20e70f32, 0xc6250a18, 0x1b5d100a, 0x361214b0, 0x223d66a8, 0xc33aee27, 0x14135c94, 
+	0x3536cc52, 0x238e7673, 0xc13ad060, 0x0c7c5c1e, 0x34534f41, 0x24da0a9a, 0xc02c64a6, 0x04b54825, 
+	0x3367c090, 0x261feffa, 0xc013bc39, 0xfcdc1342, 0x32744493, 0x275ff452, 0xc0f1360b, 0xf50ef5de, 
+	0x317900d6, 0x2899e64a, 0xc2c17d52, 0xed6bf9d1, 0x30761c18, 0x29cd9578, 0xc57d965d, 0xe61086bc, 
+	0x2f6bbe45, 0x2afad269, 0xc91af976, 0xdf18f0ce, 0x2e5a1070, 0x2c216eaa, 0xcd8bbb6d, 0xd8a00bae, 
+	0x2d413ccd, 0x2d413ccd, 0xd2bec333, 0xd2bec333,
+};
+
 /**************************************************************************************
- * Function:    PreMultiply64
+ * Function:    PreMultiply
  *
- * Description: pre-twiddle stage of 64-point DCT-IV
+ * Description: pre-twiddle stage of 64-point or 32-point DCT-IV
  *
- * Inputs:      buffer of 64 samples
+ * Inputs:      buffer of nmdct samples
+ *              transform size (64 or 32)
  *
  * Outputs:     processed samples in same buffer
  *
@@ -105,18 +196,56 @@ static const int cos1sin1tab64[34] PROGMEM = {
  *              output is limited to sqrt(2)/2 plus GB in full GB
  *              uses 3-mul, 3-add butterflies instead of 4-mul, 2-add
  **************************************************************************************/
-static void PreMultiply64(int *zbuf1)
+static void PreMultiply(int *zbuf1, int nmdct)
 {
 	int i, ar1, ai1, ar2, ai2, z1, z2;
 	int t, cms2, cps2a, sin2a, cps2b, sin2b;
 	int *zbuf2;
 	const int *csptr;
 
-	zbuf2 = zbuf1 + 64 - 1;
-	csptr = cos4sin4tab64;
+	zbuf2 = zbuf1 + nmdct - 1;
+	csptr = (nmdct == 64 ? cos4sin4tab64 : cos4sin4tab32);
+	i = nmdct >> 2;
+
+#ifdef AAC_SIMD_SSE41
+	/* 4 iterations per step, lane j holds iteration j (zbuf2 side in reversed order) */
+	for (; i >= 4; i -= 4) {
+		__m128i va, vb, vc, vd, var1, vai1, var2, vai2, vt, vz1, vz2;
+
+		va = LOAD_X4(csptr +  0);
+		vb = LOAD_X4(csptr +  4);
+		vc = LOAD_X4(csptr +  8);
+		vd = LOAD_X4(csptr + 12);
+		TRANSPOSE_X4(&va, &vb, &vc, &vd);	/* cps2a, sin2a, cps2b, sin2b */
+		csptr += 16;
+
+		vz1 = LOAD_X4(zbuf1 + 0);
+		vz2 = LOAD_X4(zbuf1 + 4);
+		var1 = EVEN_X4(vz1, vz2);
+		vai2 = ODD_X4(vz1, vz2);
+		vz1 = LOAD_X4(zbuf2 - 7);
+		vz2 = LOAD_X4(zbuf2 - 3);
+		vai1 = REVERSE_X4(ODD_X4(vz1, vz2));
+		var2 = REVERSE_X4(EVEN_X4(vz1, vz2));
+
+		vt  = MULSHIFT32_X4(vb, _mm_add_epi32(var1, vai1));
+		vz2 = _mm_sub_epi32(MULSHIFT32_X4(va, vai1), vt);
+		vz1 = _mm_add_epi32(MULSHIFT32_X4(_mm_sub_epi32(va, _mm_slli_epi32(vb, 1)), var1), vt);
+		STORE_X4(zbuf1 + 0, _mm_unpacklo_epi32(vz1, vz2));
+		STORE_X4(zbuf1 + 4, _mm_unpackhi_epi32(vz1, vz2));
+		zbuf1 += 8;
+
+		vt  = MULSHIFT32_X4(vd, _mm_add_epi32(var2, vai2));
+		vz2 = REVERSE_X4(_mm_sub_epi32(MULSHIFT32_X4(vc, vai2), vt));
+		vz1 = REVERSE_X4(_mm_add_epi32(MULSHIFT32_X4(_mm_sub_epi32(vc, _mm_slli_epi32(vd, 1)), var2), vt));
+		STORE_X4(zbuf2 - 7, _mm_unpacklo_epi32(vz1, vz2));
+		STORE_X4(zbuf2 - 3, _mm_unpackhi_epi32(vz1, vz2));
+		zbuf2 -= 8;
+	}
+#endif
 
 	/* whole thing should fit in registers - verify that compiler does this */
-	for (i = 64 >> 2; i != 0; i--) {
+	for (; i != 0; i--) {
 		/* cps2 = (cos+sin), sin2 = sin, cms2 = (cos-sin) */
 		cps2a = *csptr++;	
 		sin2a = *csptr++;
@@ -150,11 +279,12 @@ static void PreMultiply64(int *zbuf1)
 }
 
 /**************************************************************************************
- * Function:    PostMultiply64
+ * Function:    PostMultiply
  *
- * Description: post-twiddle stage of 64-point type-IV DCT
+ * Description: post-twiddle stage of 64-point or 32-point type-IV DCT
  *
- * Inputs:      buffer of 64 samples
+ * Inputs:      buffer of nmdct samples
+ *              transform size (64 or 32)
  *              number of output samples to calculate
  *
  * Outputs:     processed samples in same buffer
@@ -167,15 +297,59 @@ static void PreMultiply64(int *zbuf1)
  *              nSampsOut is rounded up to next multiple of 4, since we calculate
  *                4 samples per loop
  **************************************************************************************/
-static void PostMultiply64(int *fft1, int nSampsOut)
+static void PostMultiply(int *fft1, int nmdct, int nSampsOut)
 {
 	int i, ar1, ai1, ar2, ai2;
 	int t, cms2, cps2, sin2;
 	int *fft2;
 	const int *csptr;
 
-	csptr = cos1sin1tab64;
-	fft2 = fft1 + 64 - 1;
+	csptr = (nmdct == 64 ? cos1sin1tab64 : cos1sin1tab32);
+	fft2 = fft1 + nmdct - 1;
+	i = (nSampsOut + 3) >> 2;
+
+#ifdef AAC_SIMD_SSE41
+	/* 4 iterations per step, lane j holds iteration j (fft2 side in reversed order) */
+	for (; i >= 4; i -= 4) {
+		__m128i va, vb, vcps, vsin, var1, vai1, var2, vai2, vt, vy1, vy2, vz1, vz2;
+
+		va = LOAD_X4(fft1 + 0);
+		vb = LOAD_X4(fft1 + 4);
+		var1 = EVEN_X4(va, vb);
+		vai1 = ODD_X4(va, vb);
+		va = LOAD_X4(fft2 - 7);
+		vb = LOAD_X4(fft2 - 3);
+		var2 = REVERSE_X4(EVEN_X4(va, vb));
+		vai2 = _mm_sub_epi32(_mm_setzero_si128(), REVERSE_X4(ODD_X4(va, vb)));	/* ai2 = -ai2 */
+
+		/* coefficient pairs j for the first half, j + 1 for the second half */
+		va = LOAD_X4(csptr + 0);
+		vb = LOAD_X4(csptr + 4);
+		vcps = EVEN_X4(va, vb);
+		vsin = ODD_X4(va, vb);
+		vt  = MULSHIFT32_X4(vsin, _mm_add_epi32(var1, vai1));
+		vy2 = _mm_sub_epi32(vt, MULSHIFT32_X4(vcps, vai1));
+		vy1 = _mm_add_epi32(vt, MULSHIFT32_X4(_mm_sub_epi32(vcps, _mm_slli_epi32(vsin, 1)), var1));
+
+		va = LOAD_X4(csptr + 2);
+		vb = LOAD_X4(csptr + 6);
+		vcps = EVEN_X4(va, vb);
+		vsin = ODD_X4(va, vb);
+		vt  = MULSHIFT32_X4(vsin, _mm_add_epi32(var2, vai2));
+		vz2 = _mm_sub_epi32(vt, MULSHIFT32_X4(vcps, vai2));
+		vz1 = _mm_add_epi32(vt, MULSHIFT32_X4(_mm_sub_epi32(vcps, _mm_slli_epi32(vsin, 1)), var2));
+		csptr += 8;
+
+		STORE_X4(fft1 + 0, _mm_unpacklo_epi32(vy1, vz1));
+		STORE_X4(fft1 + 4, _mm_unpackhi_epi32(vy1, vz1));
+		fft1 += 8;
+		vy2 = REVERSE_X4(vy2);
+		vz2 = REVERSE_X4(vz2);
+		STORE_X4(fft2 - 7, _mm_unpacklo_epi32(vz2, vy2));
+		STORE_X4(fft2 - 3, _mm_unpackhi_epi32(vz2, vy2));
+		fft2 -= 8;
+	}
+#endif
 
 	/* load coeffs for first pass
 	 * cps2 = (cos+sin)/2, sin2 = sin/2, cms2 = (cos-sin)/2
@@ -184,7 +358,7 @@ static void PostMultiply64(int *fft1, int nSampsOut)
 	sin2 = *csptr++;
 	cms2 = cps2 - 2*sin2;
 
-	for (i = (nSampsOut + 3) >> 2; i != 0; i--) {
+	for (; i != 0; i--) {
 		ar1 = *(fft1 + 0);
 		ai1 = *(fft1 + 1);
 		ar2 = *(fft2 - 1);
@@ -230,6 +404,51 @@ static void PostMultiply64(int *fft1, int nSampsOut)
 // #else
 void QMFAnalysisConv(int *cTab, int *delay, int dIdx, int *uBuf)
 {
+#ifdef AAC_SIMD_SSE41
+	int k, t, dOff;
+	int *cPtr0, *cPtr1;
+	__m128i c[10], d, lo0, lo1, hi0, hi1;
+
+	/* 4 output samples per step, lane i holds sample k+i (the same 64-bit sums as the C code)
+	 * delay[dOff] - delay[dOff-3] never wraps around, since dOff = 3 (mod 4)
+	 */
+	for (k = 0; k < 32; k += 4) {
+		/* transpose coefficients to one vector per tap */
+		cPtr0 = cTab + 5*k;
+		c[0] = LOAD_X4(cPtr0 +  0);
+		c[1] = LOAD_X4(cPtr0 +  5);
+		c[2] = LOAD_X4(cPtr0 + 10);
+		c[3] = LOAD_X4(cPtr0 + 15);
+		TRANSPOSE_X4(&c[0], &c[1], &c[2], &c[3]);
+		c[4] = _mm_setr_epi32(cPtr0[4], cPtr0[9], cPtr0[14], cPtr0[19]);
+
+		cPtr1 = cTab + 33*5 - 1 - 5*k;
+		c[5] = LOADREV_X4(cPtr1 -  0);
+		c[6] = LOADREV_X4(cPtr1 -  5);
+		c[7] = LOADREV_X4(cPtr1 - 10);
+		c[8] = LOADREV_X4(cPtr1 - 15);
+		TRANSPOSE_X4(&c[5], &c[6], &c[7], &c[8]);
+		c[9] = _mm_setr_epi32(cPtr1[-4], cPtr1[-9], cPtr1[-14], cPtr1[-19]);
+
+		/* flip sign to create cTab[384], cTab[512] (see first pass of C code) */
+		if (k == 0) {
+			c[6] = _mm_sign_epi32(c[6], _mm_setr_epi32(-1, 1, 1, 1));
+			c[8] = _mm_sign_epi32(c[8], _mm_setr_epi32(-1, 1, 1, 1));
+		}
+
+		lo0 = lo1 = hi0 = hi1 = _mm_setzero_si128();
+		dOff = dIdx*32 + 31 - k;
+		for (t = 0; t < 10; t += 2) {
+			d = LOADREV_X4(delay + dOff);	dOff -= 32; if (dOff < 0) {dOff += 320;}
+			MADD64_X4(&lo0, &lo1, c[t+0], d);
+			d = LOADREV_X4(delay + dOff);	dOff -= 32; if (dOff < 0) {dOff += 320;}
+			MADD64_X4(&hi0, &hi1, c[t+1], d);
+		}
+
+		STORE_X4(uBuf + k,      HI32_X4(lo0, lo1));
+		STORE_X4(uBuf + k + 32, HI32_X4(hi0, hi1));
+	}
+#else
 	int k, dOff;
 	int *cPtr0, *cPtr1;
 	U64 u64lo, u64hi;
@@ -279,9 +498,98 @@ void QMFAnalysisConv(int *cTab, int *delay, int dIdx, int *uBuf)
 		uBuf++;
 		dOff--;
 	}
+#endif
 }
 //#endif
 
+/**************************************************************************************
+ * Function:    AnalysisLP32
+ *
+ * Description: real-valued (low power) modulation for 32-subband analysis QMF
+ *                (4.6.18.4.1, cosine instead of complex exponential modulation)
+ *
+ * Inputs:      64 samples from QMFAnalysisConv in XBuf[0] - XBuf[63]
+ *              number of subbands to calculate (range = [0, 32])
+ *
+ * Outputs:     qmfaBands real subband samples, format = Q(FBITS_OUT_QMFA)
+ *              stored as RE{X0}, 0, RE{X1}, 0, ... (zero-filled up to XBuf[127])
+ *
+ * Return:      guard bit mask
+ *
+ * Notes:       X[k] = sum(u[n] * 2*cos(pi*(k+0.5)*(2n-96)/64)), which folds to a 
+ *                32-point DCT-III of t[] (cos is even, and odd around n = 80)
+ *              DCT-III is calculated with a 16-point complex FFT (Makhoul), so
+ *                this costs about half of the complex analysis
+ *              minimum 2 GB in uBuf, 1 GB after folding, 3 GB in output
+ **************************************************************************************/
+static int AnalysisLP32(int *XBuf, int qmfaBands)
+{
+	int j, n, ar, ai, br, bi, mr, mi, c, s, gbMask;
+	int *uBuf, *tBuf, *hBuf, *dBuf;
+	const int *csptr;
+
+	uBuf = XBuf;		/* 64 samples from QMFAnalysisConv */
+	tBuf = XBuf + 64;	/* 32 samples after folding */
+	hBuf = XBuf;		/* 17 complex pre-twiddled samples (reuses uBuf) */
+	dBuf = XBuf + 96;	/* 16 complex samples for FFT */
+
+	/* fold around n = 48 (t[j] = u[48+j] + u[48-j]) and n = 16 (t[j] = u[48-j] - u[j-16]) */
+	tBuf[0] = uBuf[48];
+	for (j = 1; j < 16; j++)
+		tBuf[j] = uBuf[48 + j] + uBuf[48 - j];
+	for (     ; j < 32; j++)
+		tBuf[j] = uBuf[48 - j] - uBuf[j - 16];
+
+	/* H[j] = exp(-i*pi*j/64) * (t[j] + i*t[32-j]) / 4, H[0] = t[0] / 2 */
+	csptr = cosSinTabLP32 + 2;
+	hBuf[0] = tBuf[0] >> 1;
+	hBuf[1] = 0;
+	for (j = 1; j <= 16; j++) {
+		c = *csptr++;
+		s = *csptr++;
+		ar = tBuf[j];
+		ai = tBuf[32 - j];
+		hBuf[2*j+0] = MULSHIFT32(c, ar) + MULSHIFT32(s, ai);
+		hBuf[2*j+1] = MULSHIFT32(c, ai) - MULSHIFT32(s, ar);
+	}
+
+	/* split for real output of the 16-point complex FFT
+	 * D[j] = (H[j] + conj(H[16-j])) + i*exp(-i*pi*j/16) * (H[j] - conj(H[16-j])), scaled by 1/8
+	 */
+	csptr = cosSinTabLP16;
+	for (j = 0; j < 16; j++) {
+		c = *csptr++;
+		s = *csptr++;
+		ar =  hBuf[2*j+0];
+		ai =  hBuf[2*j+1];
+		br =  hBuf[2*(16-j)+0];
+		bi = -hBuf[2*(16-j)+1];
+		mr = ar - br;
+		mi = ai - bi;
+		dBuf[2*j+0] = ((ar + br) >> 2) - (MULSHIFT32(c, mi) - MULSHIFT32(s, mr));
+		dBuf[2*j+1] = ((ai + bi) >> 2) + (MULSHIFT32(c, mr) + MULSHIFT32(s, mi));
+	}
+
+	FFT16C(dBuf);	/* 2 GB in, gain 2 int bits */
+
+	/* dBuf[n] = v[n], X[2n] = v[n], X[2n+1] = v[31-n] (fBits lost: 2 in pre-twiddle, 1 in split, 2 in FFT, 2 here) */
+	gbMask = 0;
+	for (n = 0; n < qmfaBands; n++) {
+		j = (n & 0x01 ? 31 - (n >> 1) : (n >> 1));
+		XBuf[2*n+0] = dBuf[j] >> 2;
+		XBuf[2*n+1] = 0;
+		gbMask |= FASTABS(XBuf[2*n+0]);
+	}
+
+	/* fill top section with zeros for HF generation */
+	for (    ; n < 64; n++) {
+		XBuf[2*n+0] = 0;
+		XBuf[2*n+1] = 0;
+	}
+
+	return gbMask;
+}
+
 /**************************************************************************************
  * Function:    QMFAnalysis
  *
@@ -292,6 +600,7 @@ void QMFAnalysisConv(int *cTab, int *delay, int dIdx, int *uBuf)
  *              number of fraction bits in input PCM
  *              index for delay ring buffer (range = [0, 9])
  *              number of subbands to calculate (range = [0, 32])
+ *              1 for the real-valued (low power) analysis, 0 otherwise
  *
  * Outputs:     qmfaBands complex subband samples, format = Q(FBITS_OUT_QMFA)
  *              updated delay buffer
@@ -302,8 +611,9 @@ void QMFAnalysisConv(int *cTab, int *delay, int dIdx, int *uBuf)
  * Notes:       output stored as RE{X0}, IM{X0}, RE{X1}, IM{X1}, ... RE{X31}, IM{X31}
  *              output stored in int buffer of size 64*2 = 128 
  *                (zero-filled from XBuf[2*qmfaBands] to XBuf[127])
+ *              with lowPower the imaginary parts are 0 (see AnalysisLP32)
  **************************************************************************************/
-int QMFAnalysis(int *inbuf, int *delay, int *XBuf, int fBitsIn, int *delayIdx, int qmfaBands)
+int QMFAnalysis(int *inbuf, int *delay, int *XBuf, int fBitsIn, int *delayIdx, int qmfaBands, int lowPower)
 {
 	int n, y, shift, gbMask;
 	int *delayPtr, *uBuf, *tBuf;
@@ -333,6 +643,12 @@ int QMFAnalysis(int *inbuf, int *delay, int *XBuf, int fBitsIn, int *delayIdx, i
 	}
 	
 	QMFAnalysisConv((int *)cTabA, delay, *delayIdx, uBuf);
+
+	if (lowPower) {
+		gbMask = AnalysisLP32(XBuf, qmfaBands);
+		*delayIdx = (*delayIdx == NUM_QMF_DELAY_BUFS - 1 ? 0 : *delayIdx + 1);
+		return gbMask;
+	}
 	
 	/* uBuf has at least 2 GB right now (1 from clipping to Q(FBITS_IN_QMFA), one from
 	 *   the scaling by cTab (MULSHIFT32(*delayPtr--, *cPtr++), with net gain of < 1.0)
@@ -348,9 +664,9 @@ int QMFAnalysis(int *inbuf, int *delay, int *XBuf, int fBitsIn, int *delayIdx, i
     tBuf[2*31 + 0] = -uBuf[33];
 	
 	/* fast in-place DCT-IV - only need 2*qmfaBands output samples */
-	PreMultiply64(tBuf);	/* 2 GB in, 3 GB out */
+	PreMultiply(tBuf, 64);	/* 2 GB in, 3 GB out */
 	FFT32C(tBuf);			/* 3 GB in, 1 GB out */
-	PostMultiply64(tBuf, qmfaBands*2);	/* 1 GB in, 2 GB out */
+	PostMultiply(tBuf, 64, qmfaBands*2);	/* 1 GB in, 2 GB out */
 
 	/* TODO - roll into PostMultiply (if enough registers) */
 	gbMask = 0;
@@ -377,6 +693,42 @@ int QMFAnalysis(int *inbuf, int *delay, int *XBuf, int fBitsIn, int *delayIdx, i
 #define FBITS_OUT_QMFS	(FBITS_IN_QMFS - FBITS_LOST_DCT4_64 + 6 - 1)
 #define RND_VAL			(1 << (FBITS_OUT_QMFS-1))
 
+#ifdef AAC_SIMD_SSE41
+/* coefficients for 4 output samples, one vector per tap (stride = 10 coefficients per output sample) */
+static __inline void SynthesisCoefsX4(const int *cPtr, int stride, __m128i *c)
+{
+	__m128i a, b;
+
+	c[0] = LOAD_X4(cPtr + 0*stride);
+	c[1] = LOAD_X4(cPtr + 1*stride);
+	c[2] = LOAD_X4(cPtr + 2*stride);
+	c[3] = LOAD_X4(cPtr + 3*stride);
+	TRANSPOSE_X4(&c[0], &c[1], &c[2], &c[3]);
+	c[4] = LOAD_X4(cPtr + 0*stride + 4);
+	c[5] = LOAD_X4(cPtr + 1*stride + 4);
+	c[6] = LOAD_X4(cPtr + 2*stride + 4);
+	c[7] = LOAD_X4(cPtr + 3*stride + 4);
+	TRANSPOSE_X4(&c[4], &c[5], &c[6], &c[7]);
+	a = _mm_unpacklo_epi32(_mm_loadl_epi64((const __m128i *)(cPtr + 0*stride + 8)), _mm_loadl_epi64((const __m128i *)(cPtr + 1*stride + 8)));
+	b = _mm_unpacklo_epi32(_mm_loadl_epi64((const __m128i *)(cPtr + 2*stride + 8)), _mm_loadl_epi64((const __m128i *)(cPtr + 3*stride + 8)));
+	c[8] = _mm_unpacklo_epi64(a, b);
+	c[9] = _mm_unpackhi_epi64(a, b);
+}
+
+/* round and clip 4 output samples to 16 bits (same as CLIPTOSHORT), interleaved by factor of nChans */
+static __inline void SynthesisOutX4(__m128i ev, __m128i od, short *outbuf, int nChans)
+{
+	__m128i y;
+
+	y = _mm_srai_epi32(_mm_add_epi32(HI32_X4(ev, od), _mm_set1_epi32(RND_VAL)), FBITS_OUT_QMFS);
+	y = _mm_packs_epi32(y, y);
+	outbuf[0*nChans] = (short)_mm_extract_epi16(y, 0);
+	outbuf[1*nChans] = (short)_mm_extract_epi16(y, 1);
+	outbuf[2*nChans] = (short)_mm_extract_epi16(y, 2);
+	outbuf[3*nChans] = (short)_mm_extract_epi16(y, 3);
+}
+#endif
+
 /**************************************************************************************
  * Function:    QMFSynthesisConv
  *
@@ -403,6 +755,33 @@ int QMFAnalysis(int *inbuf, int *delay, int *XBuf, int fBitsIn, int *delayIdx, i
 // #else
 void QMFSynthesisConv(int *cPtr, int *delay, int dIdx, short *outbuf, int nChans)
 {
+#ifdef AAC_SIMD_SSE41
+	int k, t, dOff0, dOff1;
+	__m128i c[10], ev, od;
+
+	/* 4 output samples per step, lane i holds sample k+i (the same 64-bit sums as the C code)
+	 * delay[dOff0] - delay[dOff0+3] and delay[dOff1] - delay[dOff1-3] never wrap around, 
+	 *   since dOff0 = 0 (mod 4) and dOff1 = 3 (mod 4)
+	 */
+	for (k = 0; k < 64; k += 4) {
+		SynthesisCoefsX4(cPtr, 10, c);
+		cPtr += 4*10;
+
+		dOff0 = dIdx*128 + k;
+		dOff1 = dIdx*128 - 1 - k;
+		if (dOff1 < 0)
+			dOff1 += 1280;
+
+		ev = od = _mm_setzero_si128();
+		for (t = 0; t < 10; t += 2) {
+			MADD64_X4(&ev, &od, c[t+0], LOAD_X4(delay + dOff0));		dOff0 -= 256; if (dOff0 < 0) {dOff0 += 1280;}
+			MADD64_X4(&ev, &od, c[t+1], LOADREV_X4(delay + dOff1));	dOff1 -= 256; if (dOff1 < 0) {dOff1 += 1280;}
+		}
+
+		SynthesisOutX4(ev, od, outbuf, nChans);
+		outbuf += 4*nChans;
+	}
+#else
 	int k, dOff0, dOff1;
 	U64 sum64;
 
@@ -430,21 +809,336 @@ void QMFSynthesisConv(int *cPtr, int *delay, int dIdx, short *outbuf, int nChans
 		*outbuf = CLIPTOSHORT((sum64.r.hi32 + RND_VAL) >> FBITS_OUT_QMFS);
 		outbuf += nChans;
 	}
+#endif
 }
 //#endif
 
+/**************************************************************************************
+ * Function:    QMFSynthesisConvDown
+ *
+ * Description: final convolution kernel for downsampled synthesis QMF
+ *
+ * Inputs:      pointer to coefficient table, reordered for sequential access
+ *              delay buffer of size 64*10 = 640 real samples (see SynthesisDown32)
+ *              index for delay ring buffer (range = [0, 9])
+ *              number of channels
+ *
+ * Outputs:     32 consecutive 16-bit PCM samples, interleaved by factor of nChans
+ *
+ * Return:      none
+ *
+ * Notes:       same as QMFSynthesisConv() with half the delay buffer, using every
+ *                other coefficient of the window (4.6.18.4.3)
+ **************************************************************************************/
+static void QMFSynthesisConvDown(int *cPtr, int *delay, int dIdx, short *outbuf, int nChans)
+{
+#ifdef AAC_SIMD_SSE41
+	int k, t, dOff0, dOff1;
+	__m128i c[10], ev, od;
+
+	/* 4 output samples per step, as in QMFSynthesisConv()
+	 * delay[dOff0] - delay[dOff0+3] and delay[dOff1] - delay[dOff1-3] never wrap around, 
+	 *   since dOff0 = 0 (mod 4) and dOff1 = 3 (mod 4)
+	 */
+	for (k = 0; k < 32; k += 4) {
+		SynthesisCoefsX4(cPtr, 20, c);
+		cPtr += 4*20;
+
+		dOff0 = dIdx*64 + k;
+		dOff1 = dIdx*64 - 1 - k;
+		if (dOff1 < 0)
+			dOff1 += 640;
+
+		ev = od = _mm_setzero_si128();
+		for (t = 0; t < 10; t += 2) {
+			MADD64_X4(&ev, &od, c[t+0], LOAD_X4(delay + dOff0));		dOff0 -= 128; if (dOff0 < 0) {dOff0 += 640;}
+			MADD64_X4(&ev, &od, c[t+1], LOADREV_X4(delay + dOff1));	dOff1 -= 128; if (dOff1 < 0) {dOff1 += 640;}
+		}
+
+		SynthesisOutX4(ev, od, outbuf, nChans);
+		outbuf += 4*nChans;
+	}
+#else
+	int k, dOff0, dOff1;
+	U64 sum64;
+
+	dOff0 = (dIdx)*64;
+	dOff1 = dOff0 - 1;
+	if (dOff1 < 0)
+		dOff1 += 640;
+
+	for (k = 0; k <= 31; k++) {
+		sum64.w64 = 0;
+		sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff0]);	dOff0 -= 128; if (dOff0 < 0) {dOff0 += 640;}
+		sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff1]);	dOff1 -= 128; if (dOff1 < 0) {dOff1 += 640;}
+		sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff0]);	dOff0 -= 128; if (dOff0 < 0) {dOff0 += 640;}
+		sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff1]);	dOff1 -= 128; if (dOff1 < 0) {dOff1 += 640;}
+		sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff0]);	dOff0 -= 128; if (dOff0 < 0) {dOff0 += 640;}
+		sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff1]);	dOff1 -= 128; if (dOff1 < 0) {dOff1 += 640;}
+		sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff0]);	dOff0 -= 128; if (dOff0 < 0) {dOff0 += 640;}
+		sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff1]);	dOff1 -= 128; if (dOff1 < 0) {dOff1 += 640;}
+		sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff0]);	dOff0 -= 128; if (dOff0 < 0) {dOff0 += 640;}
+		sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff1]);	dOff1 -= 128; if (dOff1 < 0) {dOff1 += 640;}
+
+		/* skip the coefficients of the odd output sample */
+		cPtr += 10;
+		dOff0++;
+		dOff1--;
+		*outbuf = CLIPTOSHORT((sum64.r.hi32 + RND_VAL) >> FBITS_OUT_QMFS);
+		outbuf += nChans;
+	}
+#endif
+}
+
+/**************************************************************************************
+ * Function:    SynthesisDown32
+ *
+ * Description: complex modulation for 32-subband downsampled synthesis QMF
+ *                (4.6.18.4.3)
+ *
+ * Inputs:      32 consecutive complex subband QMF samples, format = Q(FBITS_IN_QMFS)
+ *              number of QMF subbands to process (range = [0, 32])
+ *
+ * Outputs:     64 samples for the newest slot of the delay buffer, v[n] in tBuf[n]
+ *                (n < 32) and in tBuf[95-n] (n >= 32)
+ *
+ * Return:      none
+ *
+ * Notes:       v[n] = RE{sum(X[k] * exp(i*pi*(k+0.5)*(2n-127.5)/64))} / 64, so the 
+ *                output is the even samples of the 64-subband synthesis with the 
+ *                upper 32 subbands set to zero
+ *              rotating X[k] by exp(-i*pi*(k+0.5)/128) makes this two 32-point 
+ *                DCT-IV's, calculated with 16-point complex FFT's, instead of two 
+ *                64-point DCT-IV's
+ *              rotation is Q31, so fBits lost = FBITS_LOST_DCT4_64 as in the 
+ *                64-subband synthesis (1 in rotation, 2 in premul, 2 in FFT, 
+ *                2 in postmul)
+ *              assumes MIN_GBITS_IN_QMFS guard bits in input
+ **************************************************************************************/
+static void SynthesisDown32(int *inbuf, int *tBuf, int qmfsBands)
+{
+	int k, a0, a1, b0, b1, c, s;
+	int *tBufLo, *tBufHi;
+	const int *csptr;
+
+	/* reorder inputs to DCT-IV (real parts forward, imaginary parts reversed), 2 GB in, 2 GB out */
+	tBufLo = tBuf;
+	tBufHi = tBuf + 63;
+	csptr = cosSinTabDown32;
+	for (k = 0; k < qmfsBands; k++) {
+		a0 = *inbuf++;
+		b0 = *inbuf++;
+		c = *csptr++;
+		s = *csptr++;
+		*tBufLo++ = MULSHIFT32(c, a0) + MULSHIFT32(s, b0);
+		*tBufHi-- = MULSHIFT32(c, b0) - MULSHIFT32(s, a0);
+	}
+	for (     ; k < 32; k++) {
+		*tBufLo++ = 0;
+		*tBufHi-- = 0;
+	}
+
+	tBufLo = tBuf + 0;
+	tBufHi = tBuf + 32;
+
+	/* 2 GB in, 3 GB out */
+	PreMultiply(tBufLo, 32);
+	PreMultiply(tBufHi, 32);
+
+	/* 3 GB in, 1 GB out */
+	FFT16C(tBufLo);
+	FFT16C(tBufHi);
+
+	/* 1 GB in, 2 GB out */
+	PostMultiply(tBufLo, 32, 32);
+	PostMultiply(tBufHi, 32, 32);
+
+	/* same combination as the 64-subband synthesis, in place */
+	for (k = 0; k < 32; k += 2) {
+		a0 =  tBufLo[k+0];
+		a1 =  tBufLo[k+1];
+		b0 =  tBufHi[k+0];
+		b1 = -tBufHi[k+1];
+
+		tBufLo[k+0] = (b0 - a0);
+		tBufLo[k+1] = (b1 - a1);
+		tBufHi[k+0] = (b0 + a0);
+		tBufHi[k+1] = (b1 + a1);
+	}
+}
+
+/**************************************************************************************
+ * Function:    SynthesisLP64
+ *
+ * Description: real-valued (low power) modulation for 64-subband synthesis QMF
+ *                (4.6.18.4.2, cosine instead of complex exponential modulation)
+ *
+ * Inputs:      64 consecutive subband QMF samples (only real parts are used), 
+ *                format = Q(FBITS_IN_QMFS)
+ *              number of QMF subbands to process (range = [0, 64])
+ *
+ * Outputs:     128 samples for the newest slot of the delay buffer, in the same
+ *                order and format as the complex synthesis
+ *
+ * Return:      none
+ *
+ * Notes:       v[n] = sum(X[k] * 2*cos(pi*(k+0.5)*(2n-64)/128)) / 64, which is a 
+ *                64-point DCT-II Y[] of X[] (v[n] = Y[n-32], v[32-n] = Y[n], 
+ *                v[160-n] = -Y[n])
+ *              DCT-II is calculated with one 32-point complex FFT (Makhoul), 
+ *                instead of two 64-point DCT-IV's for the complex synthesis
+ *              assumes MIN_GBITS_IN_QMFS guard bits in input
+ **************************************************************************************/
+static void SynthesisLP64(int *inbuf, int *tBuf, int qmfsBands)
+{
+	int k, m, n, ar, ai, br, bi, pr, pi, qr, qi, y0, y1;
+	int zBuf[64];
+	const int *csptr;
+
+	/* reorder for DCT-II (z[n] = X[2n], z[63-n] = X[2n+1]), 3 GB for FFT */
+	for (n = 0; n < 32; n++) {
+		k = 2*n;
+		zBuf[n] =      (k < qmfsBands ? inbuf[2*k] >> 1 : 0);
+		k++;
+		zBuf[63 - n] = (k < qmfsBands ? inbuf[2*k] >> 1 : 0);
+	}
+
+	FFT32C(zBuf);	/* 3 GB in, 1 GB out */
+
+	/* split for real input of the 32-point complex FFT, and post-twiddle
+	 *   P = Z[m] + conj(Z[32-m]), Q = Z[m] - conj(Z[32-m]) 
+	 *   Y[m]    = ( RE{exp(-i*pi*m/128)*P} + IM{exp(-i*5*pi*m/128)*Q}) / 2
+	 *   Y[64-m] = (-IM{exp(-i*pi*m/128)*P} + RE{exp(-i*5*pi*m/128)*Q}) / 2
+	 * output is Y[m] / 64, same as the complex synthesis
+	 */
+	csptr = cosSinTabLP64;
+	for (m = 0; m <= 32; m++) {
+		ar =  zBuf[2*(m & 31)+0] >> 1;
+		ai =  zBuf[2*(m & 31)+1] >> 1;
+		br =  zBuf[2*((32-m) & 31)+0] >> 1;
+		bi = -zBuf[2*((32-m) & 31)+1] >> 1;
+		pr = ar + br;	pi = ai + bi;
+		qr = ar - br;	qi = ai - bi;
+
+		ar = MULSHIFT32(csptr[0], pr) + MULSHIFT32(csptr[1], pi);
+		ai = MULSHIFT32(csptr[0], pi) - MULSHIFT32(csptr[1], pr);
+		br = MULSHIFT32(csptr[2], qr) + MULSHIFT32(csptr[3], qi);
+		bi = MULSHIFT32(csptr[2], qi) - MULSHIFT32(csptr[3], qr);
+		csptr += 4;
+
+		y0 = ar + bi;	/* Y[m] */
+		y1 = br - ai;	/* Y[64-m] */
+
+		/* the complex synthesis stores v[n] in tBuf[n] (n < 64) and in tBuf[191-n] (n >= 64) */
+		if (m == 0) {
+			tBuf[32] = y0;
+			tBuf[95] = 0;
+		} else if (m == 32) {
+			tBuf[0] = y0;
+			tBuf[127] = y0;
+		} else {
+			tBuf[32 - m] =  y0;
+			tBuf[32 + m] =  y0;
+			tBuf[95 - m] = -y1;
+			tBuf[95 + m] =  y1;
+		}
+	}
+}
+
+/**************************************************************************************
+ * Function:    SynthesisLP32
+ *
+ * Description: real-valued (low power) modulation for 32-subband downsampled 
+ *                synthesis QMF
+ *
+ * Inputs:      32 consecutive subband QMF samples (only real parts are used), 
+ *                format = Q(FBITS_IN_QMFS)
+ *              number of QMF subbands to process (range = [0, 32])
+ *
+ * Outputs:     64 samples for the newest slot of the delay buffer, in the same
+ *                order and format as SynthesisDown32
+ *
+ * Return:      none
+ *
+ * Notes:       the even samples of SynthesisLP64, v[n] = sum(X[k] * 2*cos(pi*(k+0.5)*
+ *                (n-16)/32)) / 64, which is a 32-point DCT-II Y[] of X[] (v[n] = Y[n-16], 
+ *                v[16-n] = Y[n], v[80-n] = -Y[n])
+ *              DCT-II is calculated with one 16-point complex FFT (Makhoul)
+ *              post-twiddle uses every other entry of cosSinTabLP64
+ *              assumes MIN_GBITS_IN_QMFS guard bits in input
+ **************************************************************************************/
+static void SynthesisLP32(int *inbuf, int *tBuf, int qmfsBands)
+{
+	int k, m, n, ar, ai, br, bi, pr, pi, qr, qi, y0, y1;
+	int zBuf[32];
+	const int *csptr;
+
+	/* reorder for DCT-II (z[n] = X[2n], z[31-n] = X[2n+1]), 3 GB for FFT */
+	for (n = 0; n < 16; n++) {
+		k = 2*n;
+		zBuf[n] =      (k < qmfsBands ? inbuf[2*k] >> 1 : 0);
+		k++;
+		zBuf[31 - n] = (k < qmfsBands ? inbuf[2*k] >> 1 : 0);
+	}
+
+	FFT16C(zBuf);	/* 3 GB in, 1 GB out */
+
+	/* split and post-twiddle as in SynthesisLP64, with one more bit of scaling to 
+	 *   make up for the smaller gain of FFT16C
+	 *   Y[m]    = ( RE{exp(-i*pi*m/64)*P} + IM{exp(-i*5*pi*m/64)*Q}) / 2
+	 *   Y[32-m] = (-IM{exp(-i*pi*m/64)*P} + RE{exp(-i*5*pi*m/64)*Q}) / 2
+	 */
+	csptr = cosSinTabLP64;
+	for (m = 0; m <= 16; m++) {
+		ar =  zBuf[2*(m & 15)+0] >> 2;
+		ai =  zBuf[2*(m & 15)+1] >> 2;
+		br =  zBuf[2*((16-m) & 15)+0] >> 2;
+		bi = -zBuf[2*((16-m) & 15)+1] >> 2;
+		pr = ar + br;	pi = ai + bi;
+		qr = ar - br;	qi = ai - bi;
+
+		ar = MULSHIFT32(csptr[0], pr) + MULSHIFT32(csptr[1], pi);
+		ai = MULSHIFT32(csptr[0], pi) - MULSHIFT32(csptr[1], pr);
+		br = MULSHIFT32(csptr[2], qr) + MULSHIFT32(csptr[3], qi);
+		bi = MULSHIFT32(csptr[2], qi) - MULSHIFT32(csptr[3], qr);
+		csptr += 8;
+
+		y0 = ar + bi;	/* Y[m] */
+		y1 = br - ai;	/* Y[32-m] */
+
+		/* v[n] in tBuf[n] (n < 32) and in tBuf[95-n] (n >= 32) */
+		if (m == 0) {
+			tBuf[16] = y0;
+			tBuf[47] = 0;
+		} else if (m == 16) {
+			tBuf[0] = y0;
+			tBuf[63] = y0;
+		} else {
+			tBuf[16 - m] =  y0;
+			tBuf[16 + m] =  y0;
+			tBuf[47 - m] = -y1;
+			tBuf[47 + m] =  y1;
+		}
+	}
+}
+
 /**************************************************************************************
  * Function:    QMFSynthesis
  *
- * Description: 64-subband synthesis QMF (4.6.18.4.2)
+ * Description: 64-subband synthesis QMF (4.6.18.4.2), or 32-subband downsampled
+ *                synthesis QMF (4.6.18.4.3)
  *
  * Inputs:      64 consecutive complex subband QMF samples, format = Q(FBITS_IN_QMFS)
  *              delay buffer of size 64*10 = 640 complex samples (1280 ints)
  *              index for delay ring buffer (range = [0, 9])
- *              number of QMF subbands to process (range = [0, 64])
+ *              number of QMF subbands to process (range = [0, 64], only [0, 32] 
+ *                are used if downsampled)
  *              number of channels
+ *              1 for the downsampled synthesis, 0 otherwise
+ *              1 for the real-valued (low power) synthesis, 0 otherwise
  *
- * Outputs:     64 consecutive 16-bit PCM samples, interleaved by factor of nChans
+ * Outputs:     64 consecutive 16-bit PCM samples (32 if downsampled), interleaved
+ *                by factor of nChans
  *              updated delay buffer
  *              updated delay index
  *
@@ -452,76 +1146,94 @@ void QMFSynthesisConv(int *cPtr, int *delay, int dIdx, short *outbuf, int nChans
  *
  * Notes:       assumes MIN_GBITS_IN_QMFS guard bits in input, either from
  *                QMFAnalysis (if upsampling only) or from MapHF (if SBR on)
+ *              the downsampled synthesis only uses the lower 32 subbands, with 
+ *                32-point transforms (SynthesisDown32, SynthesisLP32) and the first 
+ *                64*10 = 640 ints of the delay buffer, and its output equals the 
+ *                even output samples of the 64-subband synthesis (within rounding)
+ *              with lowPower only the real parts of the input are used (see 
+ *                SynthesisLP64), the convolution is the same
  **************************************************************************************/
-void QMFSynthesis(int *inbuf, int *delay, int *delayIdx, int qmfsBands, short *outbuf, int nChans)
+void QMFSynthesis(int *inbuf, int *delay, int *delayIdx, int qmfsBands, short *outbuf, int nChans, int downsampled, int lowPower)
 {
 	int n, a0, a1, b0, b1, dOff0, dOff1, dIdx;
 	int *tBufLo, *tBufHi;
 
 	dIdx = *delayIdx;
-	tBufLo = delay + dIdx*128 + 0;
-	tBufHi = delay + dIdx*128 + 127;
+	if (downsampled) {
+		if (lowPower)
+			SynthesisLP32(inbuf, delay + dIdx*64, MIN(qmfsBands, 32));
+		else
+			SynthesisDown32(inbuf, delay + dIdx*64, MIN(qmfsBands, 32));
+	} else if (lowPower) {
+		SynthesisLP64(inbuf, delay + dIdx*128, qmfsBands);
+	} else {
+		tBufLo = delay + dIdx*128 + 0;
+		tBufHi = delay + dIdx*128 + 127;
 
-	/* reorder inputs to DCT-IV, only use first qmfsBands (complex) samples 
-	 * TODO - fuse with PreMultiply64 to avoid separate reordering steps
-	 */
-    for (n = 0; n < qmfsBands >> 1; n++) {
-		a0 = *inbuf++;
-		b0 = *inbuf++;
-		a1 = *inbuf++;
-		b1 = *inbuf++;
-		*tBufLo++ = a0;
-        *tBufLo++ = a1;
-        *tBufHi-- = b0;
-        *tBufHi-- = b1;
-    }
-	if (qmfsBands & 0x01) {
-		a0 = *inbuf++;
-		b0 = *inbuf++;
-		*tBufLo++ = a0;
-        *tBufHi-- = b0;
-        *tBufLo++ = 0;
-		*tBufHi-- = 0;
-		n++;
-	}
-    for (     ; n < 32; n++) {
-		*tBufLo++ = 0;
-        *tBufHi-- = 0;
-        *tBufLo++ = 0;
-        *tBufHi-- = 0;
-	}
+		/* reorder inputs to DCT-IV, only use first qmfsBands (complex) samples 
+		 * TODO - fuse with PreMultiply to avoid separate reordering steps
+		 */
+		for (n = 0; n < qmfsBands >> 1; n++) {
+			a0 = *inbuf++;
+			b0 = *inbuf++;
+			a1 = *inbuf++;
+			b1 = *inbuf++;
+			*tBufLo++ = a0;
+			*tBufLo++ = a1;
+			*tBufHi-- = b0;
+			*tBufHi-- = b1;
+		}
+		if (qmfsBands & 0x01) {
+			a0 = *inbuf++;
+			b0 = *inbuf++;
+			*tBufLo++ = a0;
+			*tBufHi-- = b0;
+			*tBufLo++ = 0;
+			*tBufHi-- = 0;
+			n++;
+		}
+		for (     ; n < 32; n++) {
+			*tBufLo++ = 0;
+			*tBufHi-- = 0;
+			*tBufLo++ = 0;
+			*tBufHi-- = 0;
+		}
 
-	tBufLo = delay + dIdx*128 + 0;
-	tBufHi = delay + dIdx*128 + 64;
+		tBufLo = delay + dIdx*128 + 0;
+		tBufHi = delay + dIdx*128 + 64;
 
-	/* 2 GB in, 3 GB out */
-	PreMultiply64(tBufLo);
-	PreMultiply64(tBufHi);
+		/* 2 GB in, 3 GB out */
+		PreMultiply(tBufLo, 64);
+		PreMultiply(tBufHi, 64);
 
-	/* 3 GB in, 1 GB out */
-	FFT32C(tBufLo);
-	FFT32C(tBufHi);
+		/* 3 GB in, 1 GB out */
+		FFT32C(tBufLo);
+		FFT32C(tBufHi);
 
-	/* 1 GB in, 2 GB out */
-	PostMultiply64(tBufLo, 64);
-	PostMultiply64(tBufHi, 64);
-
-	/* could fuse with PostMultiply64 to avoid separate pass */
-	dOff0 = dIdx*128;
-	dOff1 = dIdx*128 + 64;
-	for (n = 32; n != 0; n--) {
-		a0 =  (*tBufLo++);
-		a1 =  (*tBufLo++);
-		b0 =  (*tBufHi++);
-		b1 = -(*tBufHi++);
-
-		delay[dOff0++] = (b0 - a0);
-		delay[dOff0++] = (b1 - a1);
-		delay[dOff1++] = (b0 + a0);
-		delay[dOff1++] = (b1 + a1);
+		/* 1 GB in, 2 GB out */
+		PostMultiply(tBufLo, 64, 64);
+		PostMultiply(tBufHi, 64, 64);
+
+		/* could fuse with PostMultiply to avoid separate pass */
+		dOff0 = dIdx*128;
+		dOff1 = dIdx*128 + 64;
+		for (n = 32; n != 0; n--) {
+			a0 =  (*tBufLo++);
+			a1 =  (*tBufLo++);
+			b0 =  (*tBufHi++);
+			b1 = -(*tBufHi++);
+
+			delay[dOff0++] = (b0 - a0);
+			delay[dOff0++] = (b1 - a1);
+			delay[dOff1++] = (b0 + a0);
+			delay[dOff1++] = (b1 + a1);
+		}
 	}
 
-	QMFSynthesisConv((int *)cTabS, delay, dIdx, outbuf, nChans);
+	if (downsampled)
+		QMFSynthesisConvDown((int *)cTabS, delay, dIdx, outbuf, nChans);
+	else
+		QMFSynthesisConv((int *)cTabS, delay, dIdx, outbuf, nChans);
 
 	*delayIdx = (*delayIdx == NUM_QMF_DELAY_BUFS - 1 ? 0 : *delayIdx + 1);
 }
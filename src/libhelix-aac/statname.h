@@ -69,6 +69,7 @@
 #define SetRawBlockParams		STATNAME(SetRawBlockParams)
 #define PrepareRawBlock			STATNAME(PrepareRawBlock)
 #define FlushCodec				STATNAME(FlushCodec)
+#define ResetCodec				STATNAME(ResetCodec)
 
 #define UnpackADTSHeader		STATNAME(UnpackADTSHeader)
 #define GetADTSChannelMapping	STATNAME(GetADTSChannelMapping)
@@ -77,8 +78,11 @@
 #define DecodeNoiselessData		STATNAME(DecodeNoiselessData)
 #define Dequantize				STATNAME(Dequantize)
 #define StereoProcess			STATNAME(StereoProcess)
+#define DequantStereoProcess	STATNAME(DequantStereoProcess)
 #define DeinterleaveShortBlocks	STATNAME(DeinterleaveShortBlocks)
 #define PNS						STATNAME(PNS)
+#define GetNoiseState			STATNAME(GetNoiseState)
+#define SetNoiseState			STATNAME(SetNoiseState)
 #define TNSFilter				STATNAME(TNSFilter)
 #define IMDCT					STATNAME(IMDCT)
 
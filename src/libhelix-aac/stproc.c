@@ -53,6 +53,175 @@
  * format = Q30
  */
 
+/**************************************************************************************
+ * Function:    StereoProcessBand
+ *
+ * Description: apply mid-side or intensity stereo to one scalefactor band
+ *
+ * Inputs:      dequantized transform coefficients for both channels
+ *              width of the scalefactor band
+ *              codebook index for right channel
+ *              mid-side mask enabled flag
+ *              mid-side mask bit of this band
+ *              scalefactor for right channel, range = [0, 256]
+ *              guard bit masks for both channels
+ *
+ * Outputs:     updated transform coefficients in Q(FBITS_OUT_DQ_OFF)
+ *              updated guard bit masks (OR of abs value of all processed coefs)
+ *
+ * Return:      none
+ *
+ * Notes:       assume no guard bits in input
+ *              width is a multiple of 4 (see sfBandTabLong/sfBandTabShort)
+ *              gains 0 int bits
+ **************************************************************************************/
+static __inline void StereoProcessBand(int *coefL, int *coefR, int width, int cbIdx, 
+							  int msMaskPres, int msBit, int sfRight, int *gbMaskL, int *gbMaskR)
+{
+//fb
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnarrowing"
+static const int pow14[2][4] PROGMEM = {
+	{ 0xc0000000, 0xb3e407d7, 0xa57d8666, 0x945d819b }, 
+	{ 0x40000000, 0x4c1bf829, 0x5a82799a, 0x6ba27e65 }
+};
+#pragma GCC diagnostic pop
+
+	int sf, cl, cr, scalef, scalei;
+#ifdef AAC_SIMD_SSE41
+	int n;
+	__m128i l, r, lo, hi, cnt, gbL, gbR;
+#endif
+
+	if (cbIdx == 14 || cbIdx == 15) {
+		/* intensity stereo */
+		if (msMaskPres == 1 && msBit)
+			cbIdx ^= 0x01;				/* invert_intensity(): 14 becomes 15, or 15 becomes 14 */
+		sf = -sfRight;					/* negative since we use identity 0.5^(x) = 2^(-x) (see spec) */
+		cbIdx &= 0x01;					/* choose - or + scale factor */
+		scalef = pow14[cbIdx][sf & 0x03];
+		scalei = (sf >> 2) + 2;			/* +2 to compensate for scalef = Q30 */
+		
+#ifdef AAC_SIMD_SSE41
+		gbR = _mm_setzero_si128();
+		if (scalei > 0) {
+			if (scalei > 30)
+				scalei = 30;
+			/* CLIP_2N(cr, 31-scalei) */
+			lo = _mm_set1_epi32(-(1 << (31-scalei)));
+			hi = _mm_set1_epi32((1 << (31-scalei)) - 1);
+			cnt = _mm_cvtsi32_si128(scalei);
+			do {
+				r = MULSHIFT32_C4(scalef, LOAD_X4(coefL));
+				r = _mm_sll_epi32(_mm_min_epi32(_mm_max_epi32(r, lo), hi), cnt);
+				gbR = _mm_or_si128(gbR, _mm_abs_epi32(r));
+				STORE_X4(coefR, r);
+				coefL += 4;
+				coefR += 4;
+				width -= 4;
+			} while (width > 0);
+		} else {
+			scalei = -scalei;
+			if (scalei > 31)
+				scalei = 31;
+			cnt = _mm_cvtsi32_si128(scalei);
+			do {
+				r = _mm_sra_epi32(MULSHIFT32_C4(scalef, LOAD_X4(coefL)), cnt);
+				gbR = _mm_or_si128(gbR, _mm_abs_epi32(r));
+				STORE_X4(coefR, r);
+				coefL += 4;
+				coefR += 4;
+				width -= 4;
+			} while (width > 0);
+		}
+		*gbMaskR |= ORALL_X4(gbR);
+#else
+		if (scalei > 0) {
+			if (scalei > 30)
+				scalei = 30;
+			do {
+				cr = MULSHIFT32(*coefL++, scalef);
+				CLIP_2N(cr, 31-scalei);
+				cr <<= scalei;
+				*gbMaskR |= FASTABS(cr);
+				*coefR++ = cr;
+			} while (--width);
+		} else {
+			scalei = -scalei;
+			if (scalei > 31)
+				scalei = 31;
+			do {
+				cr = MULSHIFT32(*coefL++, scalef) >> scalei;
+				*gbMaskR |= FASTABS(cr);
+				*coefR++ = cr;
+			} while (--width);
+		}
+#endif
+	} else if ( cbIdx != 13 && ((msMaskPres == 1 && msBit) || msMaskPres == 2) ) {
+		/* mid-side stereo (assumes no GB in inputs) */
+#ifdef AAC_SIMD_SSE41
+		gbL = _mm_setzero_si128();
+		gbR = _mm_setzero_si128();
+		do {
+			l = LOAD_X4(coefL);
+			r = LOAD_X4(coefR);
+			if (_mm_testz_si128(_mm_or_si128(_mm_abs_epi32(l), _mm_abs_epi32(r)), _mm_set1_epi32(0xc0000000))) {
+				/* usual case */
+				lo = _mm_add_epi32(l, r);
+				hi = _mm_sub_epi32(l, r);
+				gbL = _mm_or_si128(gbL, _mm_abs_epi32(lo));
+				gbR = _mm_or_si128(gbR, _mm_abs_epi32(hi));
+				STORE_X4(coefL, lo);
+				STORE_X4(coefR, hi);
+			} else {
+				for (n = 0; n < 4; n++) {
+					cl = coefL[n];
+					cr = coefR[n];
+					if ( (FASTABS(cl) | FASTABS(cr)) >> 30 ) {
+						/* avoid overflow (rare) */
+						cl >>= 1;
+						sf = cl + (cr >> 1);	CLIP_2N(sf, 30); 	sf <<= 1;
+						cl = cl - (cr >> 1);	CLIP_2N(cl, 30); 	cl <<= 1;
+					} else {
+						sf = cl + cr;
+						cl -= cr;
+					}
+					coefL[n] = sf;
+					*gbMaskL |= FASTABS(sf);
+					coefR[n] = cl;
+					*gbMaskR |= FASTABS(cl);
+				}
+			}
+			coefL += 4;
+			coefR += 4;
+			width -= 4;
+		} while (width > 0);
+		*gbMaskL |= ORALL_X4(gbL);
+		*gbMaskR |= ORALL_X4(gbR);
+#else
+		do {
+			cl = *coefL;	
+			cr = *coefR;
+
+			if ( (FASTABS(cl) | FASTABS(cr)) >> 30 ) {
+				/* avoid overflow (rare) */
+				cl >>= 1;
+				sf = cl + (cr >> 1);	CLIP_2N(sf, 30); 	sf <<= 1;
+				cl = cl - (cr >> 1);	CLIP_2N(cl, 30); 	cl <<= 1;
+			} else {
+				/* usual case */
+				sf = cl + cr;
+				cl -= cr;
+			}
+
+			*coefL++ = sf;
+			*gbMaskL |= FASTABS(sf);
+			*coefR++ = cl;
+			*gbMaskR |= FASTABS(cl);
+		} while (--width);
+#endif
+	}
+}
 
 /**************************************************************************************
  * Function:    StereoProcessGroup
@@ -80,16 +249,7 @@ static void StereoProcessGroup(int *coefL, int *coefR, const /*short*/ int *sfbT
 							  int msMaskPres, unsigned char *msMaskPtr, int msMaskOffset, int maxSFB, 
 							  unsigned char *cbRight, short *sfRight, int *gbCurrent)
 {
-//fb
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wnarrowing"
-static const int pow14[2][4] PROGMEM = {
-	{ 0xc0000000, 0xb3e407d7, 0xa57d8666, 0x945d819b }, 
-	{ 0x40000000, 0x4c1bf829, 0x5a82799a, 0x6ba27e65 }
-};
-#pragma GCC diagnostic pop
-
-	int sfb, width, cbIdx, sf, cl, cr, scalef, scalei;
+	int sfb, width, cl, cr;
 	int gbMaskL, gbMaskR;
 	unsigned char msMask;
 
@@ -99,65 +259,10 @@ static const int pow14[2][4] PROGMEM = {
 
 	for (sfb = 0; sfb < maxSFB; sfb++) {
 		width = sfbTab[sfb+1] - sfbTab[sfb];	/* assume >= 0 (see sfBandTabLong/sfBandTabShort) */
-		cbIdx = cbRight[sfb];
-
-		if (cbIdx == 14 || cbIdx == 15) {
-			/* intensity stereo */
-			if (msMaskPres == 1 && (msMask & 0x01))
-				cbIdx ^= 0x01;				/* invert_intensity(): 14 becomes 15, or 15 becomes 14 */
-			sf = -sfRight[sfb];				/* negative since we use identity 0.5^(x) = 2^(-x) (see spec) */
-			cbIdx &= 0x01;					/* choose - or + scale factor */
-			scalef = pow14[cbIdx][sf & 0x03];
-			scalei = (sf >> 2) + 2;			/* +2 to compensate for scalef = Q30 */
-			
-			if (scalei > 0) {
-				if (scalei > 30)
-					scalei = 30;
-				do {
-					cr = MULSHIFT32(*coefL++, scalef);
-					CLIP_2N(cr, 31-scalei);
-					cr <<= scalei;
-					gbMaskR |= FASTABS(cr);
-					*coefR++ = cr;
-				} while (--width);
-			} else {
-				scalei = -scalei;
-				if (scalei > 31)
-					scalei = 31;
-				do {
-					cr = MULSHIFT32(*coefL++, scalef) >> scalei;
-					gbMaskR |= FASTABS(cr);
-					*coefR++ = cr;
-				} while (--width);
-			}
-		} else if ( cbIdx != 13 && ((msMaskPres == 1 && (msMask & 0x01)) || msMaskPres == 2) ) {
-			/* mid-side stereo (assumes no GB in inputs) */
-			do {
-				cl = *coefL;	
-				cr = *coefR;
-
-				if ( (FASTABS(cl) | FASTABS(cr)) >> 30 ) {
-					/* avoid overflow (rare) */
-					cl >>= 1;
-					sf = cl + (cr >> 1);	CLIP_2N(sf, 30); 	sf <<= 1;
-					cl = cl - (cr >> 1);	CLIP_2N(cl, 30); 	cl <<= 1;
-				} else {
-					/* usual case */
-					sf = cl + cr;
-					cl -= cr;
-				}
-
-				*coefL++ = sf;
-				gbMaskL |= FASTABS(sf);
-				*coefR++ = cl;
-				gbMaskR |= FASTABS(cl);
-			} while (--width);
-
-		} else {
-			/* nothing to do */
-			coefL += width;
-			coefR += width;
-		}
+		if (width > 0)
+			StereoProcessBand(coefL, coefR, width, cbRight[sfb], msMaskPres, msMask & 0x01, sfRight[sfb], &gbMaskL, &gbMaskR);
+		coefL += width;
+		coefR += width;
 
 		/* get next mask bit (should be branchless on ARM) */
 		msMask >>= 1;
@@ -244,3 +349,135 @@ int StereoProcess(AACDecInfo *aacDecInfo)
 
 	return 0;
 }
+
+/**************************************************************************************
+ * Function:    DequantStereoProcess
+ *
+ * Description: dequantize both channels of a channel pair element and apply mid-side
+ *                and intensity stereo, one scalefactor band at a time
+ *
+ * Inputs:      valid AACDecInfo struct (including unpacked, quantized coefficients
+ *                for both channels)
+ *
+ * Outputs:     dequantized transform coefficients in Q(FBITS_OUT_DQ_OFF)
+ *              flags indicating if intensity and/or PNS is active
+ *              minimum guard bit count for both channels
+ *
+ * Return:      0 if successful, -1 if error
+ *
+ * Notes:       same result as Dequantize() for both channels followed by StereoProcess(),
+ *                but each band is still in the cache when the stereo processing reads it
+ *              without common window there is no stereo processing, the channels are 
+ *                only dequantized
+ **************************************************************************************/
+int DequantStereoProcess(AACDecInfo *aacDecInfo)
+{
+	PSInfoBase *psi;
+	ICSInfo *icsInfo;
+	int gp, win, sfb, width, cb, nSamps, msMaskOffset, mo;
+	int gbMaskL, gbMaskR, gbStereoL, gbStereoR;
+	int *coefL, *coefR;
+	unsigned char *msMaskPtr, *mp, *cbLeft, *cbRight, msMask;
+	short *sfLeft, *sfRight;
+	const /*short*/ int *sfbTab;
+
+	/* validate pointers */
+	if (!aacDecInfo || !aacDecInfo->psInfoBase)
+		return -1;
+	psi = (PSInfoBase *)(aacDecInfo->psInfoBase);
+
+	/* mid-side and intensity stereo require common_window == 1 (see MPEG4 spec, Correction 2, 2004) */
+	if (psi->commonWin != 1 || aacDecInfo->currBlockID != AAC_ID_CPE) {
+		if (Dequantize(aacDecInfo, 0) || Dequantize(aacDecInfo, 1))
+			return -1;
+		return 0;
+	}
+
+	icsInfo = &(psi->icsInfo[0]);
+	if (icsInfo->winSequence == 2) {
+		sfbTab = sfBandTabShort + sfBandTabShortOffset[psi->sampRateIdx];
+		nSamps = NSAMPS_SHORT;
+	} else {
+		sfbTab = sfBandTabLong + sfBandTabLongOffset[psi->sampRateIdx];
+		nSamps = NSAMPS_LONG;
+	}
+	coefL = psi->coef[0];
+	coefR = psi->coef[1];
+	cbLeft = psi->sfbCodeBook[0];
+	cbRight = psi->sfbCodeBook[1];
+	sfLeft = psi->scaleFactors[0];
+	sfRight = psi->scaleFactors[1];
+
+	psi->intensityUsed[0] = psi->intensityUsed[1] = 0;
+	psi->pnsUsed[0] = psi->pnsUsed[1] = 0;
+	gbMaskL = gbMaskR = 0;
+	gbStereoL = gbStereoR = 0;
+	msMaskOffset = 0;
+	msMaskPtr = psi->msMaskBits;
+	for (gp = 0; gp < icsInfo->numWinGroup; gp++) {
+		for (win = 0; win < icsInfo->winGroupLen[gp]; win++) {
+			/* every window of the group starts with the same mask bits */
+			mo = msMaskOffset;
+			mp = msMaskPtr;
+			msMask = (*mp++) >> mo;
+			for (sfb = 0; sfb < icsInfo->maxSFB; sfb++) {
+				/* dequantize one scalefactor band of each channel (see Dequantize) */
+				width = sfbTab[sfb+1] - sfbTab[sfb];
+				cb = (int)(cbLeft[sfb]);
+				if (cb >= 0 && cb <= 11)
+					gbMaskL |= DequantBlock(coefL, width, sfLeft[sfb]);
+				else if (cb == 13)
+					psi->pnsUsed[0] = 1;
+				else if (cb == 14 || cb == 15)
+					psi->intensityUsed[0] = 1;
+				cb = (int)(cbRight[sfb]);
+				if (cb >= 0 && cb <= 11)
+					gbMaskR |= DequantBlock(coefR, width, sfRight[sfb]);
+				else if (cb == 13)
+					psi->pnsUsed[1] = 1;
+				else if (cb == 14 || cb == 15)
+					psi->intensityUsed[1] = 1;
+
+				/* and process it while it is still in the cache */
+				if (width > 0)
+					StereoProcessBand(coefL, coefR, width, cb, psi->msMaskPresent, msMask & 0x01, sfRight[sfb], &gbStereoL, &gbStereoR);
+				coefL += width;
+				coefR += width;
+
+				msMask >>= 1;
+				if (++mo == 8) {
+					msMask = *mp++;
+					mo = 0;
+				}
+			}
+			coefL += (nSamps - sfbTab[icsInfo->maxSFB]);
+			coefR += (nSamps - sfbTab[icsInfo->maxSFB]);
+		}
+		cbLeft += icsInfo->maxSFB;
+		cbRight += icsInfo->maxSFB;
+		sfLeft += icsInfo->maxSFB;
+		sfRight += icsInfo->maxSFB;
+
+		/* we use one bit per sfb, so there are maxSFB bits for each window group */ 
+		msMaskPtr += (msMaskOffset + icsInfo->maxSFB) >> 3;
+		msMaskOffset = (msMaskOffset + icsInfo->maxSFB) & 0x07;
+	}
+	aacDecInfo->pnsUsed |= (psi->pnsUsed[0] | psi->pnsUsed[1]);	/* set flag if PNS used for any channel */
+
+	ASSERT(coefL == psi->coef[0] + 1024);
+	ASSERT(coefR == psi->coef[1] + 1024);
+
+	/* calculate number of guard bits in dequantized data, then after stereo processing */
+	psi->gbCurrent[0] = CLZ(gbMaskL) - 1;
+	psi->gbCurrent[1] = CLZ(gbMaskR) - 1;
+	if (psi->msMaskPresent || psi->intensityUsed[1]) {
+		gbMaskL = CLZ(gbStereoL) - 1;
+		if (psi->gbCurrent[0] > gbMaskL)
+			psi->gbCurrent[0] = gbMaskL;
+		gbMaskR = CLZ(gbStereoR) - 1;
+		if (psi->gbCurrent[1] > gbMaskR)
+			psi->gbCurrent[1] = gbMaskR;
+	}
+
+	return 0;
+}
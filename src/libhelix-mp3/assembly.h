@@ -475,4 +475,41 @@ static __inline Word64 SAR64(Word64 x, int n)
 
 #endif	/* platforms */
 
+/* optional SIMD versions of the DSP kernels, used when the compiler targets SSE4.1 
+ *   (e.g. -msse4.1, -mavx2 or -march=native) - define HELIX_NO_SIMD to force the C versions
+ * all SIMD kernels are bit-exact with the C code
+ */
+#if defined(__SSE4_1__) && !defined(HELIX_NO_SIMD)
+#define MP3_SIMD_SSE41
+
+#include <smmintrin.h>
+
+/* MULSHIFT32 on 4 lanes: upper 32 bits of the signed 64-bit products */
+static __inline __m128i MULSHIFT32_X4(__m128i x, __m128i y)
+{
+	__m128i ev, od;
+
+	ev = _mm_srli_epi64(_mm_mul_epi32(x, y), 32);
+	od = _mm_mul_epi32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32));
+
+	return _mm_blend_epi16(ev, od, 0xcc);
+}
+
+/* FASTABS on 4 lanes */
+static __inline __m128i FASTABS_X4(__m128i x)
+{
+	return _mm_abs_epi32(x);
+}
+
+/* bitwise-OR of the 4 lanes */
+static __inline int ORREDUCE_X4(__m128i x)
+{
+	x = _mm_or_si128(x, _mm_shuffle_epi32(x, 0x4e));
+	x = _mm_or_si128(x, _mm_shuffle_epi32(x, 0xb1));
+
+	return _mm_cvtsi128_si32(x);
+}
+
+#endif	/* __SSE4_1__ */
+
 #endif /* _ASSEMBLY_H */
@@ -63,17 +63,11 @@
  *
  * Return:      none
  *
- * Notes:       slow, platform-independent equivalent to memset(buf, 0, nBytes)
+ * Notes:       wrapper for memset(buf, 0, nBytes), replace if string.h is not available
  **************************************************************************************/
 static void ClearBuffer(void *buf, int nBytes)
 {
-	int i;
-	unsigned char *cbuf = (unsigned char *)buf;
-
-	for (i = 0; i < nBytes; i++)
-		cbuf[i] = 0;
-
-	return;
+	memset(buf, 0, nBytes);
 }
 
 /**************************************************************************************
@@ -87,7 +81,8 @@ static void ClearBuffer(void *buf, int nBytes)
  *
  * Return:      pointer to MP3DecInfo structure (initialized with pointers to all 
  *                the internal buffers needed for decoding, all other members of 
- *                MP3DecInfo structure set to 0)
+ *                MP3DecInfo structure set to 0, except full bandwidth sbLimit and
+ *                downmix in a mono-only build)
  *
  * Notes:       if one or more helix_mallocs fail, function frees any buffers already
  *                allocated before returning
@@ -107,6 +102,8 @@ MP3DecInfo *AllocateBuffers(void)
 	if (!mp3DecInfo)
 		return 0;
 	ClearBuffer(mp3DecInfo, sizeof(MP3DecInfo));
+	mp3DecInfo->sbLimit = NBANDS;
+	mp3DecInfo->downmix = (MAX_NCHAN_OUT < MAX_NCHAN);	/* mono-only build */
 	
 	fh =  (FrameHeader *)     helix_malloc(sizeof(FrameHeader));
 	si =  (SideInfo *)        helix_malloc(sizeof(SideInfo));
@@ -141,6 +138,151 @@ MP3DecInfo *AllocateBuffers(void)
 	return mp3DecInfo;
 }
 
+/* exact size of the block carved by AllocateBuffersPre (caller pointer may need up to MP3_PRE_ALIGN-1 bytes of padding) */
+#define MP3_PRE_USED	(MP3_PRE_ROUND(sizeof(MP3DecInfo)) + MP3_PRE_ROUND(sizeof(FrameHeader)) + \
+						 MP3_PRE_ROUND(sizeof(SideInfo)) + MP3_PRE_ROUND(sizeof(ScaleFactorInfo)) + \
+						 MP3_PRE_ROUND(sizeof(HuffmanInfo)) + MP3_PRE_ROUND(sizeof(DequantInfo)) + \
+						 MP3_PRE_ROUND(sizeof(IMDCTInfo)) + MP3_PRE_ROUND(sizeof(SubbandInfo)))
+
+/* compile-time check that the public estimate in mp3common.h covers the real struct sizes */
+typedef char MP3DecoderPreSizeCheck[(MP3_DECODER_PRE_SIZE >= MP3_PRE_USED + MP3_PRE_ALIGN - 1) ? 1 : -1];
+
+/**************************************************************************************
+ * Function:    CarveBuffer
+ *
+ * Description: take the next cache-line aligned chunk from a caller-provided block
+ *
+ * Inputs:      pointer to current position in block
+ *              pointer to number of bytes left in block
+ *              number of bytes needed
+ *
+ * Outputs:     position and bytes left advanced past the chunk (rounded up to
+ *                MP3_PRE_ALIGN), chunk cleared to 0
+ *
+ * Return:      pointer to chunk, 0 if the block is too small
+ **************************************************************************************/
+static void *CarveBuffer(char **p, int *sz, int nBytes)
+{
+	void *buf = *p;
+
+	nBytes = MP3_PRE_ROUND(nBytes);
+	if (*sz < nBytes)
+		return 0;
+	*p += nBytes;
+	*sz -= nBytes;
+	ClearBuffer(buf, nBytes);
+
+	return buf;
+}
+
+/**************************************************************************************
+ * Function:    AllocateBuffersPre
+ *
+ * Description: lay out all the memory needed for the MP3 decoder in one
+ *                caller-provided block (no heap allocation)
+ *
+ * Inputs:      pointer to start of block
+ *              pointer to size of block in bytes (MP3_DECODER_PRE_SIZE is always enough)
+ *
+ * Outputs:     block pointer and size advanced past the memory used
+ *
+ * Return:      pointer to MP3DecInfo structure (initialized as in AllocateBuffers),
+ *                0 if the block is too small
+ *
+ * Notes:       every structure starts on an MP3_PRE_ALIGN byte boundary
+ *              FreeBuffers() leaves a block laid out this way untouched, the caller
+ *                owns the memory and may reuse it for another stream
+ **************************************************************************************/
+MP3DecInfo *AllocateBuffersPre(void **ptr, int *sz)
+{
+	MP3DecInfo *mp3DecInfo;
+	char *p = (char *)*ptr;
+	int pad;
+
+	pad = (int)(-(size_t)p & (MP3_PRE_ALIGN - 1));
+	if (*sz < pad)
+		return 0;
+	p += pad;
+	*sz -= pad;
+
+	mp3DecInfo = (MP3DecInfo *)CarveBuffer(&p, sz, sizeof(MP3DecInfo));
+	if (!mp3DecInfo)
+		return 0;
+	mp3DecInfo->sbLimit = NBANDS;
+	mp3DecInfo->downmix = (MAX_NCHAN_OUT < MAX_NCHAN);	/* mono-only build */
+	mp3DecInfo->preAllocated = 1;
+
+	mp3DecInfo->FrameHeaderPS =     CarveBuffer(&p, sz, sizeof(FrameHeader));
+	mp3DecInfo->SideInfoPS =        CarveBuffer(&p, sz, sizeof(SideInfo));
+	mp3DecInfo->ScaleFactorInfoPS = CarveBuffer(&p, sz, sizeof(ScaleFactorInfo));
+	mp3DecInfo->HuffmanInfoPS =     CarveBuffer(&p, sz, sizeof(HuffmanInfo));
+	mp3DecInfo->DequantInfoPS =     CarveBuffer(&p, sz, sizeof(DequantInfo));
+	mp3DecInfo->IMDCTInfoPS =       CarveBuffer(&p, sz, sizeof(IMDCTInfo));
+	mp3DecInfo->SubbandInfoPS =     CarveBuffer(&p, sz, sizeof(SubbandInfo));
+
+	if (!mp3DecInfo->FrameHeaderPS || !mp3DecInfo->SideInfoPS || !mp3DecInfo->ScaleFactorInfoPS || 
+		!mp3DecInfo->HuffmanInfoPS || !mp3DecInfo->DequantInfoPS || !mp3DecInfo->IMDCTInfoPS || !mp3DecInfo->SubbandInfoPS)
+		return 0;
+
+	*ptr = p;
+
+	return mp3DecInfo;
+}
+
+/**************************************************************************************
+ * Function:    ResetBuffers
+ *
+ * Description: return the decoder to the state right after AllocateBuffers, without
+ *                touching the heap (for a new stream or after seeking)
+ *
+ * Inputs:      pointer to initialized MP3DecInfo structure
+ *
+ * Outputs:     cleared stream info, bit reservoir, overlap buffers and vbuf
+ *
+ * Return:      none
+ *
+ * Notes:       only clears state which is carried from one granule to the next, all
+ *                other buffers are completely overwritten before use
+ *              settings made through the public API (bandwidth, downmix, output
+ *                format, granule callback) are kept
+ **************************************************************************************/
+void ResetBuffers(MP3DecInfo *mp3DecInfo)
+{
+	IMDCTInfo *mi;
+	SubbandInfo *sbi;
+
+	if (!mp3DecInfo || !mp3DecInfo->IMDCTInfoPS || !mp3DecInfo->SubbandInfoPS)
+		return;
+	mi = (IMDCTInfo *)(mp3DecInfo->IMDCTInfoPS);
+	sbi = (SubbandInfo *)(mp3DecInfo->SubbandInfoPS);
+
+	/* stream info and bit reservoir (mainBuf contents are only valid up to mainDataBytes) */
+	mp3DecInfo->freeBitrateFlag = 0;
+	mp3DecInfo->freeBitrateSlots = 0;
+	mp3DecInfo->bitrate = 0;
+	mp3DecInfo->nChans = 0;
+	mp3DecInfo->samprate = 0;
+	mp3DecInfo->nGrans = 0;
+	mp3DecInfo->nGranSamps = 0;
+	mp3DecInfo->nSlots = 0;
+	mp3DecInfo->layer = 0;
+	mp3DecInfo->version = MPEG1;
+	mp3DecInfo->mainDataBegin = 0;
+	mp3DecInfo->mainDataBytes = 0;
+	mp3DecInfo->monoSpec = 0;
+	ClearBuffer(mp3DecInfo->part23Length, sizeof(mp3DecInfo->part23Length));
+
+	/* IMDCT overlap-add (outBuf is rewritten every granule) */
+	ClearBuffer(mi->overBuf, sizeof(mi->overBuf));
+	ClearBuffer(mi->numPrevIMDCT, sizeof(mi->numPrevIMDCT));
+	ClearBuffer(mi->prevType, sizeof(mi->prevType));
+	ClearBuffer(mi->prevWinSwitch, sizeof(mi->prevWinSwitch));
+	ClearBuffer(mi->gb, sizeof(mi->gb));
+
+	/* polyphase filterbank history */
+	ClearBuffer(sbi, sizeof(SubbandInfo));
+}
+
 #define SAFE_FREE(x)	{if (x)	helix_free(x);	(x) = 0;}	/* helper macro */
 
 /**************************************************************************************
@@ -155,10 +297,11 @@ MP3DecInfo *AllocateBuffers(void)
  * Return:      none
  *
  * Notes:       safe to call even if some buffers were not allocated (uses SAFE_FREE)
+ *              does nothing for a decoder laid out by AllocateBuffersPre()
  **************************************************************************************/
 void FreeBuffers(MP3DecInfo *mp3DecInfo)
 {
-	if (!mp3DecInfo)
+	if (!mp3DecInfo || mp3DecInfo->preAllocated)
 		return;
 
 	SAFE_FREE(mp3DecInfo->FrameHeaderPS);
@@ -87,7 +87,9 @@
 #define BLOCK_SIZE				18
 #define	NBANDS					32
 #define MAX_REORDER_SAMPS		((192-126)*3)		/* largest critical band for short blocks (see sfBandTable) */
-#define VBUF_LENGTH				(17 * 2 * NBANDS)	/* for double-sized vbuf FIFO */
+#define VBUF_STRIDE				(NBANDS * MAX_NCHAN_OUT)	/* ints per vbuf row (channels interleaved) */
+#define VBUF_LENGTH				(17 * VBUF_STRIDE)	/* for double-sized vbuf FIFO */
+#define VBUF_NBLOCKS			16					/* FDCT32 output blocks kept in vbuf (8 offsets, odd and even) */
 
 /* additional external symbols to name-mangle for static linking */
 #define	SetBitstreamPointer	STATNAME(SetBitstreamPointer)
@@ -99,6 +101,10 @@
 #define	IntensityProcMPEG2	STATNAME(IntensityProcMPEG2)
 #define PolyphaseMono		STATNAME(PolyphaseMono)
 #define PolyphaseStereo		STATNAME(PolyphaseStereo)
+#define PolyphaseMonoDown	STATNAME(PolyphaseMonoDown)
+#define PolyphaseStereoDown	STATNAME(PolyphaseStereoDown)
+#define PolyphaseMono32		STATNAME(PolyphaseMono32)
+#define PolyphaseStereo32	STATNAME(PolyphaseStereo32)
 #define FDCT32				STATNAME(FDCT32)
 
 #define	ISFMpeg1			STATNAME(ISFMpeg1)
@@ -183,7 +189,6 @@ typedef struct {
 } CriticalBandInfo;
 
 typedef struct _DequantInfo {
-	int workBuf[MAX_REORDER_SAMPS];		/* workbuf for reordering short blocks */
 	CriticalBandInfo cbi[MAX_NCHAN];	/* filled in dequantizer, used in joint stereo reconstruction */
 } DequantInfo;
 
@@ -209,7 +214,7 @@ typedef struct _HuffTabLookup {
 } HuffTabLookup;
 
 typedef struct _IMDCTInfo {
-	int outBuf[MAX_NCHAN][BLOCK_SIZE][NBANDS];	/* output of IMDCT */	
+	int outBuf[MAX_NCHAN_OUT][BLOCK_SIZE][NBANDS];	/* output of IMDCT */	
 	int overBuf[MAX_NCHAN][MAX_NSAMP / 2];		/* overlap-add buffer (by symmetry, only need 1/2 size) */
 	int numPrevIMDCT[MAX_NCHAN];				/* how many IMDCT's calculated in this channel on prev. granule */
 	int prevType[MAX_NCHAN];
@@ -217,6 +222,15 @@ typedef struct _IMDCTInfo {
 	int gb[MAX_NCHAN];
 } IMDCTInfo;
 
+/* IMDCT output for channel ch - a mono-only build has no outBuf for channel 1 and uses the 
+ *   spectrum of channel 0 instead (same size, free once channel 0 went through the IMDCT)
+ */
+#if MAX_NCHAN_OUT < MAX_NCHAN
+#define IMDCT_OUT(mi, hi, ch)	((ch) == 0 ? (mi)->outBuf[0] : (int (*)[NBANDS])((hi)->huffDecBuf[0]))
+#else
+#define IMDCT_OUT(mi, hi, ch)	((mi)->outBuf[ch])
+#endif
+
 typedef struct _BlockCount {
 	int nBlocksLong;
 	int nBlocksTotal;
@@ -251,8 +265,9 @@ typedef struct _ScaleFactorInfo {
  *   last 15 blocks to shift them down one, a hardware style FIFO)
  */ 
 typedef struct _SubbandInfo {
-	int vbuf[MAX_NCHAN * VBUF_LENGTH];		/* vbuf for fast DCT-based synthesis PQMF - double size for speed (no modulo indexing) */
+	int vbuf[2 * VBUF_LENGTH];				/* vbuf for fast DCT-based synthesis PQMF - even and odd blocks, double size for speed (no modulo indexing) */
 	int vindex;								/* internal index for tracking position in vbuf */
+	int zeroBlocks[MAX_NCHAN_OUT];				/* consecutive all-zero blocks fed into vbuf (saturates at VBUF_NBLOCKS) */
 } SubbandInfo;
 
 /* bitstream.c */
@@ -261,7 +276,7 @@ unsigned int GetBits(BitStreamInfo *bsi, int nBits);
 int CalcBitsUsed(BitStreamInfo *bsi, unsigned char *startBuf, int startOffset);
 
 /* dequant.c, dqchan.c, stproc.c */
-int DequantChannel(int *sampleBuf, int *workBuf, int *nonZeroBound, FrameHeader *fh, SideInfoSub *sis, 
+int DequantChannel(int *sampleBuf, int *nonZeroBound, FrameHeader *fh, SideInfoSub *sis, 
 					ScaleFactorInfoSub *sfis, CriticalBandInfo *cbi);
 void MidSideProc(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, int mOut[2]);
 void IntensityProcMPEG1(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh, ScaleFactorInfoSub *sfis, 
@@ -294,6 +309,10 @@ void PolyphaseStereo(short *pcm, int *vbuf, const int *coefBase);
 #ifdef __cplusplus
 }
 #endif
+void PolyphaseMonoDown(short *pcm, int *vbuf, const int *coefBase, int decimShift);
+void PolyphaseStereoDown(short *pcm, int *vbuf, const int *coefBase, int decimShift);
+void PolyphaseMono32(void *pcm, int *vbuf, const int *coefBase, int decimShift, int isFloat);
+void PolyphaseStereo32(void *pcm, int *vbuf, const int *coefBase, int decimShift, int isFloat);
 
 /* trigtabs.c */
 extern const int imdctWin[4][36];
@@ -57,7 +57,9 @@
  *
  * Outputs:     dequantized and reordered coefficients in hi->huffDecBuf 
  *                (one granule-worth, all channels), format = Q26
- *              operates in-place on huffDecBuf but also needs di->workBuf
+ *              with mono downmix, (L + R) / 2 in channel 0 if mp3DecInfo->monoSpec,
+ *                otherwise L / 2 and R / 2
+ *              operates in-place on huffDecBuf (short blocks are reordered in place)
  *              updated hi->nonZeroBound index for both channels
  *
  * Return:      0 on success, -1 if null input pointers
@@ -97,7 +99,7 @@ int Dequantize(MP3DecInfo *mp3DecInfo, int gr)
 
 	/* dequantize all the samples in each channel */
 	for (ch = 0; ch < mp3DecInfo->nChans; ch++) {
-		hi->gb[ch] = DequantChannel(hi->huffDecBuf[ch], di->workBuf, &hi->nonZeroBound[ch], fh, 
+		hi->gb[ch] = DequantChannel(hi->huffDecBuf[ch], &hi->nonZeroBound[ch], fh, 
 			&si->sis[gr][ch], &sfi->sfis[gr][ch], &cbi[ch]);
 	}
 
@@ -117,6 +119,10 @@ int Dequantize(MP3DecInfo *mp3DecInfo, int gr)
 		}
 	}
 
+	/* mono downmix of a mid-side only frame - the mid channel is (L + R) / 2 already */
+	if (mp3DecInfo->monoSpec && fh->modeExt == 0x02)
+		return 0;
+
 	/* do mid-side stereo processing, if enabled */
 	if (fh->modeExt >> 1) {
 		if (fh->modeExt & 0x01) {
@@ -153,6 +159,25 @@ int Dequantize(MP3DecInfo *mp3DecInfo, int gr)
 		hi->nonZeroBound[1] = nSamps;
 	}
 
+	/* mono downmix - either fold into one spectrum for a single IMDCT, or scale both channels
+	 *   by 1/2 so the IMDCT outputs can be summed (see DownmixOverlap)
+	 */
+	if (mp3DecInfo->downmix && mp3DecInfo->nChans == 2) {
+		nSamps = MAX(hi->nonZeroBound[0], hi->nonZeroBound[1]);
+		if (mp3DecInfo->monoSpec) {
+			for (i = 0; i < nSamps; i++)
+				hi->huffDecBuf[0][i] = (hi->huffDecBuf[0][i] >> 1) + (hi->huffDecBuf[1][i] >> 1);
+			hi->gb[0] = MIN(hi->gb[0], hi->gb[1]);
+			hi->nonZeroBound[0] = nSamps;
+		} else {
+			for (ch = 0; ch < 2; ch++) {
+				for (i = 0; i < hi->nonZeroBound[ch]; i++)
+					hi->huffDecBuf[ch][i] >>= 1;
+				hi->gb[ch] = MIN(hi->gb[ch] + 1, 31);
+			}
+		}
+	}
+
 	/* output format Q(DQ_FRACBITS_OUT) */
 	return 0;
 }
@@ -44,8 +44,6 @@
 #include "coder.h"
 #include "assembly.h"
 
-typedef int ARRAY3[3];	/* for short-block reordering */
-
 /* optional pre-emphasis for high-frequency scale factor bands */
 static const char preTab[22] = { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,2,2,3,3,3,2,0 };
 
@@ -93,6 +91,261 @@ int pow43[] = {
 	0x75722ef9, 0x78102b85, 0x7ab1d3ec, 0x7d571e09, 
 };
 
+#if MP3_USE_LARGE_POW43
+/* pow(j,4/3) for j=64..1023, normalized exactly like the polynomial path in DequantBlock()
+ *   (i.e. bit-exact with it), the matching integer exponent is pow43LargeExp[j >> 6]
+ */
+#define POW43_LARGE_MAX		1024
+
+static const int pow43Large[POW43_LARGE_MAX - 64] = {
+	0x1fffffc0, 0x20ab1c28, 0x21571988, 0x2203f5b8,
+	0x22b1ae90, 0x236041e8, 0x240fadb0, 0x24bfefe0,
+	0x25710670, 0x2622ef70, 0x26d5a8e8, 0x27893100,
+	0x283d85d0, 0x28f2a598, 0x29a88e80, 0x2a5f3ed8,
+	0x2b16b4e8, 0x2bceef10, 0x2c87eba0, 0x2d41a908,
+	0x2dfc25c8, 0x2eb76058, 0x2f735738, 0x30300908,
+	0x30ed7458, 0x31ab97d0, 0x326a7228, 0x332a0140,
+	0x33ea44d8, 0x34ab3af0, 0x356ce248, 0x362f39a0,
+	0x36f23fd0, 0x37b5f3a0, 0x387a53e8, 0x393f5f80,
+	0x3a051540, 0x3acb7400, 0x3b927ab0, 0x3c5a2830,
+	0x3d227b68, 0x3deb7350, 0x3eb50ed0, 0x3f7f4ce8,
+	0x404a2c88, 0x4115acc0, 0x41e1cc78, 0x42ae8ac8,
+	0x437be6b8, 0x4449df58, 0x451873b0, 0x45e7a2d8,
+	0x46b76bf0, 0x4787ce18, 0x4858c868, 0x492a5a08,
+	0x49fc8220, 0x4acf3fe0, 0x4ba29278, 0x4c767920,
+	0x4d4af310, 0x4e1fff80, 0x4ef59db0, 0x4fcbcce8,
+	0x285145a8, 0x28bced10, 0x2928dbb8, 0x29951140,
+	0x2a018d48, 0x2a6e4f80, 0x2adb5788, 0x2b48a518,
+	0x2bb637c8, 0x2c240f58, 0x2c922b58, 0x2d008b98,
+	0x2d6f2fa0, 0x2dde1738, 0x2e4d4200, 0x2ebcafb8,
+	0x2f2c6000, 0x2f9c5290, 0x300c8718, 0x307cfd48,
+	0x30edb4d8, 0x315ead80, 0x31cfe6f0, 0x324160d8,
+	0x32b31af8, 0x33251500, 0x33974eb0, 0x3409c7b8,
+	0x347c7fd8, 0x34ef76c8, 0x3562ac48, 0x35d62008,
+	0x3649d1d0, 0x36bdc158, 0x3731ee60, 0x37a658a0,
+	0x381affe8, 0x388fe3f0, 0x39050470, 0x397a6138,
+	0x39effa00, 0x3a65ce98, 0x3adbdeb8, 0x3b522a30,
+	0x3bc8b0b8, 0x3c3f7228, 0x3cb66e38, 0x3d2da4b8,
+	0x3da51570, 0x3e1cc030, 0x3e94a4b8, 0x3f0cc2d8,
+	0x3f851a58, 0x3ffdab10, 0x407673c0, 0x40ef75f0,
+	0x4168b090, 0x41e22360, 0x425bce38, 0x42d5b0e8,
+	0x434fcb40, 0x43ca1d00, 0x4444a608, 0x44bf6620,
+	0x453a5d10, 0x45b58ab8, 0x4630eee8, 0x46ac8960,
+	0x47285a00, 0x47a46090, 0x48209cf0, 0x489d0ee0,
+	0x4919b640, 0x499692d8, 0x4a13a488, 0x4a90eb18,
+	0x4b0e6660, 0x4b8c1630, 0x4c09fa60, 0x4c8812c0,
+	0x4d065f30, 0x4d84df80, 0x4e039378, 0x4e827b00,
+	0x4f0195e8, 0x4f80e408, 0x50006528, 0x50801938,
+	0x50fffff8, 0x51801950, 0x52006510, 0x5280e310,
+	0x53019328, 0x53827538, 0x54038910, 0x5484ce90,
+	0x55064588, 0x5587ede0, 0x5609c770, 0x568bd208,
+	0x570e0d88, 0x579079d0, 0x581316b8, 0x5895e410,
+	0x5918e1d0, 0x599c0fb8, 0x5a1f6db8, 0x5aa2fba8,
+	0x5b26b960, 0x5baaa6c0, 0x5c2ec3a8, 0x5cb30ff8,
+	0x5d378b88, 0x5dbc3640, 0x5e410ff8, 0x5ec61898,
+	0x5f4b4ff0, 0x5fd0b5f0, 0x60564a70, 0x60dc0d58,
+	0x6161fe78, 0x61e81dc8, 0x626e6b20, 0x62f4e660,
+	0x637b8f68, 0x64026620, 0x64896a70, 0x65109c28,
+	0x32cbfce8, 0x330fc300, 0x33539f98, 0x339792a0,
+	0x33db9c08, 0x341fbbc8, 0x3463f1c8, 0x34a83df8,
+	0x34eca058, 0x353118d0, 0x3575a758, 0x35ba4bd8,
+	0x35ff0650, 0x3643d6a8, 0x3688bcd8, 0x36cdb8d0,
+	0x3712ca88, 0x3757f1e8, 0x379d2ef0, 0x37e28180,
+	0x3827e9a0, 0x386d6738, 0x38b2fa38, 0x38f8a298,
+	0x393e6050, 0x39843340, 0x39ca1b78, 0x3a1018d0,
+	0x3a562b48, 0x3a9c52d8, 0x3ae28f68, 0x3b28e0f8,
+	0x3b6f4770, 0x3bb5c2c8, 0x3bfc52f8, 0x3c42f7e8,
+	0x3c89b198, 0x3cd07ff8, 0x3d1762f8, 0x3d5e5a90,
+	0x3da566b8, 0x3dec8758, 0x3e33bc70, 0x3e7b05f0,
+	0x3ec263c8, 0x3f09d5f8, 0x3f515c68, 0x3f98f710,
+	0x3fe0a5e8, 0x402868e0, 0x40703ff0, 0x40b82b08,
+	0x41002a20, 0x41483d30, 0x41906428, 0x41d89f00,
+	0x4220edb0, 0x42695028, 0x42b1c658, 0x42fa5040,
+	0x4342edd0, 0x438b9ef8, 0x43d463b8, 0x441d3c00,
+	0x446627c8, 0x44af2700, 0x44f839a8, 0x45415fa8,
+	0x458a9900, 0x45d3e5a0, 0x461d4580, 0x4666b898,
+	0x46b03ee0, 0x46f9d848, 0x474384c8, 0x478d4450,
+	0x47d716e0, 0x4820fc70, 0x486af4f0, 0x48b50058,
+	0x48ff1e98, 0x49494fb0, 0x49939398, 0x49ddea38,
+	0x4a285398, 0x4a72cfa8, 0x4abd5e60, 0x4b07ffb0,
+	0x4b52b398, 0x4b9d7a08, 0x4be852f8, 0x4c333e68,
+	0x4c7e3c40, 0x4cc94c88, 0x4d146f28, 0x4d5fa428,
+	0x4daaeb70, 0x4df644f8, 0x4e41b0c8, 0x4e8d2ec8,
+	0x4ed8bef0, 0x4f246140, 0x4f7015a8, 0x4fbbdc28,
+	0x5007b4b8, 0x50539f40, 0x509f9bd0, 0x50eba920,
+	0x5137c970, 0x5183fb90, 0x51d03f80, 0x521c9538,
+	0x5268fca8, 0x52b575d0, 0x530200a8, 0x534e9d20,
+	0x539b4b38, 0x53e80ae8, 0x5434dc28, 0x5481bee8,
+	0x54ceb328, 0x551bb8e0, 0x5568d008, 0x55b5f898,
+	0x56033288, 0x56507dd0, 0x569dda68, 0x56eb4848,
+	0x5738c768, 0x578657c8, 0x57d3f950, 0x5821ac10,
+	0x586f6fe8, 0x58bd44e0, 0x590b2af0, 0x59592210,
+	0x59a72a30, 0x59f54350, 0x5a436d68, 0x5a91a870,
+	0x5adff460, 0x5b2e5138, 0x5b7cbee0, 0x5bcb3d60,
+	0x5c19ccb0, 0x5c686cc0, 0x5cb71d90, 0x5d05df18,
+	0x5d54b150, 0x5da39430, 0x5df287b0, 0x5e418bc8,
+	0x5e90a078, 0x5edfc5b0, 0x5f2efb78, 0x5f7e41b8,
+	0x5fcd9870, 0x601cff98, 0x606c7730, 0x60bbff28,
+	0x610b9780, 0x615b4028, 0x61aaf928, 0x61fac268,
+	0x624a9bf0, 0x629a85b0, 0x62ea7fa8, 0x633a89d0,
+	0x638aa418, 0x63dace88, 0x642b0910, 0x647b53b0,
+	0x64cbae58, 0x651c1908, 0x656c93b8, 0x65bd1e68,
+	0x660db908, 0x665e6398, 0x66af1e08, 0x66ffe860,
+	0x6750c290, 0x67a1ac98, 0x67f2a668, 0x6843b008,
+	0x6894c960, 0x68e5f278, 0x69372b48, 0x698873c8,
+	0x69d9cbf0, 0x6a2b33b8, 0x6a7cab20, 0x6ace3218,
+	0x6b1fc8a8, 0x6b716ec8, 0x6bc32468, 0x6c14e988,
+	0x6c66be20, 0x6cb8a228, 0x6d0a95a0, 0x6d5c9880,
+	0x6daeaac8, 0x6e00cc68, 0x6e52fd60, 0x6ea53da8,
+	0x6ef78d38, 0x6f49ec10, 0x6f9c5a28, 0x6feed778,
+	0x70416400, 0x7093ffb8, 0x70e6aa90, 0x71396498,
+	0x718c2db8, 0x71df05f0, 0x7231ed40, 0x7284e398,
+	0x72d7e900, 0x732afd60, 0x737e20c8, 0x73d15328,
+	0x74249478, 0x7477e4b0, 0x74cb43d8, 0x751eb1e0,
+	0x75722ec8, 0x75c5ba90, 0x76195520, 0x766cfe88,
+	0x76c0b6b0, 0x77147da0, 0x77685358, 0x77bc37c0,
+	0x78102ae0, 0x78642cb0, 0x78b83d28, 0x790c5c48,
+	0x79608a10, 0x79b4c670, 0x7a091168, 0x7a5d6af0,
+	0x7ab1d308, 0x7b0649a8, 0x7b5aced0, 0x7baf6270,
+	0x7c040490, 0x7c58b528, 0x7cad7430, 0x7d0241a0,
+	0x7d571d80, 0x7dac07c0, 0x7e010058, 0x7e560758,
+	0x7eab1ca0, 0x7f004040, 0x7f557230, 0x7faab260,
+	0x1fffffc0, 0x201556f0, 0x202ab1a0, 0x20400fe8,
+	0x205571b0, 0x206ad700, 0x20803fe0, 0x2095ac40,
+	0x20ab1c28, 0x20c08f90, 0x20d60680, 0x20eb80f0,
+	0x2100fee0, 0x21168048, 0x212c0538, 0x21418da0,
+	0x21571988, 0x216ca8f0, 0x21823bc8, 0x2197d220,
+	0x21ad6be8, 0x21c30930, 0x21d8a9e8, 0x21ee4e18,
+	0x2203f5b8, 0x2219a0d0, 0x222f4f58, 0x22450148,
+	0x225ab6b0, 0x22706f88, 0x22862bc8, 0x229beb78,
+	0x22b1ae90, 0x22c77510, 0x22dd3f00, 0x22f30c50,
+	0x2308dd10, 0x231eb130, 0x233488b0, 0x234a6398,
+	0x236041e8, 0x23762398, 0x238c08a8, 0x23a1f110,
+	0x23b7dce0, 0x23cdcc08, 0x23e3be90, 0x23f9b478,
+	0x240fadb0, 0x2425aa48, 0x243baa38, 0x2451ad80,
+	0x2467b420, 0x247dbe10, 0x2493cb58, 0x24a9dbf0,
+	0x24bfefe0, 0x24d60720, 0x24ec21b0, 0x25023f90,
+	0x251860b8, 0x252e8538, 0x2544ad00, 0x255ad810,
+	0x25710670, 0x25873818, 0x259d6d08, 0x25b3a540,
+	0x25c9e0c0, 0x25e01f88, 0x25f66190, 0x260ca6e0,
+	0x2622ef70, 0x26393b40, 0x264f8a58, 0x2665dca8,
+	0x267c3238, 0x26928b10, 0x26a8e718, 0x26bf4668,
+	0x26d5a8e8, 0x26ec0ea8, 0x270277a0, 0x2718e3d8,
+	0x272f5340, 0x2745c5e0, 0x275c3bb8, 0x2772b4c0,
+	0x27893100, 0x279fb070, 0x27b63310, 0x27ccb8e8,
+	0x27e341f0, 0x27f9ce20, 0x28105d80, 0x2826f018,
+	0x283d85d0, 0x28541eb8, 0x286abad0, 0x28815a08,
+	0x2897fc70, 0x28aea200, 0x28c54ab8, 0x28dbf690,
+	0x28f2a598, 0x290957b8, 0x29200d08, 0x2936c570,
+	0x294d8100, 0x29643fb0, 0x297b0180, 0x2991c670,
+	0x29a88e80, 0x29bf59b0, 0x29d627f8, 0x29ecf958,
+	0x2a03cdd8, 0x2a1aa578, 0x2a318028, 0x2a485df8,
+	0x2a5f3ed8, 0x2a7622d8, 0x2a8d09e8, 0x2aa3f408,
+	0x2abae148, 0x2ad1d190, 0x2ae8c4f0, 0x2affbb68,
+	0x2b16b4e8, 0x2b2db180, 0x2b44b120, 0x2b5bb3d0,
+	0x2b72b990, 0x2b89c260, 0x2ba0ce38, 0x2bb7dd18,
+	0x2bceef10, 0x2be60400, 0x2bfd1c08, 0x2c143710,
+	0x2c2b5520, 0x2c427638, 0x2c599a50, 0x2c70c178,
+	0x2c87eba0, 0x2c9f18c8, 0x2cb648f8, 0x2ccd7c20,
+	0x2ce4b250, 0x2cfbeb80, 0x2d1327b0, 0x2d2a66e0,
+	0x2d41a908, 0x2d58ee38, 0x2d703658, 0x2d878180,
+	0x2d9ecf98, 0x2db620b0, 0x2dcd74c0, 0x2de4cbc8,
+	0x2dfc25c8, 0x2e1382c0, 0x2e2ae2b0, 0x2e424598,
+	0x2e59ab70, 0x2e711440, 0x2e888000, 0x2e9feeb0,
+	0x2eb76058, 0x2eced4f0, 0x2ee64c78, 0x2efdc6f0,
+	0x2f154458, 0x2f2cc4a8, 0x2f4447f0, 0x2f5bce20,
+	0x2f735738, 0x2f8ae348, 0x2fa27238, 0x2fba0410,
+	0x2fd198d8, 0x2fe93088, 0x3000cb20, 0x301868a0,
+	0x30300908, 0x3047ac50, 0x305f5288, 0x3076fba0,
+	0x308ea798, 0x30a65670, 0x30be0838, 0x30d5bcd8,
+	0x30ed7458, 0x31052ec0, 0x311cec00, 0x3134ac28,
+	0x314c6f28, 0x31643508, 0x317bfdc8, 0x3193c960,
+	0x31ab97d0, 0x31c36928, 0x31db3d50, 0x31f31458,
+	0x320aee38, 0x3222caf0, 0x323aaa80, 0x32528ce8,
+	0x326a7228, 0x32825a40, 0x329a4528, 0x32b232e8,
+	0x32ca2380, 0x32e21630, 0x32fa0c68, 0x33120570,
+	0x332a0140, 0x3341ffe8, 0x335a0160, 0x337205a0,
+	0x338a0cb0, 0x33a21688, 0x33ba2330, 0x33d232a0,
+	0x33ea44d8, 0x340259e0, 0x341a71b0, 0x34328c48,
+	0x344aa9a8, 0x3462c9d0, 0x347aecc0, 0x34931278,
+	0x34ab3af0, 0x34c36630, 0x34db9438, 0x34f3c4f8,
+	0x350bf888, 0x35242ed0, 0x353c67e8, 0x3554a3b8,
+	0x356ce248, 0x35852398, 0x359d67a8, 0x35b5ae78,
+	0x35cdf808, 0x35e64450, 0x35fe9360, 0x3616e520,
+	0x362f39a0, 0x364790e0, 0x365fead8, 0x36784788,
+	0x3690a6f0, 0x36a90918, 0x36c16df0, 0x36d9d588,
+	0x36f23fd0, 0x370aacd0, 0x37231c88, 0x373b8ef8,
+	0x37540418, 0x376c7bf0, 0x3784f678, 0x379d73b0,
+	0x37b5f3a0, 0x37ce7640, 0x37e6fb98, 0x37ff8398,
+	0x38180e48, 0x38309bb0, 0x38492bc0, 0x3861be80,
+	0x387a53e8, 0x3892ec08, 0x38ab86d0, 0x38c42440,
+	0x38dcc460, 0x38f56728, 0x390e0c98, 0x3926b4b8,
+	0x393f5f80, 0x39580cf0, 0x3970bd08, 0x39896fc8,
+	0x39a22530, 0x39badd38, 0x39d397e8, 0x39ec5540,
+	0x3a051540, 0x3a1dd7e0, 0x3a369d20, 0x3a4f6508,
+	0x3a682f90, 0x3a80fcc0, 0x3a99cc88, 0x3ab29ef8,
+	0x3acb7400, 0x3ae44bb0, 0x3afd25f8, 0x3b1602e8,
+	0x3b2ee270, 0x3b47c498, 0x3b60a958, 0x3b7990b8,
+	0x3b927ab0, 0x3bab6748, 0x3bc45678, 0x3bdd4840,
+	0x3bf63ca8, 0x3c0f33a8, 0x3c282d38, 0x3c412968,
+	0x3c5a2830, 0x3c732988, 0x3c8c2d80, 0x3ca53408,
+	0x3cbe3d28, 0x3cd748d8, 0x3cf05720, 0x3d0967f8,
+	0x3d227b68, 0x3d3b9170, 0x3d54aa00, 0x3d6dc520,
+	0x3d86e2d8, 0x3da00320, 0x3db925f8, 0x3dd24b60,
+	0x3deb7350, 0x3e049dd8, 0x3e1dcae8, 0x3e36fa80,
+	0x3e502cb0, 0x3e696168, 0x3e8298a8, 0x3e9bd278,
+	0x3eb50ed0, 0x3ece4db8, 0x3ee78f20, 0x3f00d320,
+	0x3f1a19a0, 0x3f3362a0, 0x3f4cae38, 0x3f65fc50,
+	0x3f7f4ce8, 0x3f98a010, 0x3fb1f5b8, 0x3fcb4de8,
+	0x3fe4a898, 0x3ffe05d0, 0x40176590, 0x4030c7c8,
+	0x404a2c88, 0x406393d0, 0x407cfd98, 0x409669d8,
+	0x40afd8a0, 0x40c949e8, 0x40e2bdb0, 0x40fc33f8,
+	0x4115acc0, 0x412f2800, 0x4148a5c0, 0x41622600,
+	0x417ba8b8, 0x41952df0, 0x41aeb5a0, 0x41c83fd0,
+	0x41e1cc78, 0x41fb5b98, 0x4214ed38, 0x422e8150,
+	0x424817e0, 0x4261b0e8, 0x427b4c68, 0x4294ea60,
+	0x42ae8ac8, 0x42c82db0, 0x42e1d308, 0x42fb7ad8,
+	0x43152520, 0x432ed1d8, 0x43488100, 0x436232a8,
+	0x437be6b8, 0x43959d40, 0x43af5638, 0x43c911a8,
+	0x43e2cf80, 0x43fc8fd0, 0x44165290, 0x443017b8,
+	0x4449df58, 0x4463a960, 0x447d75d8, 0x449744c0,
+	0x44b11618, 0x44cae9d8, 0x44e4c008, 0x44fe98a8,
+	0x451873b0, 0x45325120, 0x454c3100, 0x45661348,
+	0x457ff7f8, 0x4599df10, 0x45b3c898, 0x45cdb488,
+	0x45e7a2d8, 0x46019398, 0x461b86c0, 0x46357c48,
+	0x464f7438, 0x46696e90, 0x46836b48, 0x469d6a70,
+	0x46b76bf0, 0x46d16fd8, 0x46eb7630, 0x47057ee0,
+	0x471f89f0, 0x47399768, 0x4753a740, 0x476db978,
+	0x4787ce18, 0x47a1e510, 0x47bbfe70, 0x47d61a28,
+	0x47f03848, 0x480a58c0, 0x48247b98, 0x483ea0d0,
+	0x4858c868, 0x4872f258, 0x488d1ea8, 0x48a74d50,
+	0x48c17e58, 0x48dbb1b8, 0x48f5e778, 0x49101f90,
+	0x492a5a08, 0x494496d0, 0x495ed5f8, 0x49791778,
+	0x49935b50, 0x49ada180, 0x49c7ea08, 0x49e234e8,
+	0x49fc8220, 0x4a16d1b0, 0x4a312390, 0x4a4b77c8,
+	0x4a65ce58, 0x4a802740, 0x4a9a8278, 0x4ab4e000,
+	0x4acf3fe0, 0x4ae9a218, 0x4b040698, 0x4b1e6d70,
+	0x4b38d6a0, 0x4b534220, 0x4b6dafe8, 0x4b882008,
+	0x4ba29278, 0x4bbd0738, 0x4bd77e48, 0x4bf1f7a8,
+	0x4c0c7358, 0x4c26f158, 0x4c4171a0, 0x4c5bf438,
+	0x4c767920, 0x4c910050, 0x4cab89d8, 0x4cc615a0,
+	0x4ce0a3b8, 0x4cfb3420, 0x4d15c6d0, 0x4d305bc8,
+	0x4d4af310, 0x4d658c98, 0x4d802870, 0x4d9ac698,
+	0x4db56700, 0x4dd009b0, 0x4deaaeb0, 0x4e0555f0,
+	0x4e1fff80, 0x4e3aab50, 0x4e555968, 0x4e7009c8,
+	0x4e8abc68, 0x4ea57150, 0x4ec02880, 0x4edae1f8,
+	0x4ef59db0, 0x4f105ba8, 0x4f2b1be8, 0x4f45de70,
+	0x4f60a330, 0x4f7b6a40, 0x4f963388, 0x4fb0ff18,
+	0x4fcbcce8, 0x4fe69cf8, 0x50016f48, 0x501c43d8,
+	0x50371ab0, 0x5051f3c0, 0x506ccf10, 0x5087aca0,
+};
+
+static const char pow43LargeExp[16] = { 0, 5, 6, 6, 7, 7, 7, 7, 9, 9, 9, 9, 9, 9, 9, 9 };
+#endif
+
+/* bands narrower than this go straight to DequantBlock() (table setup not worth it) */
+#define DQ_BAND_MIN		8
+
 /* sqrt(0.5) in Q31 format */
 #define SQRTHALF 0x5a82799a
 
@@ -124,12 +377,14 @@ int pow2frac[8] = {
  * Inputs:      input buffer of decode Huffman codewords (signed-magnitude)
  *              output buffer of same length (in-place (outbuf = inbuf) is allowed)
  *              number of samples
+ *              scale
+ *              output stride (1 = contiguous, 3 = interleave short-block windows)
  *              
  * Outputs:     dequantized samples in Q25 format
  *
  * Return:      bitwise-OR of the unsigned outputs (for guard bit calculations)
  **************************************************************************************/
-static int DequantBlock(int *inbuf, int *outbuf, int num, int scale)
+static int DequantBlock(int *inbuf, int *outbuf, int num, int scale, int stride)
 {
 	int tab4[4];
 	int scalef, scalei, shift;
@@ -173,6 +428,15 @@ static int DequantBlock(int *inbuf, int *outbuf, int num, int scale)
 				y = MULSHIFT32(y, scalef);
 				shift = scalei - 3;
 
+#if MP3_USE_LARGE_POW43
+			} else if (x < POW43_LARGE_MAX) {
+
+				y = pow43Large[x-64];
+
+				/* fractional scale */
+				y = MULSHIFT32(y, scalef);
+				shift = scalei - pow43LargeExp[x >> 6];
+#endif
 			} else {
 
 				/* normalize to [0x40000000, 0x7fffffff] */
@@ -214,21 +478,237 @@ static int DequantBlock(int *inbuf, int *outbuf, int num, int scale)
 
 		/* sign and store */
 		mask |= y;
-		*outbuf++ = (sx < 0) ? -y : y;
+		*outbuf = (sx < 0) ? -y : y;
+		outbuf += stride;
 
 	} while (--num);
 
 	return mask;
 }
 
+/**************************************************************************************
+ * Function:    DequantBand
+ *
+ * Description: dequantize one critical band (or one window of a short-block critical band)
+ *
+ * Inputs:      input buffer of decode Huffman codewords (signed-magnitude)
+ *              output buffer (in-place (outbuf = inbuf) is allowed)
+ *              number of samples
+ *              scale
+ *
+ * Outputs:     dequantized samples in Q25 format
+ *
+ * Return:      bitwise-OR of the unsigned outputs (for guard bit calculations)
+ *
+ * Notes:       most codewords are < 16, so we build one 16-entry table with the band
+ *                scale already applied and use it for the whole band (4 samples at a 
+ *                time with SSE4.1), no per-sample branching on the magnitude
+ *              codewords >= 16 (rare) still go through DequantBlock()
+ *              bit-exact with DequantBlock()
+ **************************************************************************************/
+static int DequantBand(int *inbuf, int *outbuf, int num, int scale)
+{
+	int i, scalei, shift, mask;
+	const int *tab16;
+#ifndef MP3_SIMD_SSE41
+	int x, y, sx, tabBand[16];
+#endif
+
+	if (num < DQ_BAND_MIN)
+		return DequantBlock(inbuf, outbuf, num, scale, 1);
+
+	/* table for this band: same integer scaling as DequantBlock() */
+	tab16 = pow43_14[scale & 0x3];
+	scalei = MIN(scale >> 2, 31);
+	shift = MIN(scalei + 3, 31);
+	shift = MAX(shift, 0);
+
+	mask = 0;
+	i = 0;
+#ifdef MP3_SIMD_SSE41
+	{
+		__m128i t0, t1, t2, t3, u0, u1, u2, u3, vm, vx, vs, vy, sel, m8, cnt, big;
+
+		/* scale the table 4 entries at a time */
+		t0 = _mm_loadu_si128((const __m128i *)(tab16 +  0));
+		t1 = _mm_loadu_si128((const __m128i *)(tab16 +  4));
+		t2 = _mm_loadu_si128((const __m128i *)(tab16 +  8));
+		t3 = _mm_loadu_si128((const __m128i *)(tab16 + 12));
+		t0 = _mm_sra_epi32(t0, _mm_cvtsi32_si128(shift));
+		if (scalei < 0) {
+			cnt = _mm_cvtsi32_si128(-scalei);
+			t1 = _mm_sll_epi32(t1, cnt);
+			t2 = _mm_sll_epi32(t2, cnt);
+			t3 = _mm_sll_epi32(t3, cnt);
+		} else {
+			cnt = _mm_cvtsi32_si128(scalei);
+			t1 = _mm_sra_epi32(t1, cnt);
+			t2 = _mm_sra_epi32(t2, cnt);
+			t3 = _mm_sra_epi32(t3, cnt);
+		}
+
+		/* transpose into byte planes (plane n = byte n of all 16 entries), so pshufb 
+		 *   can do the 16-entry lookups 
+		 */
+		sel = _mm_setr_epi8(0,4,8,12, 1,5,9,13, 2,6,10,14, 3,7,11,15);
+		t0 = _mm_shuffle_epi8(t0, sel);
+		t1 = _mm_shuffle_epi8(t1, sel);
+		t2 = _mm_shuffle_epi8(t2, sel);
+		t3 = _mm_shuffle_epi8(t3, sel);
+		u0 = _mm_unpacklo_epi32(t0, t1);
+		u1 = _mm_unpacklo_epi32(t2, t3);
+		u2 = _mm_unpackhi_epi32(t0, t1);
+		u3 = _mm_unpackhi_epi32(t2, t3);
+		t0 = _mm_unpacklo_epi64(u0, u1);
+		t1 = _mm_unpackhi_epi64(u0, u1);
+		t2 = _mm_unpacklo_epi64(u2, u3);
+		t3 = _mm_unpackhi_epi64(u2, u3);
+
+		/* replicate low byte of each lane into all 4 bytes of the lane */
+		sel = _mm_setr_epi8(0,0,0,0, 4,4,4,4, 8,8,8,8, 12,12,12,12);
+		m8 = _mm_set1_epi32(0xff);
+		big = _mm_set1_epi32(0x7ffffff0);
+		vm = _mm_setzero_si128();
+
+		for ( ; i <= num - 4; i += 4) {
+			vs = _mm_loadu_si128((const __m128i *)(inbuf + i));
+			if (!_mm_testz_si128(vs, big)) {
+				mask |= DequantBlock(inbuf + i, outbuf + i, 4, scale, 1);
+				continue;
+			}
+			vx = _mm_shuffle_epi8(vs, sel);
+			vy =                   _mm_and_si128(_mm_shuffle_epi8(t0, vx), m8);
+			vy = _mm_or_si128(vy, _mm_slli_epi32(_mm_and_si128(_mm_shuffle_epi8(t1, vx), m8),  8));
+			vy = _mm_or_si128(vy, _mm_slli_epi32(_mm_and_si128(_mm_shuffle_epi8(t2, vx), m8), 16));
+			vy = _mm_or_si128(vy, _mm_slli_epi32(_mm_shuffle_epi8(t3, vx), 24));
+			vm = _mm_or_si128(vm, vy);
+
+			/* sign: (y ^ s) - s with s = sx >> 31 */
+			vs = _mm_srai_epi32(vs, 31);
+			vy = _mm_sub_epi32(_mm_xor_si128(vy, vs), vs);
+			_mm_storeu_si128((__m128i *)(outbuf + i), vy);
+		}
+		mask |= ORREDUCE_X4(vm);
+	}
+#else
+	tabBand[0] = 0;
+	for (x = 1; x < 4; x++)
+		tabBand[x] = tab16[x] >> shift;
+	if (scalei < 0) {
+		for (x = 4; x < 16; x++)
+			tabBand[x] = tab16[x] << -scalei;
+	} else {
+		for (x = 4; x < 16; x++)
+			tabBand[x] = tab16[x] >> scalei;
+	}
+
+	for ( ; i < num; i++) {
+		sx = inbuf[i];
+		x = sx & 0x7fffffff;
+		if (x >= 16) {
+			mask |= DequantBlock(inbuf + i, outbuf + i, 1, scale, 1);
+			continue;
+		}
+		y = tabBand[x];
+		mask |= y;
+		outbuf[i] = (sx < 0) ? -y : y;
+	}
+#endif
+
+	/* SIMD tail */
+	if (i < num)
+		mask |= DequantBlock(inbuf + i, outbuf + i, num - i, scale, 1);
+
+	return mask;
+}
+
+/**************************************************************************************
+ * Function:    DequantShortBand
+ *
+ * Description: dequantize one short-block critical band and reorder it in place
+ *
+ * Inputs:      buffer with the decoded Huffman codewords of the 3 windows (window w of 
+ *                sample j at buf[w*num + j])
+ *              number of samples per window
+ *              scale of each window
+ *
+ * Outputs:     dequantized samples in Q25 format, reordered (window w of sample j at 
+ *                buf[3*j + w])
+ *              bitwise-OR of the unsigned outputs of each window in mask[]
+ *
+ * Return:      none
+ *
+ * Notes:       the reorder is a transpose of a 3 x num matrix: the sample at s goes to 
+ *                3*s mod (3*num - 1) (the last sample stays), so each cycle of this 
+ *                permutation is followed with the displaced codeword kept in a register, 
+ *                and no copy of the band is needed
+ *              bit-exact with DequantBlock()
+ **************************************************************************************/
+static void DequantShortBand(int *buf, int num, const int *scale, int *mask)
+{
+	int w, x, y, sx, next, num3, s, o, leader;
+	int scalei, shift;
+	int tabBand[3][16];
+	unsigned int done[(MAX_REORDER_SAMPS + 31) / 32];
+	const int *tab16;
+
+	/* one table per window: same integer scaling as DequantBlock() */
+	for (w = 0; w < 3; w++) {
+		tab16 = pow43_14[scale[w] & 0x3];
+		scalei = MIN(scale[w] >> 2, 31);
+		shift = MIN(scalei + 3, 31);
+		shift = MAX(shift, 0);
+		tabBand[w][0] = 0;
+		for (x = 1; x < 4; x++)
+			tabBand[w][x] = tab16[x] >> shift;
+		for (x = 4; x < 16; x++)
+			tabBand[w][x] = (scalei < 0) ? tab16[x] << -scalei : tab16[x] >> scalei;
+		mask[w] = 0;
+	}
+
+	num3 = 3 * num;
+	for (s = 0; s < (num3 + 31) / 32; s++)
+		done[s] = 0;
+
+	for (leader = 0; leader < num3; leader++) {
+		if (!(done[leader >> 5] & (1u << (leader & 31)))) {
+			s = leader;
+			sx = buf[s];
+			do {
+				/* destination of the sample at s, keep the codeword found there */
+				o = 3 * s;
+				if (s != num3 - 1) {
+					while (o >= num3 - 1)
+						o -= num3 - 1;
+				} else {
+					o = s;
+				}
+				next = buf[o];
+				done[o >> 5] |= (1u << (o & 31));
+
+				w = (s >= 2 * num) ? 2 : (s >= num ? 1 : 0);
+				x = sx & 0x7fffffff;
+				if (x < 16) {
+					y = tabBand[w][x];
+					mask[w] |= y;
+					buf[o] = (sx < 0) ? -y : y;
+				} else {
+					mask[w] |= DequantBlock(&sx, buf + o, 1, scale[w], 1);
+				}
+
+				s = o;
+				sx = next;
+			} while (s != leader);
+		}
+	}
+}
+
 /**************************************************************************************
  * Function:    DequantChannel
  *
  * Description: dequantize one granule, one channel worth of decoded Huffman codewords
  *
  * Inputs:      sample buffer (decoded Huffman codewords), length = MAX_NSAMP samples
- *              work buffer for reordering short-block, length = MAX_REORDER_SAMPS
- *                samples (3 * width of largest short-block critical band)
  *              non-zero bound for this channel/granule
  *              valid FrameHeader, SideInfoSub, ScaleFactorInfoSub, and CriticalBandInfo
  *                structures for this channel/granule
@@ -241,15 +721,14 @@ static int DequantBlock(int *inbuf, int *outbuf, int num, int scale)
  *
  * Notes:       dequantized samples in Q(DQ_FRACBITS_OUT) format 
  **************************************************************************************/
-int DequantChannel(int *sampleBuf, int *workBuf, int *nonZeroBound, FrameHeader *fh, SideInfoSub *sis, 
+int DequantChannel(int *sampleBuf, int *nonZeroBound, FrameHeader *fh, SideInfoSub *sis, 
 					ScaleFactorInfoSub *sfis, CriticalBandInfo *cbi)
 {
-	int i, j, w, cb;
+	int i, w, cb;
 	int cbEndL, cbStartS, cbEndS;
 	int nSamps, nonZero, sfactMultiplier, gbMask;
 	int globalGain, gainI;
-	int cbMax[3];
-	ARRAY3 *buf;    /* short block reorder */
+	int cbMax[3], gainS[3], maskS[3];
 	
 	/* set default start/end points for short/long blocks - will update with non-zero cb info */
 	if (sis->blockType == 2) {
@@ -293,7 +772,7 @@ int DequantChannel(int *sampleBuf, int *workBuf, int *nonZeroBound, FrameHeader
 		nSamps = fh->sfBand->l[cb + 1] - fh->sfBand->l[cb];
 		gainI = 210 - globalGain + sfactMultiplier * (sfis->l[cb] + (sis->preFlag ? (int)preTab[cb] : 0));
 
-		nonZero |= DequantBlock(sampleBuf + i, sampleBuf + i, nSamps, gainI);
+		nonZero |= DequantBand(sampleBuf + i, sampleBuf + i, nSamps, gainI);
 		i += nSamps;
 
 		/* update highest non-zero critical band */
@@ -320,28 +799,20 @@ int DequantChannel(int *sampleBuf, int *workBuf, int *nonZeroBound, FrameHeader
 	for (cb = cbStartS; cb < cbEndS; cb++) {
 
 		nSamps = fh->sfBand->s[cb + 1] - fh->sfBand->s[cb];
-		for (w = 0; w < 3; w++) {
-			nonZero =  0;
-			gainI = 210 - globalGain + 8*sis->subBlockGain[w] + sfactMultiplier*(sfis->s[cb][w]);
+		ASSERT(3*nSamps <= MAX_REORDER_SAMPS);
 
-			nonZero |= DequantBlock(sampleBuf + i + nSamps*w, workBuf + nSamps*w, nSamps, gainI);
+		/* dequantize straight into reordered positions (window w of sample j goes to buf[j][w]) */
+		for (w = 0; w < 3; w++)
+			gainS[w] = 210 - globalGain + 8*sis->subBlockGain[w] + sfactMultiplier*(sfis->s[cb][w]);
+		DequantShortBand(sampleBuf + i, nSamps, gainS, maskS);
 
+		for (w = 0; w < 3; w++) {
 			/* update highest non-zero critical band */
-			if (nonZero)
+			if (maskS[w])
 				cbMax[w] = cb;
-			gbMask |= nonZero;
+			gbMask |= maskS[w];
 		}
-
-		/* reorder blocks */
-		buf = (ARRAY3 *)(sampleBuf + i);
 		i += 3*nSamps;
-		for (j = 0; j < nSamps; j++) {
-			buf[j][0] = workBuf[0*nSamps + j];
-			buf[j][1] = workBuf[1*nSamps + j];
-			buf[j][2] = workBuf[2*nSamps + j];
-		}
-
-		ASSERT(3*nSamps <= MAX_REORDER_SAMPS);
 
 		if (i >= *nonZeroBound) 
 			break;
@@ -42,6 +42,7 @@
  *             overlap-add, frequency inversion
  **************************************************************************************/
 
+#include <string.h>
 #include "coder.h"
 #include "assembly.h"
 
@@ -702,6 +703,29 @@ static int HybridTransform(int *xCurr, int *xPrev, int y[BLOCK_SIZE][NBANDS], Si
 	return nBlocksOut;
 }
 
+/**************************************************************************************
+ * Function:    OverlapNonZero
+ *
+ * Description: check whether any overlap samples are left from the previous granule
+ *
+ * Inputs:      overlap buffer for one channel
+ *              number of blocks with (possibly) non-zero overlap (numPrevIMDCT)
+ *
+ * Outputs:     none
+ *
+ * Return:      non-zero if any of the first nBlocks * 9 overlap samples are non-zero
+ **************************************************************************************/
+static int OverlapNonZero(int *xPrev, int nBlocks)
+{
+	int i, nonZero;
+
+	nonZero = 0;
+	for (i = 0; i < nBlocks * 9; i++)
+		nonZero |= xPrev[i];
+
+	return nonZero;
+}
+
 /**************************************************************************************
  * Function:    IMDCT
  *
@@ -721,7 +745,7 @@ static int HybridTransform(int *xCurr, int *xPrev, int y[BLOCK_SIZE][NBANDS], Si
  // a bit faster in RAM
 int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch)
 {
-	int nBfly, blockCutoff;
+	int nBfly, blockCutoff, silent, sbLimit;
 	FrameHeader *fh;
 	SideInfo *si;
 	HuffmanInfo *hi;
@@ -744,14 +768,20 @@ int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch)
      *   nLongBlocks = number of blocks with (possibly) non-zero power 
 	 *   nBfly = number of butterflies to do (nLongBlocks - 1, unless no long blocks)
 	 */
+	/* reduced bandwidth - everything above the subband limit is treated as zero (no transforms,
+	 *   no butterflies across the limit)
+	 */
+	sbLimit = mp3DecInfo->sbLimit;
+	hi->nonZeroBound[ch] = MIN(hi->nonZeroBound[ch], sbLimit * 18);
+
 	blockCutoff = fh->sfBand->l[(fh->ver == MPEG1 ? 8 : 6)] / 18;	/* same as 3* num short sfb's in spec */
 	if (si->sis[gr][ch].blockType != 2) {
 		/* all long transforms */
-		bc.nBlocksLong = MIN((hi->nonZeroBound[ch] + 7) / 18 + 1, 32);	
+		bc.nBlocksLong = MIN((hi->nonZeroBound[ch] + 7) / 18 + 1, sbLimit);	
 		nBfly = bc.nBlocksLong - 1;
 	} else if (si->sis[gr][ch].blockType == 2 && si->sis[gr][ch].mixedBlock) {
 		/* mixed block - long transforms until cutoff, then short transforms */
-		bc.nBlocksLong = blockCutoff;	
+		bc.nBlocksLong = MIN(blockCutoff, sbLimit);	
 		nBfly = bc.nBlocksLong - 1;
 	} else {
 		/* all short transforms */
@@ -759,7 +789,13 @@ int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch)
 		nBfly = 0;
 	}
  
-	AntiAlias(hi->huffDecBuf[ch], nBfly);
+	/* silent granule: no non-zero input lines and nothing left to overlap-add from the previous 
+	 *   granule, so every output sample is zero (overBuf blocks >= numPrevIMDCT are always zero)
+	 */
+	silent = (hi->nonZeroBound[ch] == 0 && !OverlapNonZero(mi->overBuf[ch], mi->numPrevIMDCT[ch]));
+
+	if (!silent)
+		AntiAlias(hi->huffDecBuf[ch], nBfly);
 	hi->nonZeroBound[ch] = MAX(hi->nonZeroBound[ch], (nBfly * 18) + 8);
 
 	ASSERT(hi->nonZeroBound[ch] <= MAX_NSAMP);
@@ -772,7 +808,14 @@ int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch)
 	bc.currWinSwitch = (si->sis[gr][ch].mixedBlock ? blockCutoff : 0);	/* where WINDOW switches (not nec. transform) */
 	bc.gbIn = hi->gb[ch];
 
-	mi->numPrevIMDCT[ch] = HybridTransform(hi->huffDecBuf[ch], mi->overBuf[ch], mi->outBuf[ch], &si->sis[gr][ch], &bc);
+	if (silent) {
+		/* same state HybridTransform() would leave behind for all-zero input, without the transforms */
+		memset(IMDCT_OUT(mi, hi, ch), 0, BLOCK_SIZE * NBANDS * sizeof(int));
+		mi->numPrevIMDCT[ch] = MAX(bc.nBlocksLong, bc.nBlocksTotal);
+		bc.gbOut = CLZ(0) - 1;
+	} else {
+		mi->numPrevIMDCT[ch] = HybridTransform(hi->huffDecBuf[ch], mi->overBuf[ch], IMDCT_OUT(mi, hi, ch), &si->sis[gr][ch], &bc);
+	}
 	mi->prevType[ch] = si->sis[gr][ch].blockType;
 	mi->prevWinSwitch[ch] = bc.currWinSwitch;		/* 0 means not a mixed block (either all short or all long) */
 	mi->gb[ch] = bc.gbOut;
@@ -782,3 +825,67 @@ int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch)
 	/* output has gained 2 int bits */
 	return 0;
 }
+
+/**************************************************************************************
+ * Function:    DownmixOverlap
+ *
+ * Description: check whether both channels can share one IMDCT for mono downmix, and
+ *                if so fold the overlap of channel 1 into channel 0
+ *
+ * Inputs:      MP3DecInfo structure filled by UnpackSideInfo() (for this granule)
+ *                and IMDCT() (for the previous granule)
+ *              index of current granule
+ *
+ * Outputs:     overlap of both channels in overBuf[0], with numPrevIMDCT[1] = 0
+ *                (only if return value is 1)
+ *
+ * Return:      1 if the downmixed spectrum can go through a single IMDCT in channel 0
+ *              0 if each channel needs its own IMDCT, -1 if null input pointers
+ *
+ * Notes:       the IMDCT is linear, so sum of transforms = transform of sum, as long as 
+ *                both channels use the same windows - i.e. same block type and mixed 
+ *                block flag now, and same window for the overlap from last time
+ *              in downmix mode the overlap buffers hold (L + R) / 2 when merged, or
+ *                L / 2 and R / 2 when not (Dequantize() halves the spectra in that case)
+ **************************************************************************************/
+int DownmixOverlap(MP3DecInfo *mp3DecInfo, int gr)
+{
+	int i, nPrev;
+	SideInfo *si;
+	IMDCTInfo *mi;
+
+	/* validate pointers */
+	if (!mp3DecInfo || !mp3DecInfo->SideInfoPS || !mp3DecInfo->IMDCTInfoPS)
+		return -1;
+
+	si = (SideInfo *)(mp3DecInfo->SideInfoPS);
+	mi = (IMDCTInfo *)(mp3DecInfo->IMDCTInfoPS);
+
+	if (si->sis[gr][0].blockType != si->sis[gr][1].blockType || si->sis[gr][0].mixedBlock != si->sis[gr][1].mixedBlock)
+		return 0;
+
+	if (mi->numPrevIMDCT[1] == 0) {
+		/* already merged (or nothing left to overlap in channel 1) */
+		return 1;
+	} else if (mi->numPrevIMDCT[0] == 0) {
+		/* nothing left in channel 0 - just take over channel 1 */
+		memcpy(mi->overBuf[0], mi->overBuf[1], 9 * mi->numPrevIMDCT[1] * sizeof(int));
+		mi->numPrevIMDCT[0] = mi->numPrevIMDCT[1];
+		mi->prevType[0] = mi->prevType[1];
+		mi->prevWinSwitch[0] = mi->prevWinSwitch[1];
+	} else if (mi->prevType[0] == mi->prevType[1] && mi->prevWinSwitch[0] == mi->prevWinSwitch[1]) {
+		/* xPrev has at least 2 guard bits, so the sum can't overflow */
+		nPrev = mi->numPrevIMDCT[1];
+		for (i = 0; i < 9 * nPrev; i++)
+			mi->overBuf[0][i] += mi->overBuf[1][i];
+		mi->numPrevIMDCT[0] = MAX(mi->numPrevIMDCT[0], nPrev);
+	} else {
+		/* overlaps need different windows - merge once they have been through separate IMDCT's */
+		return 0;
+	}
+
+	memset(mi->overBuf[1], 0, 9 * mi->numPrevIMDCT[1] * sizeof(int));
+	mi->numPrevIMDCT[1] = 0;
+
+	return 1;
+}
@@ -44,10 +44,18 @@
 #ifndef _MP3COMMON_H
 #define _MP3COMMON_H
 
+#include "ConfigHelix.h"
 #include "mp3dec.h"
 #include "statname.h"	/* do name-mangling for static linking */
 
+#if MP3_MAINBUF_SIZE < MAINBUF_SIZE
+#error MP3_MAINBUF_SIZE must be at least MAINBUF_SIZE
+#endif
+
 #define MAX_SCFBD		4		/* max scalefactor bands per channel */
+#define NCHANS_OUT(m)	((m)->downmix ? 1 : (m)->nChans)	/* output channels (1 with mono downmix) */
+#define SAMPLE_BYTES(m)	((m)->outFormat == MP3_OUTPUT_INT16 ? 2 : 4)		/* bytes per output sample */
+
 #define NGRANS_MPEG1	2
 #define NGRANS_MPEG2	1
 
@@ -71,8 +79,10 @@ typedef struct _MP3DecInfo {
 	void *IMDCTInfoPS;
 	void *SubbandInfoPS;
 
-	/* buffer which must be large enough to hold largest possible main_data section */
-	unsigned char mainBuf[MAINBUF_SIZE];
+	/* buffer which must be large enough to hold largest possible main_data section 
+	 *   (any extra space lets the bit reservoir move forward without memmove, see MP3Decode)
+	 */
+	unsigned char mainBuf[MP3_MAINBUF_SIZE];
 
 	/* special info for "free" bitrate files */
 	int freeBitrateFlag;
@@ -91,8 +101,24 @@ typedef struct _MP3DecInfo {
 	int mainDataBegin;
 	int mainDataBytes;
 
+	/* reduced bandwidth decoding (see MP3SetReducedBandwidth) */
+	int sbLimit;			/* number of subbands synthesized (NBANDS = full bandwidth) */
+	int decimShift;			/* output sample rate = samprate >> decimShift */
+
+	/* mono downmix of stereo streams (see MP3SetMonoDownmix) */
+	int downmix;
+	int monoSpec;			/* current granule: both channels folded into one spectrum before the IMDCT */
+
+	MP3OutputFormat outFormat;	/* see MP3SetOutputFormat */
+
+	/* low latency output, one call per granule (see MP3SetGranuleCallback) */
+	MP3GranuleCallback granuleCallback;
+	void *granuleRef;
+
 	int part23Length[MAX_NGRAN][MAX_NCHAN];
 
+	int preAllocated;		/* laid out in caller memory by MP3InitDecoderPre, nothing to free */
+
 } MP3DecInfo;
 
 typedef struct _SFBandTable {
@@ -102,15 +128,18 @@ typedef struct _SFBandTable {
 
 /* decoder functions which must be implemented for each platform */
 MP3DecInfo *AllocateBuffers(void);
+MP3DecInfo *AllocateBuffersPre(void **ptr, int *sz);
 void FreeBuffers(MP3DecInfo *mp3DecInfo);
+void ResetBuffers(MP3DecInfo *mp3DecInfo);
 int CheckPadBit(MP3DecInfo *mp3DecInfo);
 int UnpackFrameHeader(MP3DecInfo *mp3DecInfo, unsigned char *buf);
 int UnpackSideInfo(MP3DecInfo *mp3DecInfo, unsigned char *buf);
 int DecodeHuffman(MP3DecInfo *mp3DecInfo, unsigned char *buf, int *bitOffset, int huffBlockBits, int gr, int ch);
 int Dequantize(MP3DecInfo *mp3DecInfo, int gr);
 int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch);
+int DownmixOverlap(MP3DecInfo *mp3DecInfo, int gr);
 int UnpackScaleFactors(MP3DecInfo *mp3DecInfo, unsigned char *buf, int *bitOffset, int bitsAvail, int gr, int ch);
-int Subband(MP3DecInfo *mp3DecInfo, short *pcmBuf);
+int Subband(MP3DecInfo *mp3DecInfo, void *pcmBuf);
 
 /* mp3tabs.c - global ROM tables */
 extern const int samplerateTab[3][3];
@@ -72,6 +72,36 @@ HMP3Decoder MP3InitDecoder(void)
 	return (HMP3Decoder)mp3DecInfo;
 }
 
+/**************************************************************************************
+ * Function:    MP3InitDecoderPre
+ *
+ * Description: lay out the decoder in a caller-provided block of memory
+ *              clear all the user-accessible fields
+ *
+ * Inputs:      pointer to block (any alignment)
+ *              size of block in bytes
+ *
+ * Outputs:     none
+ *
+ * Return:      handle to mp3 decoder instance, 0 if the block is too small
+ *
+ * Notes:       MP3_DECODER_PRE_SIZE (mp3dec.h) is a compile-time size which is
+ *                always large enough
+ *              no heap memory is used - MP3FreeDecoder() is optional and does not
+ *                free the block, which can be reused for another decoder afterwards
+ **************************************************************************************/
+HMP3Decoder MP3InitDecoderPre(void *ptr, int sz)
+{
+	MP3DecInfo *mp3DecInfo;
+
+	if (!ptr)
+		return 0;
+
+	mp3DecInfo = AllocateBuffersPre(&ptr, &sz);
+
+	return (HMP3Decoder)mp3DecInfo;
+}
+
 /**************************************************************************************
  * Function:    MP3FreeDecoder
  *
@@ -94,6 +124,33 @@ void MP3FreeDecoder(HMP3Decoder hMP3Decoder)
 	FreeBuffers(mp3DecInfo);
 }
 
+/**************************************************************************************
+ * Function:    MP3ResetDecoder
+ *
+ * Description: prepare the decoder for a new stream or for decoding after a seek
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *
+ * Outputs:     decoder state equivalent to a newly created instance
+ *
+ * Return:      0 if successful, error code (< 0) if error
+ *
+ * Notes:       much cheaper than MP3FreeDecoder() + MP3InitDecoder(): no memory is
+ *                released or allocated and only the inter-frame state is cleared
+ *              settings (MP3SetReducedBandwidth() etc.) stay in effect
+ **************************************************************************************/
+int MP3ResetDecoder(HMP3Decoder hMP3Decoder)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	ResetBuffers(mp3DecInfo);
+
+	return ERR_MP3_NONE;
+}
+
 /**************************************************************************************
  * Function:    MP3FindSyncWord
  *
@@ -120,6 +177,162 @@ int MP3FindSyncWord(unsigned char *buf, int nBytes)
 	return -1;
 }
 
+/**************************************************************************************
+ * Function:    MP3SetReducedBandwidth
+ *
+ * Description: limit the decoded audio bandwidth to the lowest subbands, optionally
+ *                with output at a reduced sample rate
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              number of subbands to synthesize, 1 to 32 (32 = full bandwidth)
+ *                each subband covers samprate / 64 Hz
+ *              output downsample factor, 1, 2, or 4
+ *
+ * Outputs:     none
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       the IMDCT and the synthesis filterbank only compute the subbands below 
+ *                the limit, everything above is treated as zero
+ *              with downsample > 1 the polyphase filter only computes every 2nd (4th) 
+ *                output sample, so nSubbands is limited to 32 / downsample
+ *              samprate and outputSamps from MP3GetLastFrameInfo() describe the 
+ *                downsampled output
+ *              call after MP3InitDecoder(), before decoding the stream - switching 
+ *                mid-stream is allowed but lets one granule of the old bandwidth through
+ **************************************************************************************/
+int MP3SetReducedBandwidth(HMP3Decoder hMP3Decoder, int nSubbands, int downsample)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+	int decimShift;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	if (downsample == 1)
+		decimShift = 0;
+	else if (downsample == 2)
+		decimShift = 1;
+	else if (downsample == 4)
+		decimShift = 2;
+	else
+		return ERR_MP3_INVALID_PARAMETER;
+
+	/* 32 subbands in the synthesis filterbank (NBANDS) */
+	if (nSubbands < 1 || nSubbands > 32)
+		return ERR_MP3_INVALID_PARAMETER;
+	if (nSubbands > (32 >> decimShift))
+		nSubbands = 32 >> decimShift;
+
+	mp3DecInfo->sbLimit = nSubbands;
+	mp3DecInfo->decimShift = decimShift;
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3SetMonoDownmix
+ *
+ * Description: decode stereo streams to mono
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              1 to output (L + R) / 2, 0 to output all channels (default)
+ *
+ * Outputs:     none
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       the channels are combined before synthesis, so only one FDCT32 and 
+ *                polyphase filter run per block - if both channels use the same block 
+ *                type the spectra are combined before the IMDCT as well (for mid-side 
+ *                frames that is just the mid channel)
+ *              nChans and outputSamps from MP3GetLastFrameInfo() describe the mono output
+ *              call after MP3InitDecoder(), before decoding the stream
+ *              always enabled in a mono-only build (MP3_MONO_ONLY in ConfigHelix.h),
+ *                where disabling returns ERR_MP3_INVALID_PARAMETER
+ **************************************************************************************/
+int MP3SetMonoDownmix(HMP3Decoder hMP3Decoder, int enable)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+	if (!enable && MAX_NCHAN_OUT < MAX_NCHAN)
+		return ERR_MP3_INVALID_PARAMETER;
+
+	mp3DecInfo->downmix = (enable ? 1 : 0);
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3SetGranuleCallback
+ *
+ * Description: register a function which receives each granule of PCM output as soon
+ *                as it is synthesized, instead of waiting for MP3Decode() to return
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              callback function, 0 to disable
+ *              user pointer, passed back to the callback unchanged
+ *
+ * Outputs:     none
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       the callback gets a pointer into the outbuf passed to MP3Decode() and the
+ *                number of samples in the granule (nGranSamps * nChans, see 
+ *                MP3GetLastFrameInfo() for the frame header of the current frame)
+ *              MP3Decode() still fills outbuf with the whole frame, so outputSamps 
+ *                from MP3GetLastFrameInfo() is the sum over the granules of a frame
+ *              if a later granule of the same frame is corrupt, MP3Decode() returns 
+ *                an error after the earlier granules have already been delivered
+ **************************************************************************************/
+int MP3SetGranuleCallback(HMP3Decoder hMP3Decoder, MP3GranuleCallback granuleCallback, void *ref)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	mp3DecInfo->granuleCallback = granuleCallback;
+	mp3DecInfo->granuleRef = ref;
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3SetOutputFormat
+ *
+ * Description: select the sample format written by the synthesis filterbank
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              MP3_OUTPUT_INT16 (default), MP3_OUTPUT_INT32 or MP3_OUTPUT_FLOAT32
+ *
+ * Outputs:     none
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       for the 32-bit formats pass a buffer of int or float (cast to short *) 
+ *                to MP3Decode(), bitsPerSample from MP3GetLastFrameInfo() is 32
+ *              MP3_OUTPUT_INT32 is Q(MP3_PCM32_FRACBITS), i.e. the 16-bit output with 
+ *                12 more fraction bits, saturated at the 32-bit limit instead of 16-bit
+ *              MP3_OUTPUT_FLOAT32 is the same value scaled to 1.0 = full scale
+ **************************************************************************************/
+int MP3SetOutputFormat(HMP3Decoder hMP3Decoder, MP3OutputFormat format)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	if (format != MP3_OUTPUT_INT16 && format != MP3_OUTPUT_INT32 && format != MP3_OUTPUT_FLOAT32)
+		return ERR_MP3_INVALID_PARAMETER;
+
+	mp3DecInfo->outFormat = format;
+
+	return ERR_MP3_NONE;
+}
+
 /**************************************************************************************
  * Function:    MP3FindFreeSync
  *
@@ -201,10 +414,10 @@ void MP3GetLastFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo)
 		mp3FrameInfo->version = 0;
 	} else {
 		mp3FrameInfo->bitrate = mp3DecInfo->bitrate;
-		mp3FrameInfo->nChans = mp3DecInfo->nChans;
-		mp3FrameInfo->samprate = mp3DecInfo->samprate;
-		mp3FrameInfo->bitsPerSample = 16;
-		mp3FrameInfo->outputSamps = mp3DecInfo->nChans * (int)samplesPerFrameTab[mp3DecInfo->version][mp3DecInfo->layer - 1];
+		mp3FrameInfo->nChans = NCHANS_OUT(mp3DecInfo);
+		mp3FrameInfo->samprate = mp3DecInfo->samprate >> mp3DecInfo->decimShift;
+		mp3FrameInfo->bitsPerSample = 8 * SAMPLE_BYTES(mp3DecInfo);
+		mp3FrameInfo->outputSamps = (NCHANS_OUT(mp3DecInfo) * (int)samplesPerFrameTab[mp3DecInfo->version][mp3DecInfo->layer - 1]) >> mp3DecInfo->decimShift;
 		mp3FrameInfo->layer = mp3DecInfo->layer;
 		mp3FrameInfo->version = mp3DecInfo->version;
 	}
@@ -239,6 +452,46 @@ int MP3GetNextFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo, uns
 	return ERR_MP3_NONE;
 }
 
+/**************************************************************************************
+ * Function:    MP3GetNextFrameSize
+ *
+ * Description: get the total size of an MP3 frame from its header, without decoding it
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              pointer to buffer containing valid MP3 frame header (located using 
+ *                MP3FindSyncWord(), above)
+ *
+ * Outputs:     none
+ *
+ * Return:      number of bytes from the start of this frame header to the start of the
+ *                next one (header, CRC, side info, main data slots and padding),
+ *                or error code (< 0), defined in mp3dec.h
+ *
+ * Notes:       lets the caller walk a stream frame by frame (e.g. to build a seek 
+ *                table or split a file) by jumping to buf + size instead of searching
+ *              ERR_MP3_FREE_BITRATE_SYNC is returned for free bitrate streams, where 
+ *                the size is only known after finding the next sync word
+ *              overwrites the frame info like MP3GetNextFrameInfo() does
+ **************************************************************************************/
+int MP3GetNextFrameSize(HMP3Decoder hMP3Decoder, unsigned char *buf)
+{
+	int hdrBytes;
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	hdrBytes = UnpackFrameHeader(mp3DecInfo, buf);
+	if (hdrBytes == -1 || mp3DecInfo->layer != 3)
+		return ERR_MP3_INVALID_FRAMEHEADER;
+
+	/* bitrate index 0 = free mode, nSlots was not updated */
+	if ((buf[2] >> 4) == 0)
+		return ERR_MP3_FREE_BITRATE_SYNC;
+
+	return hdrBytes + sideBytesTab[mp3DecInfo->version][(mp3DecInfo->nChans == 1 ? 0 : 1)] + mp3DecInfo->nSlots;
+}
+
 /**************************************************************************************
  * Function:    MP3ClearBadFrame
  *
@@ -258,7 +511,8 @@ static void MP3ClearBadFrame(MP3DecInfo *mp3DecInfo, short *outbuf)
 	if (!mp3DecInfo)
 		return;
 
-	for (i = 0; i < mp3DecInfo->nGrans * mp3DecInfo->nGranSamps * mp3DecInfo->nChans; i++)
+	/* 32-bit formats: 2 shorts per sample (all-zero bits is 0.0f as well) */
+	for (i = 0; i < ((mp3DecInfo->nGrans * mp3DecInfo->nGranSamps * NCHANS_OUT(mp3DecInfo)) >> mp3DecInfo->decimShift) * (SAMPLE_BYTES(mp3DecInfo) / 2); i++)
 		outbuf[i] = 0;
 }
 
@@ -276,6 +530,11 @@ static void MP3ClearBadFrame(MP3DecInfo *mp3DecInfo, short *outbuf)
  *
  * Outputs:     PCM data in outbuf, interleaved LRLRLR... if stereo
  *                number of output samples = nGrans * nGranSamps * nChans
+ *                  (divided by the downsample factor set with MP3SetReducedBandwidth,
+ *                  nChans = 1 with MP3SetMonoDownmix)
+ *                (int or float samples if selected with MP3SetOutputFormat, outbuf must
+ *                then hold twice as many bytes)
+ *              each granule is also passed to the granule callback, if one is set
  *              updated inbuf pointer, updated bytesLeft
  *
  * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
@@ -286,8 +545,9 @@ static void MP3ClearBadFrame(MP3DecInfo *mp3DecInfo, short *outbuf)
 int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize)
 {
 	int offset, bitOffset, mainBits, gr, ch, fhBytes, siBytes, freeFrameBytes;
-	int prevBitOffset, sfBlockBits, huffBlockBits;
+	int prevBitOffset, sfBlockBits, huffBlockBits, granSamps;
 	unsigned char *mainPtr;
+	short *granBuf;
 	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
 	
 	#ifdef PROFILE
@@ -368,16 +628,26 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
 #ifdef PROFILE
 	time = systime_get();
 #endif
-		/* fill main data buffer with enough new data for this frame */
+		/* fill main data buffer with enough new data for this frame 
+		 *  - mainBuf[0, mainDataBytes) always holds the most recent main data, so the bit 
+		 *      reservoir is simply the last mainDataBegin bytes of it
+		 *  - new data is appended, and the reservoir is only moved back to the front 
+		 *      of mainBuf when the new data does not fit anymore (once every few frames
+		 *      with MP3_MAINBUF_SIZE > MAINBUF_SIZE), so the bitstream readers never 
+		 *      have to deal with wrap-around
+		 */
 		if (mp3DecInfo->mainDataBytes >= mp3DecInfo->mainDataBegin) {
 			/* adequate "old" main data available (i.e. bit reservoir) */
-			memmove(mp3DecInfo->mainBuf, mp3DecInfo->mainBuf + mp3DecInfo->mainDataBytes - mp3DecInfo->mainDataBegin, mp3DecInfo->mainDataBegin);
-			memcpy(mp3DecInfo->mainBuf + mp3DecInfo->mainDataBegin, *inbuf, mp3DecInfo->nSlots);
+			if (mp3DecInfo->mainDataBytes + mp3DecInfo->nSlots > MP3_MAINBUF_SIZE) {
+				memmove(mp3DecInfo->mainBuf, mp3DecInfo->mainBuf + mp3DecInfo->mainDataBytes - mp3DecInfo->mainDataBegin, mp3DecInfo->mainDataBegin);
+				mp3DecInfo->mainDataBytes = mp3DecInfo->mainDataBegin;
+			}
+			memcpy(mp3DecInfo->mainBuf + mp3DecInfo->mainDataBytes, *inbuf, mp3DecInfo->nSlots);
 
-			mp3DecInfo->mainDataBytes = mp3DecInfo->mainDataBegin + mp3DecInfo->nSlots;
+			mainPtr = mp3DecInfo->mainBuf + mp3DecInfo->mainDataBytes - mp3DecInfo->mainDataBegin;
+			mp3DecInfo->mainDataBytes += mp3DecInfo->nSlots;
 			*inbuf += mp3DecInfo->nSlots;
 			*bytesLeft -= (mp3DecInfo->nSlots);
-			mainPtr = mp3DecInfo->mainBuf;
 		} else {
 			/* not enough data in bit reservoir from previous frames (perhaps starting in middle of file) */
 			memcpy(mp3DecInfo->mainBuf + mp3DecInfo->mainDataBytes, *inbuf, mp3DecInfo->nSlots);
@@ -394,7 +664,7 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
 
 	}
 	bitOffset = 0;
-	mainBits = mp3DecInfo->mainDataBytes * 8;
+	mainBits = (mp3DecInfo->mainDataBegin + mp3DecInfo->nSlots) * 8;
 
 	/* decode one complete frame */
 	for (gr = 0; gr < mp3DecInfo->nGrans; gr++) {
@@ -440,6 +710,16 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
 			mainBits -= (8*offset - prevBitOffset + bitOffset);
 		}
 		
+		/* mono downmix - one IMDCT for both channels if they use the same windows */
+		mp3DecInfo->monoSpec = 0;
+		if (mp3DecInfo->downmix && mp3DecInfo->nChans == 2) {
+			mp3DecInfo->monoSpec = DownmixOverlap(mp3DecInfo, gr);
+			if (mp3DecInfo->monoSpec < 0) {
+				MP3ClearBadFrame(mp3DecInfo, outbuf);
+				return ERR_MP3_INVALID_IMDCT;
+			}
+		}
+
 		#ifdef PROFILE
 			time = systime_get();
 		#endif
@@ -454,7 +734,7 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
 		#endif
 
 		/* alias reduction, inverse MDCT, overlap-add, frequency inversion */
-		for (ch = 0; ch < mp3DecInfo->nChans; ch++)
+		for (ch = 0; ch < (mp3DecInfo->monoSpec ? 1 : mp3DecInfo->nChans); ch++)
 		{
 		#ifdef PROFILE
 			time = systime_get();
@@ -472,8 +752,10 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
 		#ifdef PROFILE
 			time = systime_get();
 		#endif
-		/* subband transform - if stereo, interleaves pcm LRLRLR */
-		if (Subband(mp3DecInfo, outbuf + gr*mp3DecInfo->nGranSamps*mp3DecInfo->nChans) < 0) {
+		/* subband transform - if stereo, interleaves pcm LRLRLR (mono downmix: sums channels first) */
+		granSamps = (mp3DecInfo->nGranSamps * NCHANS_OUT(mp3DecInfo)) >> mp3DecInfo->decimShift;
+		granBuf = outbuf + gr * granSamps * (SAMPLE_BYTES(mp3DecInfo) / 2);
+		if (Subband(mp3DecInfo, granBuf) < 0) {
 			MP3ClearBadFrame(mp3DecInfo, outbuf);
 			return ERR_MP3_INVALID_SUBBAND;			
 		}
@@ -481,6 +763,9 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
 			time = systime_get() - time;
 			printf("Subband: %i ms\n", time);
 		#endif
+
+		if (mp3DecInfo->granuleCallback)
+			mp3DecInfo->granuleCallback(granBuf, granSamps, mp3DecInfo->granuleRef);
 		
 	}
 	return ERR_MP3_NONE;
@@ -44,6 +44,26 @@
 #ifndef _MP3DEC_H
 #define _MP3DEC_H
 
+/* MP3_MAINBUF_SIZE, MP3_PRE_ALIGN and MP3_MONO_ONLY come from ConfigHelix.h (one level up).
+ *   C users who only put libhelix-mp3 on the include path get the defaults below, which
+ *   must match the settings the library was built with (MP3InitDecoderPre() rejects a
+ *   block which is too small for the real decoder structures)
+ */
+#if defined(__has_include)
+#if __has_include("ConfigHelix.h")
+#include "ConfigHelix.h"
+#endif
+#endif
+#ifndef MP3_MAINBUF_SIZE
+#define MP3_MAINBUF_SIZE	1940
+#endif
+#ifndef MP3_PRE_ALIGN
+#define MP3_PRE_ALIGN		64
+#endif
+#ifndef MP3_MONO_ONLY
+#define MP3_MONO_ONLY		0
+#endif
+
 #if defined(_WIN32) && !defined(_WIN32_WCE)
 #
 #elif defined(_WIN32) && defined(_WIN32_WCE) && defined(ARM)
@@ -77,6 +97,11 @@ extern "C" {
 
 #define MAX_NGRAN		2		/* max granules */
 #define MAX_NCHAN		2		/* max channels */
+#if MP3_MONO_ONLY
+#define MAX_NCHAN_OUT	1		/* max output channels - stereo is downmixed (see ConfigHelix.h) */
+#else
+#define MAX_NCHAN_OUT	MAX_NCHAN
+#endif
 #define MAX_NSAMP		576		/* max samples per channel, per granule */
 
 /* map to 0,1,2 to make table indexing easier */
@@ -88,6 +113,33 @@ typedef enum {
 
 typedef void *HMP3Decoder;
 
+/* memory needed by MP3InitDecoderPre(): upper bound on the struct sizes, including
+ *   padding for an unaligned block (checked against the real struct sizes in buffers.c)
+ */
+#define MP3_PRE_ROUND(n)		(((n) + MP3_PRE_ALIGN - 1) & ~(MP3_PRE_ALIGN - 1))
+#define MP3_DECODER_PRE_SIZE	(MP3_PRE_ALIGN - 1 + \
+	MP3_PRE_ROUND(MP3_MAINBUF_SIZE + 512) +	/* MP3DecInfo */ \
+	MP3_PRE_ROUND(4 * MAX_NCHAN * MAX_NSAMP + 64) +	/* HuffmanInfo */ \
+	MP3_PRE_ROUND(4 * (MAX_NCHAN_OUT * MAX_NSAMP + MAX_NCHAN * MAX_NSAMP / 2) + 64) +	/* IMDCTInfo */ \
+	MP3_PRE_ROUND(4 * MAX_NCHAN_OUT * 17 * 2 * 32 + 64) +	/* SubbandInfo */ \
+	MP3_PRE_ROUND(64 * MAX_NCHAN) +	/* DequantInfo */ \
+	MP3_PRE_ROUND(512 * MAX_NCHAN + 256))	/* FrameHeader, SideInfo, ScaleFactorInfo */
+
+/* PCM output format (see MP3SetOutputFormat) */
+typedef enum {
+	MP3_OUTPUT_INT16 =   0,		/* short, default */
+	MP3_OUTPUT_INT32 =   1,		/* int, Q(MP3_PCM32_FRACBITS) */
+	MP3_OUTPUT_FLOAT32 = 2		/* float, 1.0 = full scale */
+} MP3OutputFormat;
+
+/* int32 output = 16-bit PCM << 12, full scale is 2^27 (leaves 4 bits of headroom) */
+#define MP3_PCM32_FRACBITS	27
+
+/* called with each granule of PCM as soon as it is synthesized (see MP3SetGranuleCallback)
+ *   pcm points to int or float samples with MP3_OUTPUT_INT32 / MP3_OUTPUT_FLOAT32
+ */
+typedef void (*MP3GranuleCallback)(short *pcm, int nSamps, void *ref);
+
 enum {
 	ERR_MP3_NONE =                  0,
 	ERR_MP3_INDATA_UNDERFLOW =     -1,
@@ -102,6 +154,7 @@ enum {
 	ERR_MP3_INVALID_DEQUANTIZE =   -10,
 	ERR_MP3_INVALID_IMDCT =        -11,
 	ERR_MP3_INVALID_SUBBAND =      -12,
+	ERR_MP3_INVALID_PARAMETER =    -13,
 
 	ERR_UNKNOWN =                  -9999
 };
@@ -118,12 +171,19 @@ typedef struct _MP3FrameInfo {
 
 /* public API */
 HMP3Decoder MP3InitDecoder(void);
+HMP3Decoder MP3InitDecoderPre(void *ptr, int sz);
 void MP3FreeDecoder(HMP3Decoder hMP3Decoder);
+int MP3ResetDecoder(HMP3Decoder hMP3Decoder);
 int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize);
 
 void MP3GetLastFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo);
 int MP3GetNextFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo, unsigned char *buf);
+int MP3GetNextFrameSize(HMP3Decoder hMP3Decoder, unsigned char *buf);
 int MP3FindSyncWord(unsigned char *buf, int nBytes);
+int MP3SetReducedBandwidth(HMP3Decoder hMP3Decoder, int nSubbands, int downsample);
+int MP3SetMonoDownmix(HMP3Decoder hMP3Decoder, int enable);
+int MP3SetGranuleCallback(HMP3Decoder hMP3Decoder, MP3GranuleCallback granuleCallback, void *ref);
+int MP3SetOutputFormat(HMP3Decoder hMP3Decoder, MP3OutputFormat format);
 
 #ifdef __cplusplus
 }
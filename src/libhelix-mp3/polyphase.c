@@ -137,7 +137,7 @@ void PolyphaseMono(short *pcm, int *vbuf, const int *coefBase)
 
 	/* special case, output sample 16 */
 	coef = coefBase + 256;
-	vb1 = vbuf + 64*16;
+	vb1 = vbuf + VBUF_STRIDE*16;
 	sum1L = rndVal;
 
 	MC1M(0)
@@ -153,7 +153,7 @@ void PolyphaseMono(short *pcm, int *vbuf, const int *coefBase)
 
 	/* main convolution loop: sum1L = samples 1, 2, 3, ... 15   sum2L = samples 31, 30, ... 17 */
 	coef = coefBase + 16;
-	vb1 = vbuf + 64;
+	vb1 = vbuf + VBUF_STRIDE;
 	pcm++;
 
 	/* right now, the compiler creates bad asm from this... */
@@ -169,7 +169,7 @@ void PolyphaseMono(short *pcm, int *vbuf, const int *coefBase)
 		MC2M(6)
 		MC2M(7)
 
-		vb1 += 64;
+		vb1 += VBUF_STRIDE;
 		*(pcm)       = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
 		*(pcm + 2*i) = ClipToShort((int)SAR64(sum2L, (32-CSHIFT)), DEF_NFRACBITS);
 		pcm++;
@@ -251,7 +251,7 @@ void PolyphaseStereo(short *pcm, int *vbuf, const int *coefBase)
 
 	/* special case, output sample 16 */
 	coef = coefBase + 256;
-	vb1 = vbuf + 64*16;
+	vb1 = vbuf + VBUF_STRIDE*16;
 	sum1L = sum1R = rndVal;
 
 	MC1S(0)
@@ -268,7 +268,7 @@ void PolyphaseStereo(short *pcm, int *vbuf, const int *coefBase)
 
 	/* main convolution loop: sum1L = samples 1, 2, 3, ... 15   sum2L = samples 31, 30, ... 17 */
 	coef = coefBase + 16;
-	vb1 = vbuf + 64;
+	vb1 = vbuf + VBUF_STRIDE;
 	pcm += 2;
 
 	/* right now, the compiler creates bad asm from this... */
@@ -285,7 +285,7 @@ void PolyphaseStereo(short *pcm, int *vbuf, const int *coefBase)
 		MC2S(6)
 		MC2S(7)
 
-		vb1 += 64;
+		vb1 += VBUF_STRIDE;
 		*(pcm + 0)         = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
 		*(pcm + 1)         = ClipToShort((int)SAR64(sum1R, (32-CSHIFT)), DEF_NFRACBITS);
 		*(pcm + 2*2*i + 0) = ClipToShort((int)SAR64(sum2L, (32-CSHIFT)), DEF_NFRACBITS);
@@ -293,3 +293,361 @@ void PolyphaseStereo(short *pcm, int *vbuf, const int *coefBase)
 		pcm += 2;
 	}
 }
+
+/**************************************************************************************
+ * Function:    PolyphaseMonoDown
+ *
+ * Description: filter one subband and produce 32 >> decimShift output PCM samples for 
+ *                one channel (every 2nd or 4th sample of PolyphaseMono)
+ *
+ * Inputs:      pointer to PCM output buffer
+ *              pointer to start of vbuf (preserved from last call)
+ *              start of filter coefficient table (in proper, shuffled order)
+ *              log2 of downsample factor (0, 1, or 2)
+ *
+ * Outputs:     32 >> decimShift samples of one channel of decoded PCM data
+ *
+ * Return:      none
+ *
+ * Notes:       no anti-alias filtering, so the subbands above 32 >> decimShift must
+ *                be zero (see MP3SetReducedBandwidth)
+ **************************************************************************************/
+void PolyphaseMonoDown(short *pcm, int *vbuf, const int *coefBase, int decimShift)
+{	
+	int i;
+	const int *coef;
+	int *vb1;
+	int vLo, vHi, c1, c2;
+	Word64 sum1L, sum2L, rndVal;
+
+	rndVal = (Word64)( 1 << (DEF_NFRACBITS - 1 + (32 - CSHIFT)) );
+
+	/* special case, output sample 0 */
+	coef = coefBase;
+	vb1 = vbuf;
+	sum1L = rndVal;
+
+	MC0M(0)
+	MC0M(1)
+	MC0M(2)
+	MC0M(3)
+	MC0M(4)
+	MC0M(5)
+	MC0M(6)
+	MC0M(7)
+
+	*(pcm + 0) = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
+
+	/* special case, output sample 16 */
+	coef = coefBase + 256;
+	vb1 = vbuf + VBUF_STRIDE*16;
+	sum1L = rndVal;
+
+	MC1M(0)
+	MC1M(1)
+	MC1M(2)
+	MC1M(3)
+	MC1M(4)
+	MC1M(5)
+	MC1M(6)
+	MC1M(7)
+
+	*(pcm + (16 >> decimShift)) = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
+
+	/* samples i and 32-i, for every (1 << decimShift)th i */
+	for (i = (1 << decimShift); i < 16; i += (1 << decimShift)) {
+		coef = coefBase + 16*i;
+		vb1 = vbuf + VBUF_STRIDE*i;
+		sum1L = sum2L = rndVal;
+
+		MC2M(0)
+		MC2M(1)
+		MC2M(2)
+		MC2M(3)
+		MC2M(4)
+		MC2M(5)
+		MC2M(6)
+		MC2M(7)
+
+		*(pcm + (i >> decimShift))        = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
+		*(pcm + ((32 - i) >> decimShift)) = ClipToShort((int)SAR64(sum2L, (32-CSHIFT)), DEF_NFRACBITS);
+	}
+}
+
+/**************************************************************************************
+ * Function:    PolyphaseStereoDown
+ *
+ * Description: filter one subband and produce 32 >> decimShift output PCM samples for 
+ *                each channel (every 2nd or 4th sample of PolyphaseStereo)
+ *
+ * Inputs:      pointer to PCM output buffer
+ *              pointer to start of vbuf (preserved from last call)
+ *              start of filter coefficient table (in proper, shuffled order)
+ *              log2 of downsample factor (0, 1, or 2)
+ *
+ * Outputs:     32 >> decimShift samples of two channels of decoded PCM data
+ *
+ * Return:      none
+ *
+ * Notes:       interleaves PCM samples LRLRLR...
+ *              no anti-alias filtering, so the subbands above 32 >> decimShift must
+ *                be zero (see MP3SetReducedBandwidth)
+ **************************************************************************************/
+void PolyphaseStereoDown(short *pcm, int *vbuf, const int *coefBase, int decimShift)
+{
+	int i;
+	const int *coef;
+	int *vb1;
+	int vLo, vHi, c1, c2;
+	Word64 sum1L, sum2L, sum1R, sum2R, rndVal;
+
+	rndVal = (Word64)( 1 << (DEF_NFRACBITS - 1 + (32 - CSHIFT)) );
+
+	/* special case, output sample 0 */
+	coef = coefBase;
+	vb1 = vbuf;
+	sum1L = sum1R = rndVal;
+
+	MC0S(0)
+	MC0S(1)
+	MC0S(2)
+	MC0S(3)
+	MC0S(4)
+	MC0S(5)
+	MC0S(6)
+	MC0S(7)
+
+	*(pcm + 0) = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
+	*(pcm + 1) = ClipToShort((int)SAR64(sum1R, (32-CSHIFT)), DEF_NFRACBITS);
+
+	/* special case, output sample 16 */
+	coef = coefBase + 256;
+	vb1 = vbuf + VBUF_STRIDE*16;
+	sum1L = sum1R = rndVal;
+
+	MC1S(0)
+	MC1S(1)
+	MC1S(2)
+	MC1S(3)
+	MC1S(4)
+	MC1S(5)
+	MC1S(6)
+	MC1S(7)
+
+	*(pcm + 2*(16 >> decimShift) + 0) = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
+	*(pcm + 2*(16 >> decimShift) + 1) = ClipToShort((int)SAR64(sum1R, (32-CSHIFT)), DEF_NFRACBITS);
+
+	/* samples i and 32-i, for every (1 << decimShift)th i */
+	for (i = (1 << decimShift); i < 16; i += (1 << decimShift)) {
+		coef = coefBase + 16*i;
+		vb1 = vbuf + VBUF_STRIDE*i;
+		sum1L = sum2L = rndVal;
+		sum1R = sum2R = rndVal;
+
+		MC2S(0)
+		MC2S(1)
+		MC2S(2)
+		MC2S(3)
+		MC2S(4)
+		MC2S(5)
+		MC2S(6)
+		MC2S(7)
+
+		*(pcm + 2*(i >> decimShift) + 0)        = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
+		*(pcm + 2*(i >> decimShift) + 1)        = ClipToShort((int)SAR64(sum1R, (32-CSHIFT)), DEF_NFRACBITS);
+		*(pcm + 2*((32 - i) >> decimShift) + 0) = ClipToShort((int)SAR64(sum2L, (32-CSHIFT)), DEF_NFRACBITS);
+		*(pcm + 2*((32 - i) >> decimShift) + 1) = ClipToShort((int)SAR64(sum2R, (32-CSHIFT)), DEF_NFRACBITS);
+	}
+}
+
+/* 32-bit output: 16-bit PCM scale with (MP3_PCM32_FRACBITS - 15) more fraction bits, 
+ *   so shift the 64-bit sum by that much less than for ClipToShort
+ */
+#define PCM32_SHIFT		(DEF_NFRACBITS + (32 - CSHIFT) - (MP3_PCM32_FRACBITS - 15))
+
+static __inline void StorePCM32(void *pcm, int i, Word64 sum, int isFloat)
+{
+	int x;
+
+	/* assumes you've already rounded (sum += (1 << (PCM32_SHIFT-1))) */
+	sum = SAR64(sum, PCM32_SHIFT);
+	if (sum > 0x7fffffff)
+		x = 0x7fffffff;
+	else if (sum < -0x7fffffff)
+		x = -0x7fffffff;
+	else
+		x = (int)sum;
+
+	if (isFloat)
+		((float *)pcm)[i] = (float)x * (1.0f / (float)(1 << MP3_PCM32_FRACBITS));
+	else
+		((int *)pcm)[i] = x;
+}
+
+/**************************************************************************************
+ * Function:    PolyphaseMono32
+ *
+ * Description: filter one subband and produce 32 >> decimShift output samples for 
+ *                one channel, as int (Q(MP3_PCM32_FRACBITS)) or float
+ *
+ * Inputs:      pointer to output buffer (int or float)
+ *              pointer to start of vbuf (preserved from last call)
+ *              start of filter coefficient table (in proper, shuffled order)
+ *              log2 of downsample factor (0, 1, or 2, see PolyphaseMonoDown)
+ *              0 for int output, 1 for float output (1.0 = full scale)
+ *
+ * Outputs:     32 >> decimShift samples of one channel of decoded PCM data
+ *
+ * Return:      none
+ *
+ * Notes:       same filter as PolyphaseMono, but no rounding to 16 bits - int output 
+ *                keeps MP3_PCM32_FRACBITS - 15 extra fraction bits and saturates 
+ *                only at the 32-bit limit (i.e. 31 - MP3_PCM32_FRACBITS bits headroom)
+ **************************************************************************************/
+void PolyphaseMono32(void *pcm, int *vbuf, const int *coefBase, int decimShift, int isFloat)
+{	
+	int i;
+	const int *coef;
+	int *vb1;
+	int vLo, vHi, c1, c2;
+	Word64 sum1L, sum2L, rndVal;
+
+	rndVal = (Word64)1 << (PCM32_SHIFT - 1);
+
+	/* special case, output sample 0 */
+	coef = coefBase;
+	vb1 = vbuf;
+	sum1L = rndVal;
+
+	MC0M(0)
+	MC0M(1)
+	MC0M(2)
+	MC0M(3)
+	MC0M(4)
+	MC0M(5)
+	MC0M(6)
+	MC0M(7)
+
+	StorePCM32(pcm, 0, sum1L, isFloat);
+
+	/* special case, output sample 16 */
+	coef = coefBase + 256;
+	vb1 = vbuf + VBUF_STRIDE*16;
+	sum1L = rndVal;
+
+	MC1M(0)
+	MC1M(1)
+	MC1M(2)
+	MC1M(3)
+	MC1M(4)
+	MC1M(5)
+	MC1M(6)
+	MC1M(7)
+
+	StorePCM32(pcm, 16 >> decimShift, sum1L, isFloat);
+
+	/* samples i and 32-i, for every (1 << decimShift)th i */
+	for (i = (1 << decimShift); i < 16; i += (1 << decimShift)) {
+		coef = coefBase + 16*i;
+		vb1 = vbuf + VBUF_STRIDE*i;
+		sum1L = sum2L = rndVal;
+
+		MC2M(0)
+		MC2M(1)
+		MC2M(2)
+		MC2M(3)
+		MC2M(4)
+		MC2M(5)
+		MC2M(6)
+		MC2M(7)
+
+		StorePCM32(pcm, i >> decimShift, sum1L, isFloat);
+		StorePCM32(pcm, (32 - i) >> decimShift, sum2L, isFloat);
+	}
+}
+
+/**************************************************************************************
+ * Function:    PolyphaseStereo32
+ *
+ * Description: filter one subband and produce 32 >> decimShift output samples for 
+ *                each channel, as int (Q(MP3_PCM32_FRACBITS)) or float
+ *
+ * Inputs:      pointer to output buffer (int or float)
+ *              pointer to start of vbuf (preserved from last call)
+ *              start of filter coefficient table (in proper, shuffled order)
+ *              log2 of downsample factor (0, 1, or 2, see PolyphaseStereoDown)
+ *              0 for int output, 1 for float output (1.0 = full scale)
+ *
+ * Outputs:     32 >> decimShift samples of two channels of decoded PCM data
+ *
+ * Return:      none
+ *
+ * Notes:       interleaves PCM samples LRLRLR...
+ *              see PolyphaseMono32 for output format
+ **************************************************************************************/
+void PolyphaseStereo32(void *pcm, int *vbuf, const int *coefBase, int decimShift, int isFloat)
+{
+	int i;
+	const int *coef;
+	int *vb1;
+	int vLo, vHi, c1, c2;
+	Word64 sum1L, sum2L, sum1R, sum2R, rndVal;
+
+	rndVal = (Word64)1 << (PCM32_SHIFT - 1);
+
+	/* special case, output sample 0 */
+	coef = coefBase;
+	vb1 = vbuf;
+	sum1L = sum1R = rndVal;
+
+	MC0S(0)
+	MC0S(1)
+	MC0S(2)
+	MC0S(3)
+	MC0S(4)
+	MC0S(5)
+	MC0S(6)
+	MC0S(7)
+
+	StorePCM32(pcm, 0, sum1L, isFloat);
+	StorePCM32(pcm, 1, sum1R, isFloat);
+
+	/* special case, output sample 16 */
+	coef = coefBase + 256;
+	vb1 = vbuf + VBUF_STRIDE*16;
+	sum1L = sum1R = rndVal;
+
+	MC1S(0)
+	MC1S(1)
+	MC1S(2)
+	MC1S(3)
+	MC1S(4)
+	MC1S(5)
+	MC1S(6)
+	MC1S(7)
+
+	StorePCM32(pcm, 2*(16 >> decimShift) + 0, sum1L, isFloat);
+	StorePCM32(pcm, 2*(16 >> decimShift) + 1, sum1R, isFloat);
+
+	/* samples i and 32-i, for every (1 << decimShift)th i */
+	for (i = (1 << decimShift); i < 16; i += (1 << decimShift)) {
+		coef = coefBase + 16*i;
+		vb1 = vbuf + VBUF_STRIDE*i;
+		sum1L = sum2L = rndVal;
+		sum1R = sum2R = rndVal;
+
+		MC2S(0)
+		MC2S(1)
+		MC2S(2)
+		MC2S(3)
+		MC2S(4)
+		MC2S(5)
+		MC2S(6)
+		MC2S(7)
+
+		StorePCM32(pcm, 2*(i >> decimShift) + 0, sum1L, isFloat);
+		StorePCM32(pcm, 2*(i >> decimShift) + 1, sum1R, isFloat);
+		StorePCM32(pcm, 2*((32 - i) >> decimShift) + 0, sum2L, isFloat);
+		StorePCM32(pcm, 2*((32 - i) >> decimShift) + 1, sum2R, isFloat);
+	}
+}
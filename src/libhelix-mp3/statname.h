@@ -64,7 +64,9 @@
 #define	UnpackFrameHeader	STATNAME(UnpackFrameHeader)
 #define	UnpackSideInfo		STATNAME(UnpackSideInfo)
 #define	AllocateBuffers		STATNAME(AllocateBuffers)
+#define	AllocateBuffersPre	STATNAME(AllocateBuffersPre)
 #define	FreeBuffers			STATNAME(FreeBuffers)
+#define	ResetBuffers		STATNAME(ResetBuffers)
 #define	DecodeHuffman		STATNAME(DecodeHuffman)
 #define	Dequantize			STATNAME(Dequantize)
 #define	IMDCT				STATNAME(IMDCT)
@@ -69,7 +69,27 @@ void MidSideProc(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, int mOut[2])
 	 * NOTE: 1/sqrt(2) done in DequantChannel() - see comments there
 	 */
 	mOutL = mOutR = 0;
-	for(i = 0; i < nSamps; i++) {
+	i = 0;
+#ifdef MP3_SIMD_SSE41
+	{
+		__m128i vl, vr, vs, vd, ml, mr;
+
+		ml = mr = _mm_setzero_si128();
+		for ( ; i <= nSamps - 4; i += 4) {
+			vl = _mm_loadu_si128((const __m128i *)(x[0] + i));
+			vr = _mm_loadu_si128((const __m128i *)(x[1] + i));
+			vs = _mm_add_epi32(vl, vr);
+			vd = _mm_sub_epi32(vl, vr);
+			_mm_storeu_si128((__m128i *)(x[0] + i), vs);
+			_mm_storeu_si128((__m128i *)(x[1] + i), vd);
+			ml = _mm_or_si128(ml, FASTABS_X4(vs));
+			mr = _mm_or_si128(mr, FASTABS_X4(vd));
+		}
+		mOutL = ORREDUCE_X4(ml);
+		mOutR = ORREDUCE_X4(mr);
+	}
+#endif
+	for( ; i < nSamps; i++) {
 		xl = x[0][i];
 		xr = x[1][i];
 		x[0][i] = xl + xr;
@@ -81,6 +101,66 @@ void MidSideProc(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, int mOut[2])
 	mOut[1] |= mOutR;
 }
 
+/**************************************************************************************
+ * Function:    IntensityBand
+ *
+ * Description: apply intensity stereo gains to a run of samples from the left channel
+ *
+ * Inputs:      left and right channel sample pointers
+ *              number of samples
+ *              left and right gains, used round-robin (sample k uses gain [k % 3]), so 
+ *                pass the same gain 3 times for long blocks or one gain per window for 
+ *                reordered short blocks
+ *              guard bit masks (left and right channels)
+ *
+ * Outputs:     right channel = left * fr, left channel = left * fl
+ *              updated guard bit masks
+ *
+ * Return:      none
+ *
+ * Notes:       SSE4.1 version does 12 samples (4 full cycles of the 3 gains) per step
+ **************************************************************************************/
+static void IntensityBand(int *xl, int *xr, int n, const int fl[3], const int fr[3], int *mOutL, int *mOutR)
+{
+	int i, k, yl, yr, mL, mR;
+
+	mL = mR = 0;
+	i = 0;
+#ifdef MP3_SIMD_SSE41
+	{
+		int j;
+		__m128i vfl[3], vfr[3], vx, vy, ml, mr;
+
+		for (j = 0; j < 3; j++) {
+			vfl[j] = _mm_setr_epi32(fl[j], fl[(j+1) % 3], fl[(j+2) % 3], fl[j]);
+			vfr[j] = _mm_setr_epi32(fr[j], fr[(j+1) % 3], fr[(j+2) % 3], fr[j]);
+		}
+		ml = mr = _mm_setzero_si128();
+		for ( ; i <= n - 12; i += 12) {
+			for (j = 0; j < 3; j++) {
+				vx = _mm_loadu_si128((const __m128i *)(xl + i + 4*j));
+				vy = _mm_slli_epi32(MULSHIFT32_X4(vfr[(4*j) % 3], vx), 2);
+				_mm_storeu_si128((__m128i *)(xr + i + 4*j), vy);
+				mr = _mm_or_si128(mr, FASTABS_X4(vy));
+				vy = _mm_slli_epi32(MULSHIFT32_X4(vfl[(4*j) % 3], vx), 2);
+				_mm_storeu_si128((__m128i *)(xl + i + 4*j), vy);
+				ml = _mm_or_si128(ml, FASTABS_X4(vy));
+			}
+		}
+		mL = ORREDUCE_X4(ml);
+		mR = ORREDUCE_X4(mr);
+	}
+#endif
+	for (k = 0; i < n; i++) {
+		yr = MULSHIFT32(fr[k], xl[i]) << 2;	xr[i] = yr;	mR |= FASTABS(yr);
+		yl = MULSHIFT32(fl[k], xl[i]) << 2;	xl[i] = yl;	mL |= FASTABS(yl);
+		if (++k == 3)
+			k = 0;
+	}
+	*mOutL |= mL;
+	*mOutR |= mR;
+}
+
 /**************************************************************************************
  * Function:    IntensityProcMPEG1
  *
@@ -106,8 +186,8 @@ void MidSideProc(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, int mOut[2])
 void IntensityProcMPEG1(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh, ScaleFactorInfoSub *sfis, 
 						CriticalBandInfo *cbi, int midSideFlag, int mixFlag, int mOut[2])
 {
-	int i=0, j=0, n=0, cb=0, w=0;
-	int sampsLeft, isf, mOutL, mOutR, xl, xr;
+	int i=0, n=0, cb=0, w=0;
+	int sampsLeft, isf, mOutL, mOutR;
 	int fl, fr, fls[3], frs[3];
 	int cbStartL=0, cbStartS=0, cbEndL=0, cbEndS=0;
 	int *isfTab;
@@ -148,11 +228,12 @@ void IntensityProcMPEG1(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh
 		}
 
 		n = fh->sfBand->l[cb + 1] - fh->sfBand->l[cb];
-		for (j = 0; j < n && sampsLeft > 0; j++, i++) {
-			xr = MULSHIFT32(fr, x[0][i]) << 2;	x[1][i] = xr; mOutR |= FASTABS(xr);
-			xl = MULSHIFT32(fl, x[0][i]) << 2;	x[0][i] = xl; mOutL |= FASTABS(xl);
-			sampsLeft--;
-		}
+		n = MIN(n, sampsLeft);
+		fls[0] = fls[1] = fls[2] = fl;
+		frs[0] = frs[1] = frs[2] = fr;
+		IntensityBand(x[0] + i, x[1] + i, n, fls, frs, &mOutL, &mOutR);
+		i += n;
+		sampsLeft -= n;
 	}
 
 	/* short blocks */
@@ -168,16 +249,12 @@ void IntensityProcMPEG1(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh
 			}
 		}
 
+		/* short blocks are already reordered (interleaved by window) */
 		n = fh->sfBand->s[cb + 1] - fh->sfBand->s[cb];
-		for (j = 0; j < n && sampsLeft >= 3; j++, i+=3) {
-			xr = MULSHIFT32(frs[0], x[0][i+0]) << 2;	x[1][i+0] = xr;	mOutR |= FASTABS(xr);
-			xl = MULSHIFT32(fls[0], x[0][i+0]) << 2;	x[0][i+0] = xl;	mOutL |= FASTABS(xl);
-			xr = MULSHIFT32(frs[1], x[0][i+1]) << 2;	x[1][i+1] = xr;	mOutR |= FASTABS(xr);
-			xl = MULSHIFT32(fls[1], x[0][i+1]) << 2;	x[0][i+1] = xl;	mOutL |= FASTABS(xl);
-			xr = MULSHIFT32(frs[2], x[0][i+2]) << 2;	x[1][i+2] = xr;	mOutR |= FASTABS(xr);
-			xl = MULSHIFT32(fls[2], x[0][i+2]) << 2;	x[0][i+2] = xl;	mOutL |= FASTABS(xl);
-			sampsLeft -= 3;
-		}
+		n = 3 * MIN(n, sampsLeft / 3);
+		IntensityBand(x[0] + i, x[1] + i, n, fls, frs, &mOutL, &mOutR);
+		i += n;
+		sampsLeft -= n;
 	}
 	mOut[0] = mOutL;
 	mOut[1] = mOutR;
@@ -213,7 +290,7 @@ void IntensityProcMPEG2(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh
 						CriticalBandInfo *cbi, ScaleFactorJS *sfjs, int midSideFlag, int mixFlag, int mOut[2])
 {
 	int i, j, k, n, r, cb, w;
-	int fl, fr, mOutL, mOutR, xl, xr;
+	int fl, fr, fls[3], frs[3], mOutL, mOutR, xl, xr;
 	int sampsLeft;
 	int isf, sfIdx, tmp, il[23];
 	int *isfTab;
@@ -248,11 +325,10 @@ void IntensityProcMPEG2(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh
 				fr = isfTab[(sfIdx & 0x01 ? 0 : isf)];
 			}
 			n = MIN(fh->sfBand->l[cb + 1] - fh->sfBand->l[cb], sampsLeft);
-
-			for(j = 0; j < n; j++, i++) {
-				xr = MULSHIFT32(fr, x[0][i]) << 2;	x[1][i] = xr;	mOutR |= FASTABS(xr);
-				xl = MULSHIFT32(fl, x[0][i]) << 2;	x[0][i] = xl;	mOutL |= FASTABS(xl);
-			}
+			fls[0] = fls[1] = fls[2] = fl;
+			frs[0] = frs[1] = frs[2] = fr;
+			IntensityBand(x[0] + i, x[1] + i, n, fls, frs, &mOutL, &mOutR);
+			i += MAX(n, 0);
 
 			/* early exit once we've used all the non-zero samples */
 			sampsLeft -= n;
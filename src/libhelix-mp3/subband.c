@@ -42,9 +42,59 @@
  *               followed by polyphase filter)
  **************************************************************************************/
 
+#include <string.h>
 #include "coder.h"
 #include "assembly.h"
 
+/**************************************************************************************
+ * Function:    DownmixSubband
+ *
+ * Description: sum the IMDCT outputs of both channels into channel 0 (mono downmix)
+ *
+ * Inputs:      IMDCTInfo with outBuf and gb filled in for both channels
+ *                (L / 2 and R / 2, see Dequantize)
+ *              HuffmanInfo (holds the IMDCT output of channel 1 in a mono-only build)
+ *
+ * Outputs:     (L + R) / 2 in outBuf[0], updated gb[0]
+ *
+ * Return:      none
+ **************************************************************************************/
+static void DownmixSubband(IMDCTInfo *mi, HuffmanInfo *hi)
+{
+	int i, s, mOut;
+	int *y0, *y1;
+	Word64 s64;
+
+#if MAX_NCHAN_OUT >= MAX_NCHAN
+	(void)hi;	/* only used by IMDCT_OUT() in a mono-only build */
+#endif
+
+	if (mi->gb[1] == CLZ(0) - 1)
+		return;		/* nothing in channel 1 */
+
+	y0 = IMDCT_OUT(mi, hi, 0)[0];
+	y1 = IMDCT_OUT(mi, hi, 1)[0];
+	mOut = 0;
+
+	if (mi->gb[0] >= 1 && mi->gb[1] >= 1) {
+		for (i = 0; i < BLOCK_SIZE * NBANDS; i++) {
+			s = y0[i] + y1[i];
+			y0[i] = s;
+			mOut |= FASTABS(s);
+		}
+	} else {
+		/* no guard bit to spare - saturate */
+		for (i = 0; i < BLOCK_SIZE * NBANDS; i++) {
+			s64 = (Word64)y0[i] + y1[i];
+			if (s64 >  0x7fffffff)	s64 =  0x7fffffff;
+			if (s64 < -0x7fffffff)	s64 = -0x7fffffff;
+			y0[i] = (int)s64;
+			mOut |= FASTABS(y0[i]);
+		}
+	}
+	mi->gb[0] = CLZ(mOut) - 1;
+}
+
 /**************************************************************************************
  * Function:    Subband
  *
@@ -53,13 +103,18 @@
  * Inputs:      filled MP3DecInfo structure, after calling IMDCT for all channels
  *              vbuf[ch] and vindex[ch] must be preserved between calls
  *
- * Outputs:     decoded PCM data, interleaved LRLRLR... if stereo
+ * Outputs:     decoded PCM data, interleaved LRLRLR... if stereo (and no mono downmix)
+ *                (NBANDS >> decimShift samples per block and channel)
+ *                as short, int or float, depending on mp3DecInfo->outFormat
  *
  * Return:      0 on success,  -1 if null input pointers
  **************************************************************************************/
-int Subband(MP3DecInfo *mp3DecInfo, short *pcmBuf)
+int Subband(MP3DecInfo *mp3DecInfo, void *pcmBuf)
 {
-	int b;
+	int b, ch, nChans, nOut, outZero, skip[MAX_NCHAN_OUT], skipAll, isFloat;
+	int *vb, *pcm32;
+	short *pcm16;
+	HuffmanInfo *hi;
 	IMDCTInfo *mi;
 	SubbandInfo *sbi;
 
@@ -67,25 +122,71 @@ int Subband(MP3DecInfo *mp3DecInfo, short *pcmBuf)
 	if (!mp3DecInfo || !mp3DecInfo->HuffmanInfoPS || !mp3DecInfo->IMDCTInfoPS || !mp3DecInfo->SubbandInfoPS)
 		return -1;
 
+	hi = (HuffmanInfo *)(mp3DecInfo->HuffmanInfoPS);
 	mi = (IMDCTInfo *)(mp3DecInfo->IMDCTInfoPS);
 	sbi = (SubbandInfo*)(mp3DecInfo->SubbandInfoPS);
 
-	if (mp3DecInfo->nChans == 2) {
+	/* mono downmix - if each channel had its own IMDCT, combine them here so only one 
+	 *   DCT and polyphase filter run per block
+	 */
+	nChans = NCHANS_OUT(mp3DecInfo);
+	if (nChans < mp3DecInfo->nChans && !mp3DecInfo->monoSpec)
+		DownmixSubband(mi, hi);
+
+	/* IMDCT reports gb = CLZ(0) - 1 when its whole output is zero - if vbuf for that channel only
+	 *   holds zeros as well, the DCT would just write zeros over zeros, so skip it
+	 */
+	skipAll = 1;
+	for (ch = 0; ch < nChans; ch++) {
+		outZero = (mi->gb[ch] == CLZ(0) - 1);
+		skip[ch] = (outZero && sbi->zeroBlocks[ch] >= VBUF_NBLOCKS);
+		sbi->zeroBlocks[ch] = (outZero ? MIN(sbi->zeroBlocks[ch] + BLOCK_SIZE, VBUF_NBLOCKS) : 0);
+		skipAll &= skip[ch];
+	}
+
+	nOut = NBANDS >> mp3DecInfo->decimShift;
+	isFloat = (mp3DecInfo->outFormat == MP3_OUTPUT_FLOAT32);
+	pcm16 = (short *)pcmBuf;
+	pcm32 = (int *)pcmBuf;
+
+	if (skipAll) {
+		/* digital silence - polyphase filter of an all-zero vbuf gives all-zero PCM */
+		memset(pcmBuf, 0, BLOCK_SIZE * nOut * nChans * SAMPLE_BYTES(mp3DecInfo));
+		sbi->vindex = (sbi->vindex - BLOCK_SIZE / 2) & 7;
+#if MAX_NCHAN_OUT > 1
+	} else if (nChans == 2) {
 		/* stereo */
 		for (b = 0; b < BLOCK_SIZE; b++) {
-			FDCT32(mi->outBuf[0][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), mi->gb[0]);
-			FDCT32(mi->outBuf[1][b], sbi->vbuf + 1*32, sbi->vindex, (b & 0x01), mi->gb[1]);
-			PolyphaseStereo(pcmBuf, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01), polyCoef);
+			if (!skip[0])
+				FDCT32(mi->outBuf[0][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), mi->gb[0]);
+			if (!skip[1])
+				FDCT32(mi->outBuf[1][b], sbi->vbuf + 1*32, sbi->vindex, (b & 0x01), mi->gb[1]);
+			vb = sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01);
+			if (mp3DecInfo->outFormat != MP3_OUTPUT_INT16)
+				PolyphaseStereo32(pcm32, vb, polyCoef, mp3DecInfo->decimShift, isFloat);
+			else if (mp3DecInfo->decimShift)
+				PolyphaseStereoDown(pcm16, vb, polyCoef, mp3DecInfo->decimShift);
+			else
+				PolyphaseStereo(pcm16, vb, polyCoef);
 			sbi->vindex = (sbi->vindex - (b & 0x01)) & 7;
-			pcmBuf += (2 * NBANDS);
+			pcm16 += (2 * nOut);
+			pcm32 += (2 * nOut);
 		}
+#endif
 	} else {
 		/* mono */
 		for (b = 0; b < BLOCK_SIZE; b++) {
 			FDCT32(mi->outBuf[0][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), mi->gb[0]);
-			PolyphaseMono(pcmBuf, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01), polyCoef);
+			vb = sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01);
+			if (mp3DecInfo->outFormat != MP3_OUTPUT_INT16)
+				PolyphaseMono32(pcm32, vb, polyCoef, mp3DecInfo->decimShift, isFloat);
+			else if (mp3DecInfo->decimShift)
+				PolyphaseMonoDown(pcm16, vb, polyCoef, mp3DecInfo->decimShift);
+			else
+				PolyphaseMono(pcm16, vb, polyCoef);
 			sbi->vindex = (sbi->vindex - (b & 0x01)) & 7;
-			pcmBuf += NBANDS;
+			pcm16 += nOut;
+			pcm32 += nOut;
 		}
 	}
 